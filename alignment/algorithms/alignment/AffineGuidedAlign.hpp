@@ -42,6 +42,8 @@ int AffineGuidedAlign(QSequence &origQSeq, TSequence &origTSeq, Alignment &guide
      matrixOut.open(matrixOutNameStrm.str().c_str());
      */
 
+    // QVs of the query are read directly below.
+    qSeq.LoadQVs(FASTQTracks);
     if (computeProb) {
         //
         // Convert phred scale to proper ln for faster manipulation later on.
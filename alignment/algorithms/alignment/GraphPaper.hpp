@@ -1,7 +1,12 @@
 #ifndef GRAPH_PAPER_HPP_
 #define GRAPH_PAPER_HPP_
 
+#include <cstdint>
+#include <vector>
+
 #include <alignment/datastructures/alignment/Path.h>
+#include <alignment/algorithms/anchoring/PrefixMaxTree.hpp>
+#include <alignment/algorithms/sorting/RadixSort.hpp>
 #include <pbdata/matrix/FlatMatrix.hpp>
 
 template <typename T_Point>
@@ -14,6 +19,21 @@ int GraphPaper(std::vector<T_Point> &points, int nRows, int nCols, FlatMatrix2D<
                FlatMatrix2D<int> &scoreMat, FlatMatrix2D<Arrow> &pathMat,
                std::vector<bool> &onOptPath);
 
+//
+// Filter points to those near the heaviest monotone path through a grid
+// of bins, without allocating the grid.  Only the occupied bins are
+// stored, as a sorted list of cells, and the path is the chain of
+// occupied cells of largest total point length, found with a prefix
+// maximum over columns in O(c log c) for c cells.  Bins are squares
+// whose side is a power of two chosen from the number of points, so
+// that a point is binned with a shift.  A point is on the path if its
+// bin is within bandBins bins of the line between two consecutive cells
+// of the chain, so points in a gap between cells are kept only near the
+// diagonal across it.  Returns the number of points on the path.
+//
+template <typename T_Point>
+int SparseGraphPaper(std::vector<T_Point> &points, std::vector<bool> &onOptPath, int bandBins = 1);
+
 template <typename T_Point>
 void RemoveOffOpt(std::vector<T_Point> &points, std::vector<bool> &optPath);
 
@@ -1,6 +1,8 @@
 #ifndef GRAPH_PAPER_IMPL_HPP_
 #define GRAPH_PAPER_IMPL_HPP_
 
+#include <algorithm>
+
 template <typename T_Point>
 bool SetBounds(std::vector<T_Point> &points, DNALength &minPos, DNALength &maxPos, int axis)
 {
@@ -32,10 +34,8 @@ bool SetBounds(std::vector<T_Point> &points, DNALength &minPos, DNALength &maxPo
 inline int GetIndex(DNALength pos, DNALength minPos, DNALength maxPos, int nBins)
 {
     assert(maxPos != minPos);
-    float diff = pos - minPos;
-    float len = maxPos - minPos;
-    float ratio = diff / len;
-    return std::min((DNALength)(nBins - 1), ((DNALength)(ratio * nBins)));
+    uint64_t bin = static_cast<uint64_t>(pos - minPos) * nBins / (maxPos - minPos);
+    return std::min(static_cast<uint64_t>(nBins - 1), bin);
 }
 
 template <typename T_Point>
@@ -152,6 +152,146 @@ int GraphPaper(std::vector<T_Point> &points, int nRows, int nCols, FlatMatrix2D<
     return nOpt;
 }
 
+template <typename T_Point>
+int SparseGraphPaper(std::vector<T_Point> &points, std::vector<bool> &onOptPath, int bandBins)
+{
+    onOptPath.assign(points.size(), false);
+    if (points.empty()) {
+        return 0;
+    }
+    DNALength xMin, xMax, yMin, yMax;
+    SetBounds(points, xMin, xMax, 0);
+    SetBounds(points, yMin, yMax, 1);
+
+    //
+    // Use about one bin per 16 points along the longer axis, at least as
+    // fine as the dense 50 x 50 grid, and at most 2^15 bins, so that the
+    // row and column of a bin pack into 32 bits.
+    //
+    const uint64_t pointsPerBin = 16;
+    const uint64_t minBins = 50, maxBins = 1 << 15;
+    uint64_t nBins =
+        std::max(minBins, std::min(maxBins, static_cast<uint64_t>(points.size()) / pointsPerBin));
+    uint64_t span = std::max(xMax - xMin, yMax - yMin) + 1;
+    int binShift = 0;
+    while ((span >> binShift) > nBins) {
+        binShift++;
+    }
+
+    //
+    // Sort the points by bin, row major, and sum the point lengths of
+    // each occupied bin.
+    //
+    std::vector<uint64_t> keys(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        uint64_t row = (points[i].GetX() - xMin) >> binShift;
+        uint64_t col = (points[i].GetY() - yMin) >> binShift;
+        keys[i] = (row << 16) | col;
+    }
+    std::vector<uint32_t> order;
+    RadixSort sorter;
+    sorter.SortWithOrder(keys, order);
+
+    std::vector<uint64_t> cellKeys;
+    std::vector<double> cellWeights;
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (i == 0 or keys[i] != keys[i - 1]) {
+            cellKeys.push_back(keys[i]);
+            cellWeights.push_back(0);
+        }
+        cellWeights.back() += points[order[i]].length;
+    }
+
+    //
+    // The heaviest chain of cells that do not decrease in row or column.
+    // Cells are visited row major, so every cell before this one in
+    // both is already in the prefix maximum.
+    //
+    const uint32_t colMask = 0xffff;
+    std::vector<VectorIndex> prevCell(cellKeys.size(), PrefixMaxTree::NoIndex);
+    PrefixMaxTree maxScore;
+    maxScore.Reset(((yMax - yMin) >> binShift) + 1);
+    double bestScore = 0;
+    VectorIndex bestCell = 0;
+    for (VectorIndex c = 0; c < cellKeys.size(); c++) {
+        uint32_t col = cellKeys[c] & colMask;
+        double score = cellWeights[c], prevScore;
+        if (maxScore.Query(col + 1, prevScore, prevCell[c])) {
+            score += prevScore;
+        }
+        maxScore.Update(col, score, c);
+        if (score > bestScore) {
+            bestScore = score;
+            bestCell = c;
+        }
+    }
+    std::vector<int64_t> chainRows, chainCols;
+    for (VectorIndex c = bestCell; c != PrefixMaxTree::NoIndex; c = prevCell[c]) {
+        chainRows.push_back(cellKeys[c] >> 16);
+        chainCols.push_back(cellKeys[c] & colMask);
+    }
+    std::reverse(chainRows.begin(), chainRows.end());
+    std::reverse(chainCols.begin(), chainCols.end());
+
+    //
+    // Segment k of the chain runs from chain cell k to cell k+1, and its
+    // column at a row between theirs is interpolated along it.  Over the
+    // rows of a cell a segment spans the columns between its columns at
+    // the top and bottom of the cell, clamped to its end cells, and the
+    // cell is on the path if it is within bandBins of those columns and
+    // rows.  Rows and columns of the chain do not decrease, so the
+    // segments near the rows of a cell are a range that only moves
+    // forward as cells are visited in order of row.
+    //
+    std::vector<bool> cellOnPath(cellKeys.size(), false);
+    int64_t nChain = chainRows.size();
+    int64_t first = 0, last = 0;
+    for (size_t c = 0; c < cellKeys.size(); c++) {
+        int64_t row = cellKeys[c] >> 16;
+        int64_t col = cellKeys[c] & colMask;
+        // The first chain cell at or below the band, and the first past it.
+        while (first < nChain and chainRows[first] < row - bandBins) {
+            first++;
+        }
+        while (last < nChain and chainRows[last] <= row + bandBins) {
+            last++;
+        }
+        // The segments that end in or past the band and start in or before it.
+        int64_t firstSegment = std::max<int64_t>(0, first - 1);
+        int64_t lastSegment = std::min(last - 1, std::max<int64_t>(0, nChain - 2));
+        for (int64_t k = firstSegment; k <= lastSegment and !cellOnPath[c]; k++) {
+            int64_t end = std::min(k + 1, nChain - 1);
+            double r0 = chainRows[k], r1 = chainRows[end];
+            double c0 = chainCols[k], c1 = chainCols[end];
+            double top = std::max(r0, std::min(r1, row - 0.5));
+            double bottom = std::max(r0, std::min(r1, row + 0.5));
+            double colMin = c0, colMax = c1;
+            if (r1 > r0) {
+                colMin = c0 + (top - r0) * (c1 - c0) / (r1 - r0);
+                colMax = c0 + (bottom - r0) * (c1 - c0) / (r1 - r0);
+            }
+            if (col < colMin - bandBins) {
+                // Columns of later segments are no smaller.
+                break;
+            }
+            cellOnPath[c] =
+                (row >= r0 - bandBins and row <= r1 + bandBins and col <= colMax + bandBins);
+        }
+    }
+
+    int nOpt = 0;
+    for (size_t i = 0, c = 0; i < keys.size(); i++) {
+        if (i > 0 and keys[i] != keys[i - 1]) {
+            c++;
+        }
+        if (cellOnPath[c]) {
+            onOptPath[order[i]] = true;
+            ++nOpt;
+        }
+    }
+    return nOpt;
+}
+
 template <typename T_Point>
 void RemoveOffOpt(std::vector<T_Point> &points, std::vector<bool> &optPath)
 {
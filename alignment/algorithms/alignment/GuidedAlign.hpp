@@ -110,6 +110,8 @@ int GuidedAlign(QSequence &origQSeq, TSequence &origTSeq, blasr::Alignment &guid
      matrixOut.open(matrixOutNameStrm.str().c_str());
      */
 
+    // QVs of the query are read directly below.
+    qSeq.LoadQVs(FASTQTracks);
     if (computeProb) {
         //
         // Convert phred scale to proper ln for faster manipulation later on.
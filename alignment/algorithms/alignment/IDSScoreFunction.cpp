@@ -19,7 +19,7 @@ template <>
 int IDSScoreFunction<DNASequence, FASTQSequence>::Deletion(DNASequence &ref, DNALength refPos,
                                                            FASTQSequence &query, DNALength queryPos)
 {
-
+    query.LoadQVs(DeletionQV | DeletionTag);
     if (query.deletionQV.Empty() == false and query.deletionTag != NULL) {
         if (query.deletionTag[queryPos] == 'N') {
             return globalDeletionPrior;  //query.deletionQV[queryPos] ;
@@ -38,6 +38,7 @@ int IDSScoreFunction<DNASequence, FASTQSequence>::Deletion(DNASequence &ref, DNA
 template <>
 int IDSScoreFunction<DNASequence, FASTQSequence>::Deletion(FASTQSequence &query, DNALength queryPos)
 {
+    query.LoadQVs(DeletionQV);
     if (not query.deletionQV.Empty())
         return query.deletionQV[queryPos];
     else
@@ -58,6 +59,7 @@ int IDSScoreFunction<DNASequence, FASTQSequence>::Insertion(DNASequence &refSeq,
 {
     (void)(refSeq);
     (void)(refPos);
+    query.LoadQVs(InsertionQV);
     if (not query.insertionQV.Empty()) return query.insertionQV[pos];
     return ins;
 }
@@ -65,6 +67,7 @@ int IDSScoreFunction<DNASequence, FASTQSequence>::Insertion(DNASequence &refSeq,
 template <>
 int IDSScoreFunction<DNASequence, FASTQSequence>::Insertion(FASTQSequence &query, DNALength pos)
 {
+    query.LoadQVs(InsertionQV);
     if (not query.insertionQV.Empty()) return query.insertionQV[pos];
     return ins;
 }
@@ -73,7 +76,7 @@ template <>
 int IDSScoreFunction<DNASequence, FASTQSequence>::Match(DNASequence &ref, DNALength refPos,
                                                         FASTQSequence &query, DNALength queryPos)
 {
-
+    query.LoadQVs(SubstitutionQV | SubstitutionTag);
     if (query.seq[queryPos] == ref.seq[refPos]) {
         return 0;
     } else if (query.substitutionTag != NULL) {
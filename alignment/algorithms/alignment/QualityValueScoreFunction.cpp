@@ -102,6 +102,7 @@ int QualityValueScoreFunction<DNASequence, FASTQSequence>::Insertion(FASTQSequen
                                                                      DNALength pos)
 {
     // Positive value for quality value penalizes the alignment.
+    query.LoadQVs(QualityValueTrack);
     return query.qual[pos];
 }
 
@@ -127,6 +128,7 @@ int QualityValueScoreFunction<DNASequence, FASTQSequence>::Match(DNASequence &re
                                                                  DNALength queryPos)
 {
     // Positive value for quality value penalizes the alignment.
+    query.LoadQVs(QualityValueTrack);
     return (QVDistanceMatrix[ThreeBit[query.seq[queryPos]]][ThreeBit[ref.seq[refPos]]] *
             query.qual[queryPos]);
 }
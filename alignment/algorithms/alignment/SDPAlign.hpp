@@ -4,6 +4,7 @@
 #include <alignment/algorithms/alignment/DistanceMatrixScoreFunction.hpp>
 #include <alignment/algorithms/alignment/sdp/SDPFragment.hpp>
 #include <alignment/tuples/TupleMatching.hpp>
+#include <alignment/utils/WorkerPool.hpp>
 #include <pbdata/DNASequence.hpp>
 #include <pbdata/FASTASequence.hpp>
 #include <pbdata/FASTQSequence.hpp>
@@ -12,12 +13,19 @@
 #define SDP_PREFIX_LENGTH 50
 #define SDP_SUFFIX_LENGTH 50
 
+//
+// The gaps between the blocks of the chain found by SDP are aligned in
+// detail on the threads of refinePool, if given, or else on the calling
+// thread.  The gaps share scoreFn, so T_ScoreFn must then be safe to
+// call from several threads at once, as DistanceMatrixScoreFunction is.
+//
 template <typename T_QuerySequence, typename T_TargetSequence, typename T_ScoreFn>
 int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreFn, int wordSize,
              int sdpIns, int sdpDel, float indelRate, blasr::Alignment &alignment,
              AlignmentType alignType = Global, bool detailedAlignment = true,
              bool extendFrontByLocalAlignment = true, DNALength noRecurseUnder = 10000,
-             bool fastSDP = true, unsigned int minFragmentsToUseGraphPaper = 100000);
+             bool fastSDP = true, unsigned int minFragmentsToUseGraphPaper = 10000,
+             WorkerPool *refinePool = NULL);
 
 template <typename T_QuerySequence, typename T_TargetSequence, typename T_ScoreFn,
           typename T_BufferCache>
@@ -26,8 +34,12 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
              T_BufferCache &buffers, AlignmentType alignType = Global,
              bool detailedAlignment = true, bool extendFrontByLocalAlignment = true,
              DNALength noRecurseUnder = 10000, bool fastSDP = true,
-             unsigned int minFragmentsToUseGraphPaper = 100000);
+             unsigned int minFragmentsToUseGraphPaper = 10000, WorkerPool *refinePool = NULL);
 
+//
+// T_TupleList holds the tuples of the target: a TuplePositionIndex, or a
+// TupleList<PositionDNATuple> which is sorted and binary searched.
+//
 template <typename T_QuerySequence, typename T_TargetSequence, typename T_ScoreFn,
           typename T_TupleList>
 int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreFn, int wordSize,
@@ -39,7 +51,8 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
              // A few optinal parameters, should delete that last one.
              AlignmentType alignType = Global, bool detailedAlignment = true,
              bool extendFrontByLocalAlignment = true, DNALength noRecurseUnder = 10000,
-             bool fastSDP = true, unsigned int minFragmentsToUseGraphPaper = 100000);
+             bool fastSDP = true, unsigned int minFragmentsToUseGraphPaper = 10000,
+             WorkerPool *refinePool = NULL);
 
 #include "SDPAlignImpl.hpp"
 
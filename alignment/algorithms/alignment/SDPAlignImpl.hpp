@@ -1,6 +1,7 @@
 #ifndef _BLASR_SDP_ALIGN_IMPL_HPP_
 #define _BLASR_SDP_ALIGN_IMPL_HPP_
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
@@ -21,11 +22,76 @@
 #include <pbdata/matrix/FlatMatrix.hpp>
 #include <pbdata/utils.hpp>
 
+//
+// Buffers for aligning the gap between two blocks of a chain, one set
+// per thread.
+//
+template <typename T_TupleList>
+class SDPAlignGapBuffers
+{
+public:
+    std::vector<Fragment> fragmentSet, prefixFragmentSet, suffixFragmentSet;
+    T_TupleList targetTupleList, targetPrefixTupleList, targetSuffixTupleList;
+    std::vector<int> scoreMat;
+    std::vector<Arrow> pathMat;
+};
+
+//
+// Align the query and target between the end of block and the start
+// of nextBlock, by Smith-Waterman if the gap is small, or else by a
+// recursive SDP alignment.  The blocks of gapAlignment are in the
+// coordinates of query and target.
+//
+template <typename T_QuerySequence, typename T_TargetSequence, typename T_ScoreFn,
+          typename T_TupleList>
+void SDPAlignGap(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreFn, int wordSize,
+                 int sdpIns, int sdpDel, float indelRate, const Block &block,
+                 const Block &nextBlock, std::vector<Fragment> &fragmentSet,
+                 std::vector<Fragment> &prefixFragmentSet, std::vector<Fragment> &suffixFragmentSet,
+                 T_TupleList &targetTupleList, T_TupleList &targetPrefixTupleList,
+                 T_TupleList &targetSuffixTupleList, std::vector<int> &scoreMat,
+                 std::vector<Arrow> &pathMat, AlignmentType alignType, DNALength noRecurseUnder,
+                 blasr::Alignment &gapAlignment)
+{
+    T_QuerySequence qFragment;
+    T_TargetSequence tFragment;
+    gapAlignment.Clear();
+    qFragment.ReferenceSubstring(query, block.qPos + block.length);
+    qFragment.length = nextBlock.qPos - (block.qPos + block.length);
+
+    tFragment.seq = &(target.seq[block.tPos + block.length]);
+    tFragment.length = (nextBlock.tPos - (block.tPos + block.length));
+
+    if (qFragment.length > 0 and tFragment.length > 0) {
+
+        if (noRecurseUnder == 0 or qFragment.length * tFragment.length < noRecurseUnder) {
+            SWAlign(qFragment, tFragment, scoreMat, pathMat, gapAlignment, scoreFn, Global);
+        } else {
+            std::vector<int> recurseFragmentChain;
+            SDPAlign(qFragment, tFragment, scoreFn, std::max(wordSize / 2, 5), sdpIns, sdpDel,
+                     indelRate, gapAlignment, fragmentSet, prefixFragmentSet, suffixFragmentSet,
+                     targetTupleList, targetPrefixTupleList, targetSuffixTupleList,
+                     recurseFragmentChain, alignType, true, 0, 0);
+        }
+        gapAlignment.qPos = 0;
+        gapAlignment.tPos = 0;
+
+        int qOffset = block.qPos + block.length;
+        int tOffset = block.tPos + block.length;
+
+        for (size_t fb = 0; fb < gapAlignment.blocks.size(); fb++) {
+            gapAlignment.blocks[fb].qPos += qOffset;
+            gapAlignment.blocks[fb].tPos += tOffset;
+        }
+    }
+}
+
 template <typename T_QuerySequence, typename T_TargetSequence, typename T_ScoreFn>
 int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreFn, int wordSize,
              int sdpIns, int sdpDel, float indelRate, blasr::Alignment &alignment,
              AlignmentType alignType, bool detailedAlignment, bool extendFrontByLocalAlignment,
-             DNALength noRecurseUnder, bool fastSDP, unsigned int minFragmentsToUseGraphPaper)
+             DNALength noRecurseUnder, bool fastSDP, unsigned int minFragmentsToUseGraphPaper,
+             WorkerPool *refinePool)
 {
     /*
        Since SDP Align uses a large list of buffers, but none are
@@ -33,16 +99,16 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
        buffers on the stack.
        */
     std::vector<Fragment> fragmentSet, prefixFragmentSet, suffixFragmentSet;
-    TupleList<PositionDNATuple> targetTupleList;
-    TupleList<PositionDNATuple> targetPrefixTupleList;
-    TupleList<PositionDNATuple> targetSuffixTupleList;
+    TuplePositionIndex targetTupleList;
+    TuplePositionIndex targetPrefixTupleList;
+    TuplePositionIndex targetSuffixTupleList;
     std::vector<int> maxFragmentChain;
 
     return SDPAlign(query, target, scoreFn, wordSize, sdpIns, sdpDel, indelRate, alignment,
                     fragmentSet, prefixFragmentSet, suffixFragmentSet, targetTupleList,
                     targetPrefixTupleList, targetSuffixTupleList, maxFragmentChain, alignType,
                     detailedAlignment, extendFrontByLocalAlignment, noRecurseUnder, fastSDP,
-                    minFragmentsToUseGraphPaper);
+                    minFragmentsToUseGraphPaper, refinePool);
 }
 
 template <typename T_QuerySequence, typename T_TargetSequence, typename T_ScoreFn,
@@ -51,7 +117,7 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
              int sdpIns, int sdpDel, float indelRate, blasr::Alignment &alignment,
              T_BufferCache &buffers, AlignmentType alignType, bool detailedAlignment,
              bool extendFrontByLocalAlignment, DNALength noRecurseUnder, bool fastSDP,
-             unsigned int minFragmentsToUseGraphPaper)
+             unsigned int minFragmentsToUseGraphPaper, WorkerPool *refinePool)
 {
 
     return SDPAlign(query, target, scoreFn, wordSize, sdpIns, sdpDel, indelRate, alignment,
@@ -60,7 +126,7 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
                     buffers.sdpCachedTargetPrefixTupleList, buffers.sdpCachedTargetSuffixTupleList,
                     buffers.sdpCachedMaxFragmentChain, alignType, detailedAlignment,
                     extendFrontByLocalAlignment, noRecurseUnder, fastSDP,
-                    minFragmentsToUseGraphPaper);
+                    minFragmentsToUseGraphPaper, refinePool);
 }
 
 template <typename T_QuerySequence, typename T_TargetSequence, typename T_ScoreFn,
@@ -73,7 +139,8 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
              std::vector<int> &maxFragmentChain,
              // A few optinal parameters, should delete that last one.
              AlignmentType alignType, bool detailedAlignment, bool extendFrontByLocalAlignment,
-             DNALength noRecurseUnder, bool fastSDP, unsigned int minFragmentsToUseGraphPaper)
+             DNALength noRecurseUnder, bool fastSDP, unsigned int minFragmentsToUseGraphPaper,
+             WorkerPool *refinePool)
 {
     // minFragmentsToUseGraphPaper: minimum number of fragments to
     // use Graph Paper for speed up.
@@ -198,26 +265,18 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
     fragmentSet.insert(fragmentSet.begin(), prefixFragmentSet.begin(), prefixFragmentSet.end());
     fragmentSet.insert(fragmentSet.end(), suffixFragmentSet.begin(), suffixFragmentSet.end());
 
-    FlatMatrix2D<int> graphScoreMat;
-    FlatMatrix2D<Arrow> graphPathMat;
-    FlatMatrix2D<int> graphBins;
     if (fragmentSet.size() > minFragmentsToUseGraphPaper and fastSDP) {
-        int nCol = 50;
         std::vector<bool> onOptPath(fragmentSet.size(), false);
-        GraphPaper<Fragment>(fragmentSet, nCol, nCol, graphBins, graphScoreMat, graphPathMat,
-                             onOptPath);
+        SparseGraphPaper<Fragment>(fragmentSet, onOptPath);
         RemoveOffOpt(fragmentSet, onOptPath);
     }
-    graphScoreMat.Clear();
-    graphPathMat.Clear();
-    graphBins.Clear();
 
     //
     // Because there are fragments from multiple overlapping regions, remove
     // any fragments that have the same starting coordinate as a
     // previous fragment.
     //
-    std::sort(fragmentSet.begin(), fragmentSet.end(), LexicographicFragmentSort<Fragment>());
+    SortFragmentsByXY(fragmentSet);
     f = 0;
     int fCur = 0;
     while (f + 1 <= fragmentSet.size()) {
@@ -432,48 +491,41 @@ int SDPAlign(T_QuerySequence &query, T_TargetSequence &target, T_ScoreFn &scoreF
         //
         // The chain alignment blocks are not complete blocks, so they
         // must be appended to the true alignment and then patched up.
+        // The gaps between blocks are independent, so they may be
+        // refined by several threads and then appended in order.
         //
-        for (b = 0; b < chainAlignment.size() - 1; b++) {
+        unsigned int nGaps = chainAlignment.size() - 1;
+        std::vector<blasr::Alignment> gapAlignments;
+        if (refinePool != NULL and refinePool->NumThreads() > 1 and nGaps > 1 and
+            detailedAlignment == true) {
+            gapAlignments.resize(nGaps);
+            std::vector<SDPAlignGapBuffers<T_TupleList> > threadBuffers(refinePool->NumThreads());
+            refinePool->ParallelFor(nGaps, [&](unsigned int g, unsigned int threadIndex) {
+                SDPAlignGapBuffers<T_TupleList> &buf = threadBuffers[threadIndex];
+                SDPAlignGap(query, target, scoreFn, wordSize, sdpIns, sdpDel, indelRate,
+                            chainAlignment.blocks[g], chainAlignment.blocks[g + 1], buf.fragmentSet,
+                            buf.prefixFragmentSet, buf.suffixFragmentSet, buf.targetTupleList,
+                            buf.targetPrefixTupleList, buf.targetSuffixTupleList, buf.scoreMat,
+                            buf.pathMat, alignType, noRecurseUnder, gapAlignments[g]);
+            });
+        }
+        for (b = 0; b < nGaps; b++) {
             alignment.blocks.push_back(chainAlignment.blocks[b]);
 
             //
             // Do a detaied smith-waterman alignment between blocks, if this
             // is specified.
-            fragAlignment.Clear();
-            qFragment.Free();
-            qFragment.ReferenceSubstring(
-                query, chainAlignment.blocks[b].qPos + chainAlignment.blocks[b].length);
-            qFragment.length = chainAlignment.blocks[b + 1].qPos -
-                               (chainAlignment.blocks[b].qPos + chainAlignment.blocks[b].length);
-
-            tFragment.seq =
-                &(target.seq[chainAlignment.blocks[b].tPos + chainAlignment.blocks[b].length]);
-            tFragment.length = (chainAlignment.blocks[b + 1].tPos -
-                                (chainAlignment.blocks[b].tPos + chainAlignment.blocks[b].length));
-
-            if (qFragment.length > 0 and tFragment.length > 0 and detailedAlignment == true) {
-
-                if (noRecurseUnder == 0 or qFragment.length * tFragment.length < noRecurseUnder) {
-                    SWAlign(qFragment, tFragment, fragScoreMat, fragPathMat, fragAlignment, scoreFn,
-                            Global);
+            if (detailedAlignment == true) {
+                if (gapAlignments.empty()) {
+                    SDPAlignGap(query, target, scoreFn, wordSize, sdpIns, sdpDel, indelRate,
+                                chainAlignment.blocks[b], chainAlignment.blocks[b + 1], fragmentSet,
+                                prefixFragmentSet, suffixFragmentSet, targetTupleList,
+                                targetPrefixTupleList, targetSuffixTupleList, fragScoreMat,
+                                fragPathMat, alignType, noRecurseUnder, fragAlignment);
                 } else {
-                    //          std::cout << "running recursive sdp alignment on " << qFragment.length * tFragment.length << std::endl;
-                    std::vector<int> recurseFragmentChain;
-                    SDPAlign(qFragment, tFragment, scoreFn, std::max(wordSize / 2, 5), sdpIns,
-                             sdpDel, indelRate, fragAlignment, fragmentSet, prefixFragmentSet,
-                             suffixFragmentSet, targetTupleList, targetPrefixTupleList,
-                             targetSuffixTupleList, recurseFragmentChain, alignType,
-                             detailedAlignment, 0, 0);
+                    fragAlignment.blocks.swap(gapAlignments[b].blocks);
                 }
-                fragAlignment.qPos = 0;
-                fragAlignment.tPos = 0;
-
-                int qOffset = chainAlignment.blocks[b].qPos + chainAlignment.blocks[b].length;
-                int tOffset = chainAlignment.blocks[b].tPos + chainAlignment.blocks[b].length;
-
                 for (fb = 0; fb < fragAlignment.blocks.size(); fb++) {
-                    fragAlignment.blocks[fb].qPos += qOffset;
-                    fragAlignment.blocks[fb].tPos += tOffset;
                     alignment.blocks.push_back(fragAlignment.blocks[fb]);
                 }
             }
@@ -1,6 +1,9 @@
 #ifndef _BLASR_FRAGMENT_SORT_HPP_
 #define _BLASR_FRAGMENT_SORT_HPP_
 
+#include <cstdint>
+#include <vector>
+
 template <typename T_Fragment>
 class LexicographicFragmentSort
 {
@@ -15,6 +18,21 @@ public:
     int operator()(const T_Fragment &a, const T_Fragment &b) const;
 };
 
+//
+// Sort fragments in the order of LexicographicFragmentSort (x, y, then
+// length) by radix sorting packed coordinates.  Fragments that compare
+// equal keep their order.
+//
+template <typename T_Fragment>
+void SortFragmentsByXY(std::vector<T_Fragment> &fragments);
+
+//
+// Sort fragments in the order of LexicographicFragmentSortByY, and set
+// order[i] to the index before sorting of fragments[i].
+//
+template <typename T_Fragment>
+void SortFragmentsByYX(std::vector<T_Fragment> &fragments, std::vector<uint32_t> &order);
+
 #include "FragmentSortImpl.hpp"
 
 #endif  // _BLASR_FRAGMENT_SORT_HPP_
@@ -1,5 +1,7 @@
 #include <alignment/algorithms/alignment/sdp/FragmentSort.hpp>
 
+#include <alignment/algorithms/sorting/RadixSort.hpp>
+
 template <typename T_Fragment>
 int LexicographicFragmentSort<T_Fragment>::operator()(const T_Fragment &a,
                                                       const T_Fragment &b) const
@@ -13,3 +15,60 @@ int LexicographicFragmentSortByY<T_Fragment>::operator()(const T_Fragment &a,
 {
     return a.LessThanYX(b);
 }
+
+template <typename T_Fragment>
+void RadixSortFragments(std::vector<T_Fragment> &fragments, bool byY, std::vector<uint32_t> &order)
+{
+    static thread_local RadixSort sorter;
+    static thread_local std::vector<uint64_t> keys;
+    static thread_local std::vector<uint32_t> lengthOrder;
+    static thread_local std::vector<T_Fragment> buffer;
+
+    size_t nFragments = fragments.size();
+    keys.resize(nFragments);
+    //
+    // Length is the last tie breaker, so when fragments differ in length
+    // sort by it first, and then stably by the packed coordinates.
+    //
+    bool sameLength = true;
+    for (size_t i = 1; i < nFragments and sameLength; i++) {
+        sameLength = (fragments[i].length == fragments[0].length);
+    }
+    if (not sameLength) {
+        for (size_t i = 0; i < nFragments; i++) {
+            keys[i] = fragments[i].length;
+        }
+        sorter.SortWithOrder(keys, lengthOrder);
+    }
+    for (size_t i = 0; i < nFragments; i++) {
+        const T_Fragment &f = fragments[sameLength ? i : lengthOrder[i]];
+        keys[i] = byY ? ((static_cast<uint64_t>(f.y) << 32) | f.x)
+                      : ((static_cast<uint64_t>(f.x) << 32) | f.y);
+    }
+    sorter.SortWithOrder(keys, order);
+    if (not sameLength) {
+        for (size_t i = 0; i < nFragments; i++) {
+            order[i] = lengthOrder[order[i]];
+        }
+    }
+    PermuteByOrder(fragments, order, buffer);
+
+    sorter.ReleaseLargeBuffers();
+    ReleaseLargeBuffer(keys);
+    ReleaseLargeBuffer(lengthOrder);
+    ReleaseLargeBuffer(buffer);
+}
+
+template <typename T_Fragment>
+void SortFragmentsByXY(std::vector<T_Fragment> &fragments)
+{
+    static thread_local std::vector<uint32_t> order;
+    RadixSortFragments(fragments, false, order);
+    ReleaseLargeBuffer(order);
+}
+
+template <typename T_Fragment>
+void SortFragmentsByYX(std::vector<T_Fragment> &fragments, std::vector<uint32_t> &order)
+{
+    RadixSortFragments(fragments, true, order);
+}
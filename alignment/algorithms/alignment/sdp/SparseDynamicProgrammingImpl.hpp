@@ -13,12 +13,15 @@
 #include <alignment/algorithms/alignment/sdp/SDPColumn.hpp>
 #include <alignment/algorithms/alignment/sdp/SDPFragment.hpp>
 #include <alignment/algorithms/alignment/sdp/SDPSet.hpp>
+#include <alignment/algorithms/sorting/RadixSort.hpp>
 
 template <typename T_Fragment>
 void StoreAbove(std::vector<T_Fragment> &fragmentSet, DNALength fragmentLength)
 {
     (void)(fragmentLength);
-    std::sort(fragmentSet.begin(), fragmentSet.end(), LexicographicFragmentSortByY<T_Fragment>());
+    static thread_local std::vector<uint32_t> order;
+    static thread_local std::vector<T_Fragment> buffer;
+    SortFragmentsByYX(fragmentSet, order);
     for (size_t i = 1; i < fragmentSet.size(); i++) {
         if (fragmentSet[i - 1].x <= fragmentSet[i].x and
             fragmentSet[i - 1].x + fragmentSet[i - 1].length > fragmentSet[i].x and
@@ -27,7 +30,13 @@ void StoreAbove(std::vector<T_Fragment> &fragmentSet, DNALength fragmentLength)
         }
     }
     // Place back in original order.
-    std::sort(fragmentSet.begin(), fragmentSet.end(), LexicographicFragmentSort<T_Fragment>());
+    buffer.resize(fragmentSet.size());
+    for (size_t i = 0; i < fragmentSet.size(); i++) {
+        buffer[order[i]] = fragmentSet[i];
+    }
+    fragmentSet.swap(buffer);
+    ReleaseLargeBuffer(order);
+    ReleaseLargeBuffer(buffer);
 }
 
 template <typename T_Fragment>
@@ -39,7 +48,7 @@ int SDPLongestCommonSubsequence(DNALength queryLength, std::vector<T_Fragment> &
     maxFragmentChain.clear();
     if (fragmentSet.size() < 1) return 0;
 
-    std::sort(fragmentSet.begin(), fragmentSet.end(), LexicographicFragmentSort<T_Fragment>());
+    SortFragmentsByXY(fragmentSet);
 
     SDPSet<Fragment> sweepSet;
     SDPSet<SDPColumn> colSet;
@@ -1,6 +1,8 @@
 #ifndef _BLASR_BASIC_ENDPOINT_HPP_
 #define _BLASR_BASIC_ENDPOINT_HPP_
 
+#include <cstdint>
+
 #include <pbdata/Types.h>
 #include <alignment/algorithms/anchoring/Coordinate.hpp>
 
@@ -50,6 +52,8 @@ public:
     T_ScoredFragment* SetScoredReference(T_ScoredFragment* _fragmentPtr);
     int operator<(const BasicEndpoint& rhs) const;
     KeyType GetKey();
+    // The coordinate packed into one integer, ordered as LessThan.
+    uint64_t GetCoordinateKey() const;
     T_ScoredFragment* GetFragmentPtr();
     void SetChainPrev(T_ScoredFragment* prevChainFragment);
 };
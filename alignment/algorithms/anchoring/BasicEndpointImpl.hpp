@@ -75,6 +75,12 @@ KeyType BasicEndpoint<T_ScoredFragment>::GetKey()
     return p.GetY();
 }
 
+template <typename T_ScoredFragment>
+uint64_t BasicEndpoint<T_ScoredFragment>::GetCoordinateKey() const
+{
+    return (static_cast<uint64_t>(p.GetX()) << 32) | p.GetY();
+}
+
 template <typename T_ScoredFragment>
 T_ScoredFragment *BasicEndpoint<T_ScoredFragment>::GetFragmentPtr()
 {
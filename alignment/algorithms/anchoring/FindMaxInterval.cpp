@@ -17,6 +17,7 @@ IntervalSearchParameters::IntervalSearchParameters()
     aboveCategoryPValue = 0;
     warp = true;
     fastMaxInterval = false;
+    sparseChain = false;
     aggressiveIntervalCut = false;
     verbosity = 0;
     ddPValueThreshold = -500;
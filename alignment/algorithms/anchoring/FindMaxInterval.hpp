@@ -10,6 +10,7 @@
 #include <alignment/algorithms/anchoring/BasicEndpoint.hpp>
 #include <alignment/algorithms/anchoring/GlobalChain.hpp>
 #include <alignment/algorithms/anchoring/LongestIncreasingSubsequence.hpp>
+#include <alignment/algorithms/anchoring/SparseChain.hpp>
 #include <alignment/datastructures/anchoring/ClusterList.hpp>
 #include <alignment/datastructures/anchoring/MatchPos.hpp>
 #include <alignment/datastructures/anchoring/WeightedInterval.hpp>
@@ -26,6 +27,10 @@ public:
     float aboveCategoryPValue;
     bool warp;
     bool fastMaxInterval;
+    // Chain all anchors in one pass with SparseChain rather than
+    // searching windows of anchors with GlobalChain.
+    bool sparseChain;
+    SparseChainParameters sparseChainParameters;
     bool aggressiveIntervalCut;
     int verbosity;
     float ddPValueThreshold;
@@ -129,5 +134,22 @@ int ExhaustiveFindMaxIncreasingInterval(
     std::vector<BasicEndpoint<ChainedMatchPos> > *chainEndpointBuffer, ClusterList &clusterList,
     VarianceAccumulator<float> &accumPValue, VarianceAccumulator<float> &accumWeight);
 
+//
+// Search for intervals with SparseChain, regardless of
+// params.sparseChain.  Anchors need not be sorted, and pos may also be an
+// AnchorList, since only the position and length of anchors are read.
+//
+template <typename T_MatchList, typename T_PValueFunction, typename T_WeightFunction,
+          typename T_SequenceBoundaryDB, typename T_ReferenceSequence, typename T_Sequence>
+int SparseChainFindMaxIncreasingInterval(int readDir, T_MatchList &pos, DNALength intervalLength,
+                                         VectorIndex nBest, T_SequenceBoundaryDB &ContigStartPos,
+                                         T_PValueFunction &MatchPValueFunction,
+                                         T_WeightFunction &MatchWeightFunction,
+                                         WeightedIntervalSet &intervalQueue,
+                                         T_ReferenceSequence &reference, T_Sequence &query,
+                                         IntervalSearchParameters &params, ClusterList &clusterList,
+                                         VarianceAccumulator<float> &accumPValue,
+                                         VarianceAccumulator<float> &accumWeight);
+
 #include "FindMaxIntervalImpl.hpp"
 #endif
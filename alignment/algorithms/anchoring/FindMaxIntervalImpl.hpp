@@ -409,7 +409,12 @@ int FindMaxIncreasingInterval(
     (void)(accumNumAnchorBases);
 
     int maxLISSize = 0;
-    if (params.fastMaxInterval) {
+    if (params.sparseChain) {
+        maxLISSize = SparseChainFindMaxIncreasingInterval(
+            readDir, pos, intervalLength, nBest, ContigStartPos, MatchPValueFunction,
+            MatchWeightFunction, intervalQueue, reference, query, params, clusterList, accumPValue,
+            accumWeight);
+    } else if (params.fastMaxInterval) {
         maxLISSize = FastFindMaxIncreasingInterval(
             readDir, pos, intervalLength, nBest, ContigStartPos, MatchPValueFunction,
             MatchWeightFunction, intervalQueue, reference, query, params, chainEndpointBuffer,
@@ -906,4 +911,76 @@ int ExhaustiveFindMaxIncreasingInterval(
     return maxLISSize;
 }
 
+template <typename T_MatchList, typename T_PValueFunction, typename T_WeightFunction,
+          typename T_SequenceBoundaryDB, typename T_ReferenceSequence, typename T_Sequence>
+int SparseChainFindMaxIncreasingInterval(
+    // Input
+    // readDir is used to indicate if the interval that is being stored is in the forward
+    // or reverse strand.
+    int readDir, T_MatchList &pos,
+    // The longest gap to chain over.
+    DNALength intervalLength,
+    // How many sets to keep track of
+    VectorIndex nBest,
+    // Do not chain across boundary positions stored in seqBoundaries
+    T_SequenceBoundaryDB &ContigStartPos,
+    // First rand intervals by their p-value
+    T_PValueFunction &MatchPValueFunction,
+    // When ranking intervals, sum over weights determined by MatchWeightFunction
+    T_WeightFunction &MatchWeightFunction,
+    // Output.
+    // The chains, in order by queue weight.
+    WeightedIntervalSet &intervalQueue, T_ReferenceSequence &reference, T_Sequence &query,
+    IntervalSearchParameters &params, ClusterList &clusterList,
+    VarianceAccumulator<float> &accumPValue, VarianceAccumulator<float> &accumWeight)
+{
+    (void)(nBest);
+    (void)(query);
+    (void)(reference);
+
+    //
+    // Rather than search windows of intervalLength anchors for a chain,
+    // chain all anchors at once, chaining over gaps up to intervalLength,
+    // and score each chain as an interval.
+    //
+    SparseChainParameters chainParameters = params.sparseChainParameters;
+    chainParameters.maxGap = intervalLength;
+    std::vector<std::vector<VectorIndex> > chains;
+    int maxLISSize = SparseChain(pos, ContigStartPos, chainParameters, chains);
+
+    std::vector<ChainedMatchPos> lis;
+    int noOvpLisSize = 0;
+    int noOvpLisNBases = 0;
+    for (size_t c = 0; c < chains.size(); c++) {
+        lis.clear();
+        for (size_t i = 0; i < chains[c].size(); i++) {
+            lis.push_back(pos[chains[c][i]]);
+        }
+
+        float lisPValue = MatchPValueFunction.ComputePValue(lis, noOvpLisNBases, noOvpLisSize);
+        MatchWeight lisWeight = MatchWeightFunction(lis);
+        VectorIndex lisEnd = lis.size() - 1;
+
+        accumPValue.Append(lisPValue);
+        accumWeight.Append(lisWeight);
+
+        if (lisPValue < params.maxPValue) {
+            WeightedInterval weightedInterval(lisWeight, noOvpLisSize, noOvpLisNBases, lis[0].t,
+                                              lis[lisEnd].t + lis[lisEnd].GetLength(), readDir,
+                                              lisPValue, lis[0].q,
+                                              lis[lisEnd].q + lis[lisEnd].GetLength(), lis);
+            intervalQueue.insert(weightedInterval);
+            if (weightedInterval.isOverlapping == false) {
+                clusterList.Store((float)noOvpLisNBases, lis[0].t, lis[lisEnd].t, noOvpLisSize);
+            }
+            if (params.verbosity > 1) {
+                std::cout << "Weighted Interval to insert:" << std::endl
+                          << weightedInterval << std::endl;
+                std::cout << "Interval Queue:" << std::endl << intervalQueue << std::endl;
+            }
+        }
+    }
+    return maxLISSize;
+}
+
 #endif
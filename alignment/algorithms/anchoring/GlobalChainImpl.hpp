@@ -5,6 +5,7 @@
 
 #include <pbdata/Types.h>
 #include <alignment/algorithms/anchoring/PrioritySearchTree.hpp>
+#include <alignment/algorithms/sorting/RadixSort.hpp>
 #include <pbdata/DNASequence.hpp>
 
 template <typename T_Fragment, typename T_Endpoint>
@@ -128,7 +129,8 @@ int GlobalChain(T_Fragment *fragments, DNALength nFragments,
     // but not necessarily all of the end endpoints, so
     // the list must be resorted.
     //
-    std::sort(endpointsPtr->begin(), endpointsPtr->end(), typename T_Endpoint::LessThan());
+    RadixSortByKey(*endpointsPtr,
+                   [](const T_Endpoint &endpoint) { return endpoint.GetCoordinateKey(); });
 
     PrioritySearchTree<T_Endpoint> pst;
 
@@ -141,8 +143,7 @@ int GlobalChain(T_Fragment *fragments, DNALength nFragments,
     for (p = 0; p < endpointsPtr->size(); p++) {
         if ((*endpointsPtr)[p].GetSide() == Start) {
             int maxPointIndex;
-            if (pst.FindIndexOfMaxPoint((*endpointsPtr), (*endpointsPtr)[p].GetKey(),
-                                        maxPointIndex)) {
+            if (pst.FindIndexOfMaxPointBelow((*endpointsPtr), p, maxPointIndex)) {
                 (*endpointsPtr)[p].SetChainPrev((*endpointsPtr)[maxPointIndex].GetFragmentPtr());
                 (*endpointsPtr)[p].SetScore((*endpointsPtr)[maxPointIndex].GetScore() +
                                             (*endpointsPtr)[p].GetScore());
@@ -21,6 +21,7 @@ float LISQValueWeightor<T_MatchList, T_Sequence>::operator()(const T_MatchList &
     VectorIndex i;
     totalQ = 0.0;
     nBases = 0;
+    seq->LoadQVs(QualityValueTrack);
     for (i = 0; i < matchList.size(); i++) {
         DNALength mp;
         for (mp = matchList[i].q; mp < matchList[i].q + matchList[i].w; mp++) {
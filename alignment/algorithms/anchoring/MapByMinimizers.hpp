@@ -0,0 +1,34 @@
+#ifndef _BLASR_MAP_BY_MINIMIZERS_HPP_
+#define _BLASR_MAP_BY_MINIMIZERS_HPP_
+
+#include <vector>
+
+#include <alignment/datastructures/anchoring/AnchorParameters.hpp>
+#include <alignment/datastructures/anchoring/MatchPos.hpp>
+#include <alignment/tuples/MinimizerIndex.hpp>
+
+/*
+ * Sparse seeding: anchor the subread of read using only its (w,k)
+ * minimizers, looked up in a MinimizerIndex of reference built with the
+ * same k and w.  A minimizer found at reference position t gives a match
+ * at (t, q), extended forward while the read and reference agree;
+ * later minimizers on the diagonal of an extended match are not
+ * reported again.
+ *
+ * As with suffix array anchoring, minimizers with more than
+ * anchorParameters.maxAnchorsPerPosition positions are skipped, matches
+ * shorter than anchorParameters.minMatchLength are dropped, and the
+ * multiplicity of a match is the number of positions of its minimizer.
+ * Matches are appended in order of read position, ready for
+ * FindMaxIncreasingInterval.
+ *
+ * Only about 2/(w+1) of the read positions are looked up, so this is
+ * much faster than searching every position, at the cost of missing
+ * matches shorter than w + k - 1 bases.
+ */
+template <typename T_RefSequence, typename T_Sequence, typename T_MatchPos>
+int MapReadToGenome(T_RefSequence &reference, const MinimizerIndex &index, T_Sequence &read,
+                    std::vector<T_MatchPos> &matchPosList, AnchorParameters &anchorParameters);
+
+#include "MapByMinimizersImpl.hpp"
+#endif
@@ -0,0 +1,64 @@
+#ifndef _BLASR_MAP_BY_MINIMIZERS_IMPL_HPP_
+#define _BLASR_MAP_BY_MINIMIZERS_IMPL_HPP_
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <alignment/algorithms/anchoring/MapByMinimizers.hpp>
+#include <pbdata/NucConversion.hpp>
+
+template <typename T_RefSequence, typename T_Sequence, typename T_MatchPos>
+int MapReadToGenome(T_RefSequence &reference, const MinimizerIndex &index, T_Sequence &read,
+                    std::vector<T_MatchPos> &matchPosList, AnchorParameters &anchorParameters)
+{
+    DNALength minMatchLen = anchorParameters.minMatchLength;
+    if (read.SubreadLength() < minMatchLen or index.TupleSize() == 0) {
+        matchPosList.clear();
+        return 0;
+    }
+
+    TupleMetrics tm;
+    tm.tupleSize = index.TupleSize();
+    const DNALength subreadStart = read.SubreadStart();
+    const DNALength subreadEnd = read.SubreadEnd();
+
+    //
+    // Read position at which the last match on each diagonal ends.
+    //
+    std::unordered_map<int64_t, DNALength> diagonalEnd;
+
+    ForEachMinimizer(
+        &read.seq[subreadStart], subreadEnd - subreadStart, tm, index.WindowSize(),
+        [&](DNALength pos, TupleData hash) {
+            const DNALength *begin, *end;
+            index.FindAll(hash, begin, end);
+            DNALength nPositions = end - begin;
+            if (nPositions == 0 or nPositions > anchorParameters.maxAnchorsPerPosition) {
+                return;
+            }
+            DNALength queryPos = subreadStart + pos;
+            for (const DNALength *refPosIt = begin; refPosIt != end; ++refPosIt) {
+                DNALength refPos = *refPosIt;
+                int64_t diagonal = static_cast<int64_t>(refPos) - queryPos;
+                auto it = diagonalEnd.find(diagonal);
+                if (it != diagonalEnd.end() and it->second > queryPos) {
+                    continue;
+                }
+                DNALength length = tm.tupleSize;
+                while (queryPos + length < subreadEnd and refPos + length < reference.length and
+                       IsACTG[read.seq[queryPos + length]] and
+                       reference.seq[refPos + length] == read.seq[queryPos + length]) {
+                    length++;
+                }
+                diagonalEnd[diagonal] = queryPos + length;
+                if (length < minMatchLen) {
+                    continue;
+                }
+                matchPosList.push_back(ChainedMatchPos(refPos, queryPos, length, nPositions));
+            }
+        });
+
+    return matchPosList.size();
+}
+
+#endif
@@ -5,9 +5,11 @@
 
 #include <alignment/algorithms/alignment/SWAlign.hpp>
 #include <alignment/algorithms/alignment/ScoreMatrices.hpp>
+#include <alignment/datastructures/anchoring/AnchorList.hpp>
 #include <alignment/datastructures/anchoring/AnchorParameters.hpp>
 #include <alignment/datastructures/anchoring/MatchPos.hpp>
 #include <alignment/suffixarray/SuffixArray.hpp>
+#include <alignment/tuples/TupleFrequencyTable.hpp>
 
 /*
  * Parameters:
@@ -35,5 +37,16 @@ int MapReadToGenome(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &rea
                     unsigned int minPrefixMatchLength, std::vector<T_MatchPos> &matchPosList,
                     AnchorParameters &anchorParameters);
 
+//
+// The same, storing the anchors in parallel arrays.  They may be chained
+// as they are by SparseChainFindMaxIncreasingInterval, or sorted by
+// (t, q) with AnchorList::SortByTargetAndQuery for other interval
+// searches.
+//
+template <typename T_SuffixArray, typename T_RefSequence, typename T_Sequence>
+int MapReadToGenome(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &read,
+                    unsigned int minPrefixMatchLength, AnchorList &anchors,
+                    AnchorParameters &anchorParameters);
+
 #include "MapBySuffixArrayImpl.hpp"
 #endif
@@ -48,7 +48,22 @@ int LocateAnchorBoundsInSuffixArray(T_RefSequence &reference, T_SuffixArray &sa,
     std::fill(matchHigh.begin(), matchHigh.end(), 0);
     std::vector<SAIndex> lowMatchBound, highMatchBound;
 
+    //
+    // Look up how often the tuple at each position occurs in the
+    // reference, so that seeds in high-copy repeats, whose matches would
+    // mostly be dropped by maxAnchorsPerPosition, are not searched.
+    //
+    std::vector<uint8_t> seedCounts;
+    if (params.tupleFrequencies != NULL and params.maxSeedFrequency > 0) {
+        params.tupleFrequencies->CountTuples(&read.seq[read.SubreadStart()], read.SubreadLength(),
+                                             seedCounts);
+    }
+
     for (m = 0, p = read.SubreadStart(); p < matchEnd; p++, m++) {
+        if (not seedCounts.empty() and seedCounts[m] > params.maxSeedFrequency and
+            (params.repeatSeedStride <= 0 or m % params.repeatSeedStride != 0)) {
+            continue;
+        }
         lowMatchBound.clear();
         highMatchBound.clear();
         DNALength lcpLength =
@@ -193,10 +208,23 @@ int LocateAnchorBoundsInSuffixArray(T_RefSequence &reference, T_SuffixArray &sa,
     return 1;
 }
 
-template <typename T_SuffixArray, typename T_RefSequence, typename T_Sequence, typename T_MatchPos>
-int MapReadToGenome(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &read,
-                    unsigned int minPrefixMatchLength, std::vector<T_MatchPos> &matchPosList,
-                    AnchorParameters &anchorParameters)
+template <typename T_MatchPos>
+inline void StoreAnchor(std::vector<T_MatchPos> &matchPosList, DNALength t, DNALength q,
+                        DNALength l, int m)
+{
+    matchPosList.push_back(ChainedMatchPos(t, q, l, m));
+}
+
+inline void StoreAnchor(AnchorList &anchors, DNALength t, DNALength q, DNALength l, int m)
+{
+    anchors.push_back(t, q, l, m);
+}
+
+template <typename T_SuffixArray, typename T_RefSequence, typename T_Sequence,
+          typename T_MatchPosList>
+int StoreReadAnchors(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &read,
+                     unsigned int minPrefixMatchLength, T_MatchPosList &matchPosList,
+                     AnchorParameters &anchorParameters)
 {
 
     std::vector<DNALength> matchLow, matchHigh, matchLength;
@@ -277,9 +305,8 @@ int MapReadToGenome(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &rea
                 }
                 assert(sa.index[mp] + matchLength[matchIndex] <= reference.length);
 
-                matchPosList.push_back(
-                    ChainedMatchPos(sa.index[mp], pos, matchLength[matchIndex],
-                                    matchHigh[matchIndex] - matchLow[matchIndex]));
+                StoreAnchor(matchPosList, sa.index[mp], pos, matchLength[matchIndex],
+                            matchHigh[matchIndex] - matchLow[matchIndex]);
             }
         }
     }
@@ -287,4 +314,21 @@ int MapReadToGenome(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &rea
     return matchPosList.size();
 }
 
+template <typename T_SuffixArray, typename T_RefSequence, typename T_Sequence, typename T_MatchPos>
+int MapReadToGenome(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &read,
+                    unsigned int minPrefixMatchLength, std::vector<T_MatchPos> &matchPosList,
+                    AnchorParameters &anchorParameters)
+{
+    return StoreReadAnchors(reference, sa, read, minPrefixMatchLength, matchPosList,
+                            anchorParameters);
+}
+
+template <typename T_SuffixArray, typename T_RefSequence, typename T_Sequence>
+int MapReadToGenome(T_RefSequence &reference, T_SuffixArray &sa, T_Sequence &read,
+                    unsigned int minPrefixMatchLength, AnchorList &anchors,
+                    AnchorParameters &anchorParameters)
+{
+    return StoreReadAnchors(reference, sa, read, minPrefixMatchLength, anchors, anchorParameters);
+}
+
 #endif
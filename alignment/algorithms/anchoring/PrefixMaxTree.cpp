@@ -0,0 +1,43 @@
+#include <alignment/algorithms/anchoring/PrefixMaxTree.hpp>
+
+#include <limits>
+
+const VectorIndex PrefixMaxTree::NoIndex = std::numeric_limits<VectorIndex>::max();
+
+void PrefixMaxTree::Reset(size_t n)
+{
+    values_.assign(n, -std::numeric_limits<double>::infinity());
+    indices_.assign(n, NoIndex);
+}
+
+namespace {
+// Order values by value, then by index.
+bool IsGreater(double value, VectorIndex index, double otherValue, VectorIndex otherIndex)
+{
+    return value > otherValue or (value == otherValue and index > otherIndex);
+}
+}  // namespace
+
+void PrefixMaxTree::Update(size_t pos, double value, VectorIndex index)
+{
+    for (size_t i = pos + 1; i <= values_.size(); i += i & (~i + 1)) {
+        if (indices_[i - 1] == NoIndex or
+            IsGreater(value, index, values_[i - 1], indices_[i - 1])) {
+            values_[i - 1] = value;
+            indices_[i - 1] = index;
+        }
+    }
+}
+
+bool PrefixMaxTree::Query(size_t end, double &value, VectorIndex &index) const
+{
+    index = NoIndex;
+    for (size_t i = end; i > 0; i -= i & (~i + 1)) {
+        if (indices_[i - 1] != NoIndex and
+            (index == NoIndex or IsGreater(values_[i - 1], indices_[i - 1], value, index))) {
+            value = values_[i - 1];
+            index = indices_[i - 1];
+        }
+    }
+    return index != NoIndex;
+}
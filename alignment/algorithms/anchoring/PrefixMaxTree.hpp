@@ -0,0 +1,36 @@
+#ifndef _BLASR_PREFIX_MAX_TREE_HPP_
+#define _BLASR_PREFIX_MAX_TREE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include <pbdata/Types.h>
+
+//
+// Maximum over a prefix of n values, with values that only increase
+// (a Fenwick tree).  Each value carries the index of the item it came
+// from, and of equal values the one with the greater index is the
+// maximum.  Update and Query are O(log n), and Reset does not allocate
+// once the tree has held n values.
+//
+class PrefixMaxTree
+{
+public:
+    static const VectorIndex NoIndex;
+
+    // Hold n values, none of them set.
+    void Reset(size_t n);
+
+    // Raise the value at pos to value, from item index.
+    void Update(size_t pos, double value, VectorIndex index);
+
+    // Set value and index to the maximum of the values at [0, end).
+    // Returns false if none of them is set.
+    bool Query(size_t end, double &value, VectorIndex &index) const;
+
+private:
+    std::vector<double> values_;
+    std::vector<VectorIndex> indices_;
+};
+
+#endif
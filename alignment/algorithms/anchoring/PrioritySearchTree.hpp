@@ -1,67 +1,90 @@
 #ifndef _BLASR_PRIORITY_SEARCH_TREE_HPP_
 #define _BLASR_PRIORITY_SEARCH_TREE_HPP_
 
+#include <cstdint>
 #include <vector>
 
 #include <alignment/algorithms/anchoring/BasicEndpoint.hpp>
+#include <alignment/algorithms/anchoring/PrefixMaxTree.hpp>
+#include <alignment/algorithms/sorting/RadixSort.hpp>
 
 /*
  * Define a priority search tree on a point that implements
  * the following interface:
  *
- * int T_point::GetIndex()
- *    - Return the index of the point in a list of points.
- * int T_point::GetKey()
- *    - Return the key value that the points are sorted by (x-value in a 2D query)
- * int T_point::GetValue()
- *    - Return the value of a point.
- * int T_point::SetValue(int value)
- *    - sets the value of a point.
+ * KeyType T_point::GetKey()
+ *    - Return the key value of the point (x-value in a 2D query)
+ * int T_point::GetScore()
+ *    - Return the score of a point.
  *
  * This class implements a query FindMax(key), which returns
- * the index of the point with greatest value of all points with key [0...key).
- *
+ * the index of the activated point with greatest score of all points
+ * with key [0...key).
  *
+ * Points are ranked by key when the tree is created, so they need not
+ * be sorted by key; GlobalChain passes them in coordinate order.  The
+ * sorted keys are kept in Eytzinger (breadth first) order to find where
+ * a key falls, and the best active point of each prefix of ranks is
+ * kept in a PrefixMaxTree.  Activate and FindIndexOfMaxPoint are
+ * O(log n), and the score of a point is read when it is activated.
+ * The arrays are kept between calls to CreateTree, so a tree that is
+ * reused does not allocate once it has grown.
  */
-template <typename T_Point>
-class PSTVertex
-{
-public:
-    unsigned int leftChildIndex;
-    unsigned int rightChildIndex;
-    unsigned int isALeaf;
-    KeyType medianKey;
-    KeyType maxKey;
-    unsigned int pointIndex;
-    int maxScoreNode;
-    PSTVertex();
-};
-
 template <typename T_Point>
 class PrioritySearchTree
 {
 private:
-    std::vector<PSTVertex<T_Point> > tree;
-    std::vector<PSTVertex<T_Point> > *treePtr;
-    int GetMedianIndex(int start, int end);
+    struct EytzingerKey
+    {
+        KeyType key;
+        unsigned int rank;
+    };
+    struct PointRank
+    {
+        // Rank of the point, and the number of points with a lesser key.
+        unsigned int rank;
+        unsigned int keyRank;
+    };
+    // Sorted keys in Eytzinger order in eytzingerKeys[1...n].
+    std::vector<EytzingerKey> eytzingerKeys;
+    std::vector<PointRank> pointRanks;
+    // Points in order of key.
+    std::vector<int> pointsByKey;
+    // Best active point by rank.
+    PrefixMaxTree maxPoints;
+    std::vector<uint64_t> sortBuffer;
+    RadixSort sorter;
 
-    inline KeyType CreateTree(std::vector<T_Point> &points, int start, int end,
-                              unsigned int &iterativeIndex);
+    // Number of keys less than key.
+    unsigned int CountKeysBelow(KeyType key) const;
 
-    int FindIndexOfMaxPoint(int curVertexIndex, std::vector<T_Point> &points, KeyType maxKey,
-                            int &maxPointValue, int &maxPointIndex);
+    int FindIndexOfMaxPointInRanks(unsigned int endRank, int &maxPointIndex) const;
 
 public:
     PrioritySearchTree();
 
-    void CreateTree(std::vector<T_Point> &points,
-                    std::vector<PSTVertex<T_Point> > *bufTreePtr = NULL);
+    //
+    // Index the keys of points, none of them active.  The points need not
+    // be sorted by key.
+    //
+    void CreateTree(std::vector<T_Point> &points);
 
-    int FindPoint(KeyType pointKey, int curVertexIndex, int &pointVertexIndex);
+    // Return 1 and set pointIndex to a point with key pointKey, or 0 if
+    // no point has that key.
+    int FindPoint(std::vector<T_Point> &points, KeyType pointKey, int &pointIndex);
 
+    // Make points[pointIndex], with its current score, visible to
+    // queries.
     void Activate(std::vector<T_Point> &points, int pointIndex);
 
+    // Return 1 and set maxPointIndex to the active point with key less
+    // than maxPointKey and the greatest score, the later point on ties,
+    // or 0 if there is none.
     int FindIndexOfMaxPoint(std::vector<T_Point> &points, KeyType maxPointKey, int &maxPointIndex);
+
+    // The same, for a maxPointKey that is the key of points[pointIndex],
+    // without searching for the key.
+    int FindIndexOfMaxPointBelow(std::vector<T_Point> &points, int pointIndex, int &maxPointIndex);
 };
 
 #include "PrioritySearchTreeImpl.hpp"
@@ -1,278 +1,136 @@
 #ifndef _BLASR_PRIORITY_SEARCH_TREE_IMPL_HPP_
 #define _BLASR_PRIORITY_SEARCH_TREE_IMPL_HPP_
 
-/*
- * Define a priority search tree on a point that implements
- * the following interface:
- *
- * int T_point::GetIndex()
- *    - Return the index of the point in a list of points.
- * int T_point::GetKey()
- *    - Return the key value that the points are sorted by (x-value in a 2D query)
- * int T_point::GetValue()
- *    - Return the value of a point.
- * int T_point::SetValue(int value)
- *    - sets the value of a point.
- *
- * This class implements a query FindMax(key), which returns
- * the index of the point with greatest value of all points with key [0...key).
- *
- *
- */
-template <typename T_Point>
-PSTVertex<T_Point>::PSTVertex()
-{
-    isALeaf = 0;
-    leftChildIndex = 0;
-    rightChildIndex = 0;
-    maxScoreNode = -1;
-    maxKey = 0;
-    medianKey = 0;
-    pointIndex = 0;
-}
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 
 template <typename T_Point>
 PrioritySearchTree<T_Point>::PrioritySearchTree()
 {
-    treePtr = NULL;
-}
-
-template <typename T_Point>
-int PrioritySearchTree<T_Point>::GetMedianIndex(int start, int end)
-{
-    return (end + start) / 2;
 }
 
 template <typename T_Point>
-inline KeyType PrioritySearchTree<T_Point>::CreateTree(std::vector<T_Point> &points, int start,
-                                                       int end, unsigned int &iterativeIndex)
+void PrioritySearchTree<T_Point>::CreateTree(std::vector<T_Point> &points)
 {
-    assert(iterativeIndex < (*treePtr).size());
-
     //
-    // Look to see if this vertex is the parent of a leaf
-    // -- when there are only two points below.
+    // Sort by key, then index, as single integers.
     //
-    int medianIndex = GetMedianIndex(start, end);
-    int curVertexIndex = iterativeIndex;
-    (*treePtr)[curVertexIndex].medianKey = points[medianIndex].GetKey();
-
-    if (end == start) {
-        // No children for this node, done.
-        (*treePtr)[curVertexIndex].pointIndex = start;
-        return (*treePtr)[curVertexIndex].medianKey;
+    unsigned int nPoints = points.size();
+    std::vector<uint64_t> &keysAndPoints = sortBuffer;
+    keysAndPoints.resize(nPoints);
+    for (unsigned int i = 0; i < nPoints; i++) {
+        keysAndPoints[i] = (static_cast<uint64_t>(points[i].GetKey()) << 32) | i;
     }
-
-    //
-    // Check to see if the current
-    // node is a leaf node.  No recursion on this node.
-    //
-    if (end - start == 1) {
-        (*treePtr)[curVertexIndex].isALeaf = 1;
-        (*treePtr)[curVertexIndex].medianKey = points[start].GetKey();
-        (*treePtr)[curVertexIndex].pointIndex = start;
-        //
-        // Return the key of this vertex.  The parent
-        // will know what to do with it.  If this is
-        // a left child, the parent will use the key to
-        // distinguish what is on the left side of the branches.
-        // If it is the right side of a (*treePtr), it is ignored.
-        //
-        return (*treePtr)[curVertexIndex].medianKey;
-    } else {
-        //
-        // This vertex contains at least two children, so it is not
-        // a leaf.  Recurse assigning leaves.
-        //
-        (*treePtr)[curVertexIndex].isALeaf = 0;
-        (*treePtr)[curVertexIndex].leftChildIndex = ++iterativeIndex;
-        KeyType leftTreeKey, rightTreeKey;
-        leftTreeKey = CreateTree(points, start, medianIndex, iterativeIndex);
-
-        //
-        // The leftTreeKey separates the branches BELOW this vertex.
-        //
-        (*treePtr)[curVertexIndex].medianKey = leftTreeKey;
-
-        (*treePtr)[curVertexIndex].rightChildIndex = ++iterativeIndex;
-        rightTreeKey = CreateTree(points, medianIndex, end, iterativeIndex);
-        //
-        // The rightTreeKey will separate the parent's left tree from the right.
-        //
-        (*treePtr)[curVertexIndex].maxKey = rightTreeKey;
-        return rightTreeKey;
+    sorter.Sort(keysAndPoints);
+    pointsByKey.resize(nPoints);
+    pointRanks.resize(nPoints);
+    unsigned int keyRank = 0;
+    for (unsigned int r = 0; r < nPoints; r++) {
+        pointsByKey[r] = static_cast<uint32_t>(keysAndPoints[r]);
+        if (r > 0 and (keysAndPoints[r] >> 32) != (keysAndPoints[r - 1] >> 32)) {
+            keyRank = r;
+        }
+        pointRanks[pointsByKey[r]].rank = r;
+        pointRanks[pointsByKey[r]].keyRank = keyRank;
     }
-}
-
-template <typename T_Point>
-int PrioritySearchTree<T_Point>::FindIndexOfMaxPoint(int curVertexIndex,
-                                                     std::vector<T_Point> &points, KeyType maxKey,
-                                                     int &maxPointValue, int &maxPointIndex)
-{
-    //
-    // Attempt to find the leaf vertex beneath this vertex that has
-    // the largest score, with a key less than max key.
-    //
-    // On return:
-    //   Return 1 if a value is assigned to maxPointValue, 0 otherwise.
-    //   If a value is assigned to maxPointValue, this sets:
-    //      maxPointValue is the score of the maximum point.
-    //      maxPointIndex the index of the point in 'points' that has
-    //      the maximum score.
-    //
 
     //
-    // The vertex at curVertexIndex has a max score node beneath it,
-    // if it has been initialized.  If the maxScoreNode has a key less
-    // than the current maxKey, then we know the maximum value is
-    // contained beneath this vertex, AND that its key is within the
-    // range in the rage maximum query.
-    // That means that there is no need to continue the search below here.
+    // Lay the sorted keys out in Eytzinger order by an in order walk of
+    // the implicit tree, where the children of k are 2k and 2k+1.
     //
-    if ((*treePtr)[curVertexIndex].maxScoreNode == -1) {
-        return 0;
+    eytzingerKeys.resize(nPoints + 1);
+    unsigned int k = 1;
+    unsigned int rank = 0;
+    while (2 * k <= nPoints) {
+        k = 2 * k;
     }
-    T_Point thisPoint = points[(*treePtr)[curVertexIndex].maxScoreNode];
-    if (thisPoint.GetKey() < maxKey) {
-        if (thisPoint.GetScore() >= maxPointValue) {
-            maxPointValue = thisPoint.GetScore();
-            maxPointIndex = (*treePtr)[curVertexIndex].maxScoreNode;
-            return 1;
-        } else {
-            return 0;
-        }
-    }
-    //
-    // Otherwise, the maximum scoring node beneath this node has a
-    // key greater than the max key. That means that the search must
-    // continue for the maximum value node with a key less than 'maxKey'.
-    //
-    // The search has two cases:
-    // First, if the median key of this node is greater than the maxKey,
-    // all keys on the right side of the tree are greater than maxKey,
-    // so do not search there.
-    //
-    // If the median key of this node si less than maxKey, there may
-    // be a node on the left or right child of the current node with
-    // a maximum key.  Search both to the left and right.
-    //
-    else {
-        if (!(*treePtr)[curVertexIndex].isALeaf) {
-            if (maxKey <= (*treePtr)[curVertexIndex].medianKey) {
-                return FindIndexOfMaxPoint((*treePtr)[curVertexIndex].leftChildIndex, points,
-                                           maxKey, maxPointValue, maxPointIndex);
-            } else {
-                int foundValueLeft, foundValueRight;
-                foundValueLeft = FindIndexOfMaxPoint((*treePtr)[curVertexIndex].leftChildIndex,
-                                                     points, maxKey, maxPointValue, maxPointIndex);
-
-                foundValueRight = FindIndexOfMaxPoint((*treePtr)[curVertexIndex].rightChildIndex,
-                                                      points, maxKey, maxPointValue, maxPointIndex);
-                return (foundValueLeft or foundValueRight);
+    while (k != 0 and rank < nPoints) {
+        eytzingerKeys[k].key = static_cast<KeyType>(keysAndPoints[rank] >> 32);
+        eytzingerKeys[k].rank = rank;
+        rank++;
+        if (2 * k + 1 <= nPoints) {
+            k = 2 * k + 1;
+            while (2 * k <= nPoints) {
+                k = 2 * k;
             }
         } else {
-            //
-            // The current node is a leaf node, but due to the condition
-            // from before, its key is greater than or equal to the max key,
-            // therefore its score cannot be used for the maximum score.
-            // Returning 0 here signifies that this search-branch did not
-            // turn up any candidates for
-            // the maximum scoring node.
-            return 0;
+            // Climb while k is a right child, then once more.
+            while (k & 1) {
+                k >>= 1;
+            }
+            k >>= 1;
         }
     }
+    assert(rank == nPoints);
+
+    maxPoints.Reset(nPoints);
 }
 
 template <typename T_Point>
-void PrioritySearchTree<T_Point>::CreateTree(std::vector<T_Point> &points,
-                                             std::vector<PSTVertex<T_Point> > *bufTreePtr)
+unsigned int PrioritySearchTree<T_Point>::CountKeysBelow(KeyType key) const
 {
+    unsigned int nPoints = pointsByKey.size();
+    unsigned int k = 1;
+    while (k <= nPoints) {
+        k = 2 * k + (eytzingerKeys[k].key < key);
+    }
     //
-    // Precondition: points is sorted according to key.
-    //
-    //
-    // The tree is a binary tree containing all the points.  The
-    // perfectly balanced tree is of maximum size points.size()-1,
-    // so go ahead and preallocate that now.
+    // The descent went right after each key less than key, and left at
+    // the last key not less than it; undo the trailing right turns.
     //
-    if (bufTreePtr != NULL) {
-        treePtr = bufTreePtr;
-    } else {
-        treePtr = &tree;
+    while (k & 1) {
+        k >>= 1;
     }
-    treePtr->resize((points.size() * 2) - 1);
-    unsigned int curVertexIndex = 0;
-    CreateTree(points, 0, points.size(), curVertexIndex);
+    k >>= 1;
+    return (k == 0) ? nPoints : eytzingerKeys[k].rank;
 }
 
-//
-// Implement the tree as an array of interior nodes.
-// Since there is already space allocated for the
-//
 template <typename T_Point>
-int PrioritySearchTree<T_Point>::FindPoint(KeyType pointKey, int curVertexIndex,
-                                           int &pointVertexIndex)
+int PrioritySearchTree<T_Point>::FindPoint(std::vector<T_Point> &points, KeyType pointKey,
+                                           int &pointIndex)
 {
-
-    if ((*treePtr)[curVertexIndex].isALeaf) {
-        pointVertexIndex = curVertexIndex;
-        return (*treePtr)[curVertexIndex].medianKey == pointKey;
-    } else {
-        if (pointKey <= (*treePtr)[curVertexIndex].medianKey) {
-            return FindPoint(pointKey, (*treePtr)[curVertexIndex].leftChildIndex, pointVertexIndex);
-        } else {
-            return FindPoint(pointKey, (*treePtr)[curVertexIndex].rightChildIndex,
-                             pointVertexIndex);
-        }
+    unsigned int rank = CountKeysBelow(pointKey);
+    if (rank == pointsByKey.size() or points[pointsByKey[rank]].GetKey() != pointKey) {
+        return 0;
     }
+    pointIndex = pointsByKey[rank];
+    return 1;
 }
 
 template <typename T_Point>
 void PrioritySearchTree<T_Point>::Activate(std::vector<T_Point> &points, int pointIndex)
 {
+    maxPoints.Update(pointRanks[pointIndex].rank, points[pointIndex].GetScore(), pointIndex);
+}
 
-    int pointScore = points[pointIndex].GetScore();
-    // Now, update the pMax scores in the (*treePtr).
-
-    int curVertexIndex = 0;
-    KeyType pointKey = points[pointIndex].GetKey();
-    unsigned int itIndex = 0;
-    while (pointIndex != -1 and (*treePtr)[curVertexIndex].isALeaf == 0) {
-        assert(itIndex < (*treePtr).size());
-        int nodeIndex = (*treePtr)[curVertexIndex].maxScoreNode;
-        if (nodeIndex == -1 or points[nodeIndex].GetScore() < pointScore) {
-            (*treePtr)[curVertexIndex].maxScoreNode = pointIndex;
-            pointIndex = nodeIndex;
-        }
-
-        if (pointKey <= (*treePtr)[curVertexIndex].medianKey) {
-            curVertexIndex = (*treePtr)[curVertexIndex].leftChildIndex;
-        } else {
-            curVertexIndex = (*treePtr)[curVertexIndex].rightChildIndex;
-        }
-
-        // Keep track of the number of times this loop is executed... an
-        // infinite loop will bomb.
-        ++itIndex;
+template <typename T_Point>
+int PrioritySearchTree<T_Point>::FindIndexOfMaxPointInRanks(unsigned int endRank,
+                                                            int &maxPointIndex) const
+{
+    double maxScore;
+    VectorIndex index;
+    if (not maxPoints.Query(endRank, maxScore, index)) {
+        return 0;
     }
+    maxPointIndex = index;
+    return 1;
 }
 
 template <typename T_Point>
 int PrioritySearchTree<T_Point>::FindIndexOfMaxPoint(std::vector<T_Point> &points,
                                                      KeyType maxPointKey, int &maxPointIndex)
 {
+    (void)(points);
+    return FindIndexOfMaxPointInRanks(CountKeysBelow(maxPointKey), maxPointIndex);
+}
 
-    // start at the root
-    int curVertexIndex = 0;
-    if ((*treePtr)[curVertexIndex].maxScoreNode == -1) {
-        //
-        // This case can only be hit if none of the points have been
-        // activated.
-        //
-        return 0;
-    }
-    int maxPointValue = 0;
-    return FindIndexOfMaxPoint(0, points, maxPointKey, maxPointValue, maxPointIndex);
+template <typename T_Point>
+int PrioritySearchTree<T_Point>::FindIndexOfMaxPointBelow(std::vector<T_Point> &points,
+                                                          int pointIndex, int &maxPointIndex)
+{
+    (void)(points);
+    return FindIndexOfMaxPointInRanks(pointRanks[pointIndex].keyRank, maxPointIndex);
 }
 
 #endif
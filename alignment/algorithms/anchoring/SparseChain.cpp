@@ -0,0 +1,8 @@
+#include <alignment/algorithms/anchoring/SparseChain.hpp>
+
+SparseChainParameters::SparseChainParameters()
+{
+    gapCost = 0.05;
+    maxGap = 10000;
+    maxLookback = 8;
+}
@@ -0,0 +1,59 @@
+#ifndef _BLASR_SPARSE_CHAIN_HPP_
+#define _BLASR_SPARSE_CHAIN_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include <pbdata/Types.h>
+#include <alignment/algorithms/anchoring/PrefixMaxTree.hpp>
+
+class SparseChainParameters
+{
+public:
+    // Cost per base of the gaps in the reference and the read between
+    // consecutive anchors of a chain.
+    float gapCost;
+    // Anchors with a gap longer than maxGap are not chained.
+    DNALength maxGap;
+    // Number of preceding anchors also tried as the previous anchor of
+    // a chain, in case the concave part of the gap cost or maxGap rules
+    // out the best anchor for the linear part.  Chaining is exact when
+    // all preceding anchors are tried.
+    int maxLookback;
+    SparseChainParameters();
+};
+
+//
+// Chain anchors in one pass, in O(n log n) for n anchors.  Anchors are
+// swept in order of reference position, and the best previous anchor
+// that ends before an anchor starts, in both the reference and the
+// read, is found with a range-max query over read positions.  An anchor
+// scores its length plus the best of 0 and the score of a previous
+// anchor less the gap cost between them,
+//
+//   gapCost * (gapT + gapQ) + log2(1 + |gapT - gapQ|),
+//
+// linear in the gap lengths and concave in the drift from the diagonal.
+// The range-max query finds the best previous anchor for the linear part
+// alone, ignoring maxGap.  That anchor and the maxLookback anchors
+// preceding this one are scored with the full gap cost, and those past
+// maxGap are dropped, so the chain is exact only when the best previous
+// anchor is among them.  Otherwise, e.g. when the range-max anchor is
+// past maxGap and a closer one is not looked back at, a slightly worse
+// chain is found.  Anchors are not chained across contigs.
+//
+// Chains are extracted from the highest scoring anchor down, each anchor
+// being used by one chain, and are stored in chains as indices into pos
+// in increasing order.  Chains are in decreasing order of score, where a
+// chain that stops at an anchor of a better chain scores only the part
+// it adds.
+// Returns the number of anchors in the longest chain.
+//
+template <typename T_MatchList, typename T_SequenceBoundaryDB>
+int SparseChain(T_MatchList &pos, T_SequenceBoundaryDB &contigStartPos,
+                const SparseChainParameters &params,
+                std::vector<std::vector<VectorIndex> > &chains);
+
+#include "SparseChainImpl.hpp"
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef _BLASR_SPARSE_CHAIN_IMPL_HPP_
+#define _BLASR_SPARSE_CHAIN_IMPL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <alignment/algorithms/anchoring/SparseChain.hpp>
+
+template <typename T_MatchList>
+double SparseChainGapCost(T_MatchList &pos, VectorIndex prev, VectorIndex cur, float gapCost)
+{
+    double gapT = static_cast<double>(pos[cur].t) - (pos[prev].t + pos[prev].l);
+    double gapQ = static_cast<double>(pos[cur].q) - (pos[prev].q + pos[prev].l);
+    return gapCost * (gapT + gapQ) + std::log2(1 + std::fabs(gapT - gapQ));
+}
+
+template <typename T_MatchList, typename T_SequenceBoundaryDB>
+int SparseChain(T_MatchList &pos, T_SequenceBoundaryDB &contigStartPos,
+                const SparseChainParameters &params, std::vector<std::vector<VectorIndex> > &chains)
+{
+    chains.clear();
+
+    //
+    // Sweep anchors in order of reference then read position.  Zero
+    // length anchors are not chained.
+    //
+    std::vector<VectorIndex> byStart;
+    for (VectorIndex i = 0; i < pos.size(); i++) {
+        if (pos[i].l > 0) {
+            byStart.push_back(i);
+        }
+    }
+    if (byStart.empty()) {
+        return 0;
+    }
+    std::sort(byStart.begin(), byStart.end(), [&pos](VectorIndex a, VectorIndex b) {
+        return pos[a].t < pos[b].t or (pos[a].t == pos[b].t and pos[a].q < pos[b].q);
+    });
+
+    std::vector<double> score(pos.size(), 0);
+    std::vector<VectorIndex> prev(pos.size(), PrefixMaxTree::NoIndex);
+    std::vector<VectorIndex> byEnd;
+    std::vector<DNALength> qEnds;
+    PrefixMaxTree tree;
+
+    VectorIndex blockStart = 0;
+    while (blockStart < byStart.size()) {
+        //
+        // Chain the anchors of one contig, pos[byStart[blockStart,
+        // blockEnd)].
+        //
+        DNALength contigBoundary = contigStartPos(pos[byStart[blockStart]].t);
+        VectorIndex blockEnd = blockStart + 1;
+        while (blockEnd < byStart.size() and
+               contigStartPos(pos[byStart[blockEnd]].t) == contigBoundary) {
+            blockEnd++;
+        }
+
+        byEnd.assign(byStart.begin() + blockStart, byStart.begin() + blockEnd);
+        std::sort(byEnd.begin(), byEnd.end(), [&pos](VectorIndex a, VectorIndex b) {
+            return pos[a].t + pos[a].l < pos[b].t + pos[b].l;
+        });
+        qEnds.clear();
+        for (VectorIndex i : byEnd) {
+            qEnds.push_back(pos[i].q + pos[i].l);
+        }
+        std::sort(qEnds.begin(), qEnds.end());
+        qEnds.erase(std::unique(qEnds.begin(), qEnds.end()), qEnds.end());
+        tree.Reset(qEnds.size());
+
+        VectorIndex nActive = 0;
+        for (VectorIndex b = blockStart; b < blockEnd; b++) {
+            VectorIndex cur = byStart[b];
+            DNALength t = pos[cur].t, q = pos[cur].q;
+
+            //
+            // Make the anchors that end before this one starts in the
+            // reference visible to the query, keyed by where they end in
+            // the read.  Their score less the linear gap cost to (t, q)
+            // differs from the key by a constant.
+            //
+            while (nActive < byEnd.size() and pos[byEnd[nActive]].t + pos[byEnd[nActive]].l <= t) {
+                VectorIndex i = byEnd[nActive];
+                DNALength qEnd = pos[i].q + pos[i].l;
+                size_t rank = std::lower_bound(qEnds.begin(), qEnds.end(), qEnd) - qEnds.begin();
+                tree.Update(rank, score[i] + params.gapCost * (double(pos[i].t + pos[i].l) + qEnd),
+                            i);
+                nActive++;
+            }
+
+            double bestScore = 0;
+            VectorIndex bestPrev = PrefixMaxTree::NoIndex;
+            auto tryPrev = [&](VectorIndex i) {
+                if (pos[i].t + pos[i].l > t or pos[i].q + pos[i].l > q or
+                    t - (pos[i].t + pos[i].l) > params.maxGap or
+                    q - (pos[i].q + pos[i].l) > params.maxGap) {
+                    return;
+                }
+                double chainScore = score[i] - SparseChainGapCost(pos, i, cur, params.gapCost);
+                if (chainScore > bestScore) {
+                    bestScore = chainScore;
+                    bestPrev = i;
+                }
+            };
+
+            double maxKey;
+            VectorIndex maxIndex;
+            size_t qRankEnd = std::upper_bound(qEnds.begin(), qEnds.end(), q) - qEnds.begin();
+            if (tree.Query(qRankEnd, maxKey, maxIndex)) {
+                tryPrev(maxIndex);
+            }
+            for (VectorIndex lb = b; lb > blockStart and b - lb < VectorIndex(params.maxLookback);
+                 lb--) {
+                tryPrev(byStart[lb - 1]);
+            }
+            score[cur] = pos[cur].l + bestScore;
+            prev[cur] = bestPrev;
+        }
+        blockStart = blockEnd;
+    }
+
+    //
+    // Extract chains from the highest scoring anchor down.  A chain stops
+    // at an anchor already used by a higher scoring chain, and then
+    // scores only what it adds to that chain.
+    //
+    std::vector<VectorIndex> byScore(byStart);
+    std::sort(byScore.begin(), byScore.end(), [&score](VectorIndex a, VectorIndex b) {
+        return score[a] > score[b] or (score[a] == score[b] and a < b);
+    });
+    std::vector<bool> used(pos.size(), false);
+    std::vector<std::pair<double, VectorIndex> > chainScores;
+    std::vector<std::vector<VectorIndex> > extracted;
+    size_t maxChainSize = 0;
+    for (VectorIndex end : byScore) {
+        if (used[end]) {
+            continue;
+        }
+        extracted.push_back(std::vector<VectorIndex>());
+        std::vector<VectorIndex> &chain = extracted.back();
+        VectorIndex i = end;
+        for (; i != PrefixMaxTree::NoIndex and not used[i]; i = prev[i]) {
+            chain.push_back(i);
+            used[i] = true;
+        }
+        std::reverse(chain.begin(), chain.end());
+        double chainScore = score[end] - (i == PrefixMaxTree::NoIndex ? 0 : score[i]);
+        chainScores.push_back(std::make_pair(-chainScore, VectorIndex(chainScores.size())));
+        maxChainSize = std::max(maxChainSize, chain.size());
+    }
+    std::sort(chainScores.begin(), chainScores.end());
+    chains.resize(extracted.size());
+    for (size_t c = 0; c < chainScores.size(); c++) {
+        chains[c].swap(extracted[chainScores[c].second]);
+    }
+    return maxChainSize;
+}
+
+#endif
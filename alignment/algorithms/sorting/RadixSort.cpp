@@ -0,0 +1,97 @@
+#include <alignment/algorithms/sorting/RadixSort.hpp>
+
+#include <algorithm>
+
+const size_t RadixSort::MinRadixSortSize;
+const size_t RadixSort::MaxKeptBufferBytes;
+
+void RadixSort::Sort(std::vector<uint64_t> &keys)
+{
+    if (keys.size() < MinRadixSortSize) {
+        std::sort(keys.begin(), keys.end());
+    } else if (SortBytes(keys, NULL) % 2 == 1) {
+        keys.swap(keyBuffer);
+    }
+}
+
+void RadixSort::SortWithOrder(std::vector<uint64_t> &keys, std::vector<uint32_t> &order)
+{
+    size_t n = keys.size();
+    order.resize(n);
+    if (n < MinRadixSortSize) {
+        keysAndOrder.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            keysAndOrder[i] = std::make_pair(keys[i], static_cast<uint32_t>(i));
+        }
+        std::sort(keysAndOrder.begin(), keysAndOrder.end());
+        for (size_t i = 0; i < n; i++) {
+            keys[i] = keysAndOrder[i].first;
+            order[i] = keysAndOrder[i].second;
+        }
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    if (SortBytes(keys, &order) % 2 == 1) {
+        keys.swap(keyBuffer);
+        order.swap(orderBuffer);
+    }
+}
+
+void RadixSort::ReleaseLargeBuffers()
+{
+    ReleaseLargeBuffer(keyBuffer);
+    ReleaseLargeBuffer(orderBuffer);
+    ReleaseLargeBuffer(keysAndOrder);
+}
+
+int RadixSort::SortBytes(std::vector<uint64_t> &keys, std::vector<uint32_t> *order)
+{
+    const int nBytes = sizeof(uint64_t);
+    size_t n = keys.size();
+    counts.assign(nBytes * 256, 0);
+    for (size_t i = 0; i < n; i++) {
+        for (int b = 0; b < nBytes; b++) {
+            counts[b * 256 + ((keys[i] >> (8 * b)) & 0xff)]++;
+        }
+    }
+    keyBuffer.resize(n);
+    if (order != NULL) {
+        orderBuffer.resize(n);
+    }
+
+    //
+    // Passes alternate between the input and the buffers.
+    //
+    uint64_t *from = keys.data(), *to = keyBuffer.data();
+    uint32_t *orderFrom = NULL, *orderTo = NULL;
+    if (order != NULL) {
+        orderFrom = order->data();
+        orderTo = orderBuffer.data();
+    }
+    int nPasses = 0;
+    for (int b = 0; b < nBytes; b++) {
+        size_t *count = &counts[b * 256];
+        if (count[(from[0] >> (8 * b)) & 0xff] == n) {
+            continue;
+        }
+        size_t offset = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t c = count[d];
+            count[d] = offset;
+            offset += c;
+        }
+        for (size_t i = 0; i < n; i++) {
+            size_t dest = count[(from[i] >> (8 * b)) & 0xff]++;
+            to[dest] = from[i];
+            if (orderFrom != NULL) {
+                orderTo[dest] = orderFrom[i];
+            }
+        }
+        std::swap(from, to);
+        std::swap(orderFrom, orderTo);
+        nPasses++;
+    }
+    return nPasses;
+}
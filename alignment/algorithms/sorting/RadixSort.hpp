@@ -0,0 +1,106 @@
+#ifndef _BLASR_RADIX_SORT_HPP_
+#define _BLASR_RADIX_SORT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*
+ * A least significant digit first radix sort of 64 bit keys, a byte at
+ * a time, for lists of anchors, fragments and endpoints whose order is
+ * given by packing their coordinates into one integer.
+ *
+ * All eight byte histograms are counted in one pass, and a byte that is
+ * the same in every key, such as the high bytes of a read coordinate,
+ * is skipped.  Short lists are sorted by comparison instead.  The
+ * buffers are kept between calls, so a sorter that is reused does not
+ * allocate once it has grown, until ReleaseLargeBuffers is called.
+ */
+class RadixSort
+{
+public:
+    static const size_t MinRadixSortSize = 2048;
+
+    // Buffers larger than this are freed by ReleaseLargeBuffers.
+    static const size_t MaxKeptBufferBytes = 4 << 20;
+
+    // Sort keys in increasing order.
+    void Sort(std::vector<uint64_t> &keys);
+
+    //
+    // Sort keys in increasing order, and set order[i] to the index
+    // before sorting of the key now at i.  Equal keys keep their order.
+    //
+    void SortWithOrder(std::vector<uint64_t> &keys, std::vector<uint32_t> &order);
+
+    //
+    // Free the buffers that hold more than MaxKeptBufferBytes, so that a
+    // sorter kept for the life of a thread does not keep the memory of
+    // the longest list it has sorted.
+    //
+    void ReleaseLargeBuffers();
+
+private:
+    std::vector<uint64_t> keyBuffer;
+    std::vector<uint32_t> orderBuffer;
+    std::vector<size_t> counts;
+    std::vector<std::pair<uint64_t, uint32_t> > keysAndOrder;
+
+    // Return the number of passes made; the result is in keyBuffer and
+    // orderBuffer if it is odd.
+    int SortBytes(std::vector<uint64_t> &keys, std::vector<uint32_t> *order);
+};
+
+//
+// Free buffer if it holds more than RadixSort::MaxKeptBufferBytes.
+//
+template <typename T>
+void ReleaseLargeBuffer(std::vector<T> &buffer)
+{
+    if (buffer.capacity() * sizeof(T) > RadixSort::MaxKeptBufferBytes) {
+        std::vector<T>().swap(buffer);
+    }
+}
+
+//
+// Reorder items so that items[i] is what was items[order[i]].
+//
+template <typename T_Item>
+void PermuteByOrder(std::vector<T_Item> &items, const std::vector<uint32_t> &order,
+                    std::vector<T_Item> &buffer)
+{
+    buffer.resize(items.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        buffer[i] = items[order[i]];
+    }
+    items.swap(buffer);
+}
+
+//
+// Sort items by getKey(item), a uint64_t, keeping the order of items
+// with equal keys.  The buffers are kept by each thread, and are
+// freed after a sort that grows them past RadixSort::MaxKeptBufferBytes.
+//
+template <typename T_Item, typename T_GetKey>
+void RadixSortByKey(std::vector<T_Item> &items, T_GetKey getKey)
+{
+    static thread_local RadixSort sorter;
+    static thread_local std::vector<uint64_t> keys;
+    static thread_local std::vector<uint32_t> order;
+    static thread_local std::vector<T_Item> buffer;
+
+    keys.resize(items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        keys[i] = getKey(items[i]);
+    }
+    sorter.SortWithOrder(keys, order);
+    PermuteByOrder(items, order, buffer);
+
+    sorter.ReleaseLargeBuffers();
+    ReleaseLargeBuffer(keys);
+    ReleaseLargeBuffer(order);
+    ReleaseLargeBuffer(buffer);
+}
+
+#endif  // _BLASR_RADIX_SORT_HPP_
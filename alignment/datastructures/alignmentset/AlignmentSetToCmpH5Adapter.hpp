@@ -4,6 +4,7 @@
 #include <alignment/datastructures/alignment/ByteAlignment.h>
 #include <alignment/algorithms/alignment/DistanceMatrixScoreFunction.hpp>
 #include <alignment/datastructures/alignment/AlignmentCandidate.hpp>
+#include <alignment/utils/WorkerPool.hpp>
 #include <hdf/HDFCmpFile.hpp>
 #include <pbdata/sam/AlignmentSet.hpp>
 #include <pbdata/utils/SMRTReadUtils.hpp>
@@ -32,6 +33,19 @@ public:
     }
 };
 
+// An alignment in the byte and QV encodings of cmp.h5, computed without
+// access to the cmp.h5 file so that alignments may be encoded in parallel.
+class CmpH5EncodedAlignment
+{
+public:
+    std::vector<unsigned char> byteAlignment;
+    // Names and values of the QVs and tags present in the alignment.
+    std::vector<std::string> qvNames;
+    std::vector<std::vector<UChar> > qvs;
+    std::vector<std::string> tagNames;
+    std::vector<std::vector<char> > tags;
+};
+
 // number of zmws per SMRTCell for springfield: 163482
 const unsigned int numZMWsPerMovieSpringField = 163482;
 
@@ -63,12 +77,27 @@ public:
 
     void RemoveGapsAtEndOfAlignment(AlignmentCandidate<> &alignment);
 
+    // Remove end gaps of alignment, compute its statistics, and encode it
+    // for cmp.h5.  Does not use the adapter state, so alignments may be
+    // encoded by several threads.
+    void EncodeAlignmentCandidate(AlignmentCandidate<> &alignment, bool copyQVs,
+                                  CmpH5EncodedAlignment &encoded);
+
+    // Store an alignment encoded by EncodeAlignmentCandidate.
+    void StoreEncodedAlignmentCandidate(AlignmentCandidate<> &alignment,
+                                        CmpH5EncodedAlignment &encoded, int alnSegment,
+                                        T_CmpFile &cmpFile, int moleculeNumber = -1);
+
     void StoreAlignmentCandidate(AlignmentCandidate<> &alignment, int alnSegment,
                                  T_CmpFile &cmpFile, int moleculeNumber = -1, bool copyQVs = false);
 
+    // Store alignments in order.  Given a pool with more than one thread,
+    // the alignments are encoded on the pool before they are stored; the
+    // output is the same.  The pool is owned by the caller so that its
+    // threads are reused across calls.
     void StoreAlignmentCandidateList(std::vector<AlignmentCandidate<> > &alignments,
                                      T_CmpFile &cmpFile, int moleculeNumber = -1,
-                                     bool copyQVs = false);
+                                     bool copyQVs = false, WorkerPool *encodePool = NULL);
 
     void StoreAlignmentCandidate(AlignmentCandidate<> alignment, T_CmpFile &cmpFile)
     {
@@ -1,6 +1,8 @@
 #ifndef _BLASR_ALIGNMENT_SET_TO_CMPH5_ADAPTER_IMPL_HPP_
 #define _BLASR_ALIGNMENT_SET_TO_CMPH5_ADAPTER_IMPL_HPP_
 
+#include <algorithm>
+
 template <typename T_CmpFile>
 unsigned int AlignmentSetToCmpH5Adapter<T_CmpFile>::StoreMovieInfo(std::string movieName,
                                                                    T_CmpFile &cmpFile)
@@ -97,12 +99,71 @@ void AlignmentSetToCmpH5Adapter<T_CmpFile>::RemoveGapsAtEndOfAlignment(
     alignment.tAlignedSeqLength -= numEndDel;
 }
 
+template <typename T_CmpFile>
+void AlignmentSetToCmpH5Adapter<T_CmpFile>::EncodeAlignmentCandidate(
+    AlignmentCandidate<> &alignment, bool copyQVs, CmpH5EncodedAlignment &encoded)
+{
+    RemoveGapsAtEndOfAlignment(alignment);
+
+    /*
+    * Encode the alignment string
+    */
+    encoded.byteAlignment.clear();
+    AlignmentToByteAlignment(alignment, alignment.qAlignedSeq, alignment.tAlignedSeq,
+                             encoded.byteAlignment);
+
+    // Encode QVs for cmp.h5
+    encoded.qvNames.clear();
+    encoded.qvs.clear();
+    encoded.tagNames.clear();
+    encoded.tags.clear();
+    if (copyQVs) {
+        std::vector<std::string> optionalQVs;
+        alignment.CopyQVs(&optionalQVs);
+        for (size_t qv_i = 0; qv_i < optionalQVs.size(); qv_i++) {
+            std::string *qvName = &alignment.optionalQVNames[qv_i];
+            std::string *qvString = &optionalQVs[qv_i];
+
+            // If the qvString is empty, then the alignment is missing the quality
+            // value
+            if (qvString->size() == 0) {
+                continue;
+            }
+
+            if (qvName->compare(qvName->size() - 3, 3, "Tag") == 0) {
+                encoded.tagNames.push_back(*qvName);
+                encoded.tags.push_back(std::vector<char>());
+                QVsToCmpH5QVs(*qvString, encoded.byteAlignment, true, &encoded.tags.back());
+            } else {
+                encoded.qvNames.push_back(*qvName);
+                encoded.qvs.push_back(std::vector<UChar>());
+                QVsToCmpH5QVs(*qvString, encoded.byteAlignment, false, &encoded.qvs.back());
+            }
+        }
+    }
+
+    DistanceMatrixScoreFunction<DNASequence, DNASequence> distScoreFn;
+    //distScoreFn does not matter since the score is not stored.
+    ComputeAlignmentStats(alignment, alignment.qAlignedSeq.seq, alignment.tAlignedSeq.seq,
+                          distScoreFn);
+}
+
 template <typename T_CmpFile>
 void AlignmentSetToCmpH5Adapter<T_CmpFile>::StoreAlignmentCandidate(AlignmentCandidate<> &alignment,
                                                                     int alnSegment,
                                                                     T_CmpFile &cmpFile,
                                                                     int moleculeNumber,
                                                                     bool copyQVs)
+{
+    CmpH5EncodedAlignment encoded;
+    EncodeAlignmentCandidate(alignment, copyQVs, encoded);
+    StoreEncodedAlignmentCandidate(alignment, encoded, alnSegment, cmpFile, moleculeNumber);
+}
+
+template <typename T_CmpFile>
+void AlignmentSetToCmpH5Adapter<T_CmpFile>::StoreEncodedAlignmentCandidate(
+    AlignmentCandidate<> &alignment, CmpH5EncodedAlignment &encoded, int alnSegment,
+    T_CmpFile &cmpFile, int moleculeNumber)
 {
     //
     // Find out where the movie is going to get stored.
@@ -152,55 +213,30 @@ void AlignmentSetToCmpH5Adapter<T_CmpFile>::StoreAlignmentCandidate(AlignmentCan
     std::vector<unsigned int> alnIndex;
     alnIndex.resize(22);
 
-    RemoveGapsAtEndOfAlignment(alignment);
-
     /*
     * Store the alignment string
     */
-    std::vector<unsigned char> byteAlignment;
-    AlignmentToByteAlignment(alignment, alignment.qAlignedSeq, alignment.tAlignedSeq,
-                             byteAlignment);
-
     unsigned int offsetBegin, offsetEnd;
-    cmpFile.StoreAlnArray(byteAlignment, alignment.tName, movieName, offsetBegin, offsetEnd);
+    cmpFile.StoreAlnArray(encoded.byteAlignment, alignment.tName, movieName, offsetBegin,
+                          offsetEnd);
     // Copy QVs into cmp.h5
-    if (copyQVs) {
-        std::vector<std::string> optionalQVs;
-        alignment.CopyQVs(&optionalQVs);
-        for (size_t qv_i = 0; qv_i < optionalQVs.size(); qv_i++) {
-            std::string *qvName = &alignment.optionalQVNames[qv_i];
-            std::string *qvString = &optionalQVs[qv_i];
-
-            // If the qvString is empty, then the alignment is missing the quality
-            // value
-            if (qvString->size() == 0) {
-                continue;
-            }
-
-            unsigned int qvOffsetBegin, qvOffsetEnd;
-            if (qvName->compare(qvName->size() - 3, 3, "Tag") == 0) {
-                std::vector<char> qvVector;
-                QVsToCmpH5QVs(*qvString, byteAlignment, true, &qvVector);
-                cmpFile.StoreTags(qvVector, alignment.tName, *qvName, movieName, &qvOffsetBegin,
-                                  &qvOffsetEnd);
-            } else {
-                std::vector<UChar> qvVector;
-                QVsToCmpH5QVs(*qvString, byteAlignment, false, &qvVector);
-                cmpFile.StoreQVs(qvVector, alignment.tName, *qvName, movieName, &qvOffsetBegin,
-                                 &qvOffsetEnd);
-            }
-            assert(qvOffsetBegin == offsetBegin);
-            assert(qvOffsetEnd == offsetEnd);
-        }
+    for (size_t qv_i = 0; qv_i < encoded.qvs.size(); qv_i++) {
+        unsigned int qvOffsetBegin, qvOffsetEnd;
+        cmpFile.StoreQVs(encoded.qvs[qv_i], alignment.tName, encoded.qvNames[qv_i], movieName,
+                         &qvOffsetBegin, &qvOffsetEnd);
+        assert(qvOffsetBegin == offsetBegin);
+        assert(qvOffsetEnd == offsetEnd);
+    }
+    for (size_t tag_i = 0; tag_i < encoded.tags.size(); tag_i++) {
+        unsigned int qvOffsetBegin, qvOffsetEnd;
+        cmpFile.StoreTags(encoded.tags[tag_i], alignment.tName, encoded.tagNames[tag_i], movieName,
+                          &qvOffsetBegin, &qvOffsetEnd);
+        assert(qvOffsetBegin == offsetBegin);
+        assert(qvOffsetEnd == offsetEnd);
     }
 
     numAlignments++;
 
-    DistanceMatrixScoreFunction<DNASequence, DNASequence> distScoreFn;
-    //distScoreFn does not matter since the score is not stored.
-    ComputeAlignmentStats(alignment, alignment.qAlignedSeq.seq, alignment.tAlignedSeq.seq,
-                          distScoreFn);
-
     /*
     The current AlnIndex column names:
     (0): "AlnID", "AlnGroupID", "MovieID", "RefGroupID", "tStart",
@@ -240,10 +276,20 @@ void AlignmentSetToCmpH5Adapter<T_CmpFile>::StoreAlignmentCandidate(AlignmentCan
 template <typename T_CmpFile>
 void AlignmentSetToCmpH5Adapter<T_CmpFile>::StoreAlignmentCandidateList(
     std::vector<AlignmentCandidate<> > &alignments, T_CmpFile &cmpFile, int moleculeNumber,
-    bool copyQVs)
+    bool copyQVs, WorkerPool *encodePool)
 {
+    std::vector<CmpH5EncodedAlignment> encoded(alignments.size());
+    if (encodePool != NULL and encodePool->NumThreads() > 1 and alignments.size() > 1) {
+        encodePool->ParallelFor(alignments.size(), [&](unsigned int a, unsigned int) {
+            EncodeAlignmentCandidate(alignments[a], copyQVs, encoded[a]);
+        });
+    } else {
+        for (size_t a = 0; a < alignments.size(); a++) {
+            EncodeAlignmentCandidate(alignments[a], copyQVs, encoded[a]);
+        }
+    }
     for (size_t a = 0; a < alignments.size(); a++) {
-        StoreAlignmentCandidate(alignments[a], a, cmpFile, moleculeNumber, copyQVs);
+        StoreEncodedAlignmentCandidate(alignments[a], encoded[a], a, cmpFile, moleculeNumber);
     }
 }
 
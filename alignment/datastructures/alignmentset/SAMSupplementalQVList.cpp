@@ -58,6 +58,7 @@ void SupplementalQVList::PrintQVOptionalFields(SMRTSequence &alignedSubsequence,
             alignedSubsequence.PrintAsciiRichQuality(out, i + 1, 0);
         }
     }
+    alignedSubsequence.LoadQVs(SubstitutionTag | DeletionTag);
     if (alignedSubsequence.substitutionTag != NULL and (useqv & SubstitutionTag)) {
         out << "\t" << qvTags[I_SubstitutionTag - 1] << ":Z:";
         alignedSubsequence.PrintAsciiRichQuality(out, I_SubstitutionTag, 0);
@@ -0,0 +1,43 @@
+#include <alignment/datastructures/anchoring/AnchorList.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+void AnchorList::clear()
+{
+    t.clear();
+    q.clear();
+    l.clear();
+    m.clear();
+}
+
+void AnchorList::reserve(size_t n)
+{
+    t.reserve(n);
+    q.reserve(n);
+    l.reserve(n);
+    m.reserve(n);
+}
+
+size_t AnchorList::size() const { return t.size(); }
+
+bool AnchorList::empty() const { return t.empty(); }
+
+void AnchorList::SortByTargetAndQuery()
+{
+    size_t n = size();
+    assert(q.size() == n and l.size() == n and m.size() == n);
+    keys.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (static_cast<uint64_t>(t[i]) << 32) | q[i];
+    }
+
+    sorter.SortWithOrder(keys, order);
+    if (std::is_sorted(order.begin(), order.end())) {
+        return;
+    }
+    PermuteByOrder(t, order, fieldBuffer);
+    PermuteByOrder(q, order, fieldBuffer);
+    PermuteByOrder(l, order, fieldBuffer);
+    PermuteByOrder(m, order, multiplicityBuffer);
+}
@@ -0,0 +1,96 @@
+#ifndef _BLASR_ANCHOR_LIST_HPP_
+#define _BLASR_ANCHOR_LIST_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <pbdata/Types.h>
+#include <alignment/algorithms/sorting/RadixSort.hpp>
+#include <alignment/datastructures/anchoring/MatchPos.hpp>
+
+//
+// A list of anchors kept as parallel arrays of their target position,
+// query position, length and multiplicity, rather than as a vector of
+// MatchPos.  Passes over one field read only that field, and sorting by
+// (t, q) is a radix sort of packed keys that moves each field once.
+//
+// SparseChain, and so SparseChainFindMaxIncreasingInterval, chain an
+// AnchorList directly.  Other interval searches keep chaining state in
+// each anchor, so anchors are sorted and converted to MatchPos with
+// GetMatchPosList for them.
+//
+class AnchorList
+{
+public:
+    std::vector<DNALength> t, q, l;
+    std::vector<int> m;
+
+    void clear();
+
+    void reserve(size_t n);
+
+    size_t size() const;
+
+    bool empty() const;
+
+    inline void push_back(DNALength pt, DNALength pq, DNALength pl, int pm);
+
+    // A copy of anchor i.
+    inline ChainedMatchPos operator[](size_t i) const;
+
+    //
+    // Sort anchors by t, then q.  Anchors at the same (t, q) keep their
+    // order.
+    //
+    void SortByTargetAndQuery();
+
+    template <typename T_MatchPos>
+    void StoreMatchPosList(const std::vector<T_MatchPos> &matchPosList);
+
+    template <typename T_MatchPos>
+    void GetMatchPosList(std::vector<T_MatchPos> &matchPosList) const;
+
+private:
+    // Buffers for sorting, kept so that a reused list does not allocate.
+    RadixSort sorter;
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> order;
+    std::vector<DNALength> fieldBuffer;
+    std::vector<int> multiplicityBuffer;
+};
+
+inline void AnchorList::push_back(DNALength pt, DNALength pq, DNALength pl, int pm)
+{
+    t.push_back(pt);
+    q.push_back(pq);
+    l.push_back(pl);
+    m.push_back(pm);
+}
+
+inline ChainedMatchPos AnchorList::operator[](size_t i) const
+{
+    return ChainedMatchPos(t[i], q[i], l[i], m[i]);
+}
+
+template <typename T_MatchPos>
+void AnchorList::StoreMatchPosList(const std::vector<T_MatchPos> &matchPosList)
+{
+    clear();
+    reserve(matchPosList.size());
+    for (size_t i = 0; i < matchPosList.size(); i++) {
+        push_back(matchPosList[i].t, matchPosList[i].q, matchPosList[i].l, matchPosList[i].m);
+    }
+}
+
+template <typename T_MatchPos>
+void AnchorList::GetMatchPosList(std::vector<T_MatchPos> &matchPosList) const
+{
+    matchPosList.clear();
+    matchPosList.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        matchPosList.push_back(T_MatchPos(t[i], q[i], l[i], m[i]));
+    }
+}
+
+#endif  // _BLASR_ANCHOR_LIST_HPP_
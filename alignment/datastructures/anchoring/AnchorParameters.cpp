@@ -17,6 +17,9 @@ AnchorParameters::AnchorParameters()
     verbosity = 0;
     lcpBoundsOutPtr = NULL;
     branchExpand = 0;
+    tupleFrequencies = NULL;
+    maxSeedFrequency = 0;
+    repeatSeedStride = 0;
 }
 
 AnchorParameters &AnchorParameters::Assign(const AnchorParameters &rhs)
@@ -38,6 +41,9 @@ AnchorParameters &AnchorParameters::Assign(const AnchorParameters &rhs)
     verbosity = rhs.verbosity;
     removeEncompassedMatches = rhs.removeEncompassedMatches;
     branchExpand = rhs.branchExpand;
+    tupleFrequencies = rhs.tupleFrequencies;
+    maxSeedFrequency = rhs.maxSeedFrequency;
+    repeatSeedStride = rhs.repeatSeedStride;
     return *this;
 }
 
@@ -7,6 +7,8 @@
 #include <pbdata/DNASequence.hpp>
 #include <pbdata/qvs/QualityValue.hpp>
 
+class TupleFrequencyTable;
+
 class AnchorParameters
 {
 public:
@@ -25,6 +27,15 @@ public:
     bool removeEncompassedMatches;
     std::ostream *lcpBoundsOutPtr;
     int branchExpand;
+    //
+    // If tupleFrequencies is set, read positions whose tuple occurs more
+    // than maxSeedFrequency times in the reference are not searched in
+    // the suffix array, apart from one in every repeatSeedStride of
+    // them when that is not 0.
+    //
+    const TupleFrequencyTable *tupleFrequencies;
+    int maxSeedFrequency;
+    int repeatSeedStride;
 
     AnchorParameters();
 
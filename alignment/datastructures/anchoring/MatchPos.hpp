@@ -2,10 +2,12 @@
 #define _BLASR_MATCH_POS_HPP_
 
 #include <algorithm>
+#include <cstdint>
 #include <ostream>
 #include <vector>
 
 #include <pbdata/Types.h>
+#include <alignment/algorithms/sorting/RadixSort.hpp>
 #include <pbdata/DNASequence.hpp>
 
 class MatchPos
@@ -163,7 +165,9 @@ public:
 template <typename T_MatchPos>
 void SortMatchPosList(std::vector<T_MatchPos> &mpl)
 {
-    std::sort(mpl.begin(), mpl.end(), CompareMatchPos<T_MatchPos>());
+    // The order of CompareMatchPos, by t then q.
+    RadixSortByKey(mpl,
+                   [](const T_MatchPos &p) { return (static_cast<uint64_t>(p.t) << 32) | p.q; });
 }
 
 template <typename T_MatchPos>
@@ -1,5 +1,7 @@
 #include <alignment/datastructures/anchoring/WeightedInterval.hpp>
 
+#include <algorithm>
+
 WeightedInterval::WeightedInterval() {}
 
 void WeightedInterval::Init(int _size, int _start, int _end, int _readIndex, float _pValue)
@@ -84,7 +86,10 @@ int CompareWeightedIntervalByPValue::operator()(const WeightedInterval &a,
 // Functions of class WeightedIntervalSet
 WeightedIntervalSet::WeightedIntervalSet() : maxSize(0) {}
 
-WeightedIntervalSet::WeightedIntervalSet(const size_t maxSizeP) : maxSize(maxSizeP) {}
+WeightedIntervalSet::WeightedIntervalSet(const size_t maxSizeP) : maxSize(maxSizeP)
+{
+    intervals.reserve(maxSize + 1);
+}
 
 bool WeightedIntervalSet::insert(WeightedInterval &intv)
 {
@@ -94,28 +99,24 @@ bool WeightedIntervalSet::insert(WeightedInterval &intv)
     // Make sure this interval is not contained inside any other
     // weighted intervals.
     //
-    WeightedIntervalSet::iterator it = (*this).begin();
-    WeightedIntervalSet::iterator endit = (*this).end();
+    size_t i = 0;
     bool isContained = false;
-    while (it != endit and isContained == false) {
-        if (intv.qStart >= (*it).qStart and intv.qEnd <= (*it).qEnd and
-            intv.start >= (*it).start and intv.end <= (*it).end and
-            intv.readIndex == (*it).readIndex and intv.pValue >= (*it).pValue) {
+    while (i < intervals.size() and isContained == false) {
+        const WeightedInterval &cur = intervals[i];
+        if (intv.qStart >= cur.qStart and intv.qEnd <= cur.qEnd and intv.start >= cur.start and
+            intv.end <= cur.end and intv.readIndex == cur.readIndex and intv.pValue >= cur.pValue) {
             //
             // This already overlaps an existing interval, don't bother
             // trying to add it.
             //
             isContained = true;
             intv.isOverlapping = true;
-        } else if ((*it).start >= intv.start and (*it).end <= intv.end and
-                   (*it).qStart >= intv.qStart and (*it).qEnd <= intv.qEnd and
-                   (*it).readIndex == intv.readIndex and (*it).pValue >= intv.pValue) {
-            WeightedIntervalSet::iterator next = it;
-            ++next;
-            this->erase(it);
-            it = next;
+        } else if (cur.start >= intv.start and cur.end <= intv.end and cur.qStart >= intv.qStart and
+                   cur.qEnd <= intv.qEnd and cur.readIndex == intv.readIndex and
+                   cur.pValue >= intv.pValue) {
+            intervals.erase(intervals.begin() + i);
         } else {
-            ++it;
+            ++i;
         }
     }
 
@@ -124,35 +125,62 @@ bool WeightedIntervalSet::insert(WeightedInterval &intv)
     // bother attempting to add at all.
     //
     if (size() >= maxSize and maxSize > 0) {
-        WeightedIntervalSet::iterator last = (*this).end();
-        last--;
-
-        if (last->pValue < intv.pValue) {
+        if (intervals.back().pValue < intv.pValue) {
             return false;
         }
     }
 
     if (isContained == false) {
-        bool addInsert = false;
-        if (size() == 0) {
-            addInsert = true;
-        } else {
-            it = end();
-            --it;
-            if (size() < maxSize or (*it).pValue > intv.pValue) {
-                addInsert = true;
-                //
-                // Keep the size of the stack the same if it is at the limit.
-                //
-                if (maxSize != 0 and size() >= maxSize and size() > 0) {
-                    erase(it);
-                }
+        if (size() == 0 or size() < maxSize or intervals.back().pValue > intv.pValue) {
+            //
+            // Keep the size of the stack the same if it is at the limit,
+            // by overwriting the last interval.
+            //
+            if (maxSize != 0 and size() >= maxSize) {
+                intervals.back() = intv;
+            } else {
+                intervals.push_back(intv);
             }
-        }
-        if (addInsert) {
-            ((T_WeightedIntervalMultiSet *)this)->insert(intv);
+            //
+            // Move the new interval from the end to after the intervals
+            // not greater than it, where a multiset would insert it.
+            //
+            std::vector<WeightedInterval>::iterator pos =
+                std::upper_bound(intervals.begin(), intervals.end() - 1, intervals.back(),
+                                 CompareWeightedIntervalByPValue());
+            std::rotate(pos, intervals.end() - 1, intervals.end());
         }
         return true;
     }
     return false;
 }
+
+WeightedIntervalSet::const_iterator WeightedIntervalSet::begin() const { return intervals.begin(); }
+
+WeightedIntervalSet::const_iterator WeightedIntervalSet::end() const { return intervals.end(); }
+
+WeightedIntervalSet::const_reverse_iterator WeightedIntervalSet::rbegin() const
+{
+    return intervals.rbegin();
+}
+
+WeightedIntervalSet::const_reverse_iterator WeightedIntervalSet::rend() const
+{
+    return intervals.rend();
+}
+
+size_t WeightedIntervalSet::size() const { return intervals.size(); }
+
+bool WeightedIntervalSet::empty() const { return intervals.empty(); }
+
+void WeightedIntervalSet::clear() { intervals.clear(); }
+
+WeightedIntervalSet::iterator WeightedIntervalSet::erase(const_iterator pos)
+{
+    return intervals.erase(pos);
+}
+
+WeightedIntervalSet::iterator WeightedIntervalSet::erase(const_iterator first, const_iterator last)
+{
+    return intervals.erase(first, last);
+}
@@ -1,7 +1,7 @@
 #ifndef _BLASR_WEIGHTED_INTERVAL_HPP_
 #define _BLASR_WEIGHTED_INTERVAL_HPP_
 
-#include <set>
+#include <ostream>
 #include <vector>
 
 #include <alignment/datastructures/anchoring/MatchPos.hpp>
@@ -65,23 +65,48 @@ public:
 
 typedef std::vector<WeightedInterval> WeightedIntervalVector;
 
-typedef std::multiset<WeightedInterval, CompareWeightedIntervalByPValue> T_WeightedIntervalMultiSet;
-
-class WeightedIntervalSet : public T_WeightedIntervalMultiSet
+//
+// The best maxSize intervals by p-value, or all of them if maxSize is 0,
+// in order of CompareWeightedIntervalByPValue.  Intervals are kept in a
+// sorted array rather than a tree, and an interval that displaces the
+// worst one is copied into its slot, so once the set is full inserting
+// does not allocate unless an interval has more matches than the one it
+// replaces.  Iterators are invalidated by insert and erase.
+//
+class WeightedIntervalSet
 {
 public:
+    typedef std::vector<WeightedInterval>::const_iterator iterator;
+    typedef std::vector<WeightedInterval>::const_iterator const_iterator;
+    typedef std::vector<WeightedInterval>::const_reverse_iterator reverse_iterator;
+    typedef std::vector<WeightedInterval>::const_reverse_iterator const_reverse_iterator;
+
     size_t maxSize;
     WeightedIntervalSet();
     WeightedIntervalSet(const size_t maxSizeP);
     bool insert(WeightedInterval &intv);
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
+    size_t size() const;
+    bool empty() const;
+    void clear();
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
     friend std::ostream &operator<<(std::ostream &out, const WeightedIntervalSet &wis)
     {
         WeightedIntervalSet::iterator it;
         for (it = wis.begin(); it != wis.end(); it++) {
-            out << *((WeightedInterval *)&(*it)) << std::endl;
+            out << *it << std::endl;
         }
         return out;
     }
+
+private:
+    std::vector<WeightedInterval> intervals;
 };
 
 #endif
@@ -0,0 +1,159 @@
+#include <alignment/files/ParallelBamReader.hpp>
+
+#ifdef USE_PBBAM
+
+#include <algorithm>
+#include <iostream>
+
+#include <pbbam/BamReader.h>
+
+using namespace PacBio;
+using namespace PacBio::BAM;
+
+ParallelBamReader::ParallelBamReader(const DataSet &dataset, const PbiFilter &filter,
+                                     const int nThreads, const size_t recordsPerRange,
+                                     const bool copyAllQVs, const bool lazyQVs,
+                                     const size_t shardIndex, const size_t numShards)
+    : ParallelBamReader(std::make_shared<const PbiZmwRanges>(filter, dataset), nThreads,
+                        recordsPerRange, copyAllQVs, lazyQVs, shardIndex, numShards)
+{
+}
+
+ParallelBamReader::ParallelBamReader(const std::shared_ptr<const PbiZmwRanges> &index,
+                                     const int nThreads, const size_t recordsPerRange,
+                                     const bool copyAllQVs, const bool lazyQVs,
+                                     const size_t shardIndex, const size_t numShards)
+    : index_(index)
+    , ranges_(numShards > 1
+                  ? index_->SplitByRecords(recordsPerRange, index_->Shard(shardIndex, numShards))
+                  : index_->SplitByRecords(recordsPerRange))
+    , copyAllQVs_(copyAllQVs)
+    , lazyQVs_(lazyQVs)
+    , maxRangesInFlight_(2 * static_cast<size_t>(std::max(nThreads, 1)))
+    , decodedRanges_(ranges_.size())
+    , nextRange_(0)
+    , stop_(false)
+    , error_(nullptr)
+    , curRange_(0)
+    , curRead_(0)
+{
+    for (int i = 0; i < std::max(nThreads, 1); i++) {
+        workers_.emplace_back(&ParallelBamReader::DecodeRanges, this);
+    }
+}
+
+ParallelBamReader::~ParallelBamReader() { Close(); }
+
+void ParallelBamReader::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        curRange_ = ranges_.size();
+    }
+    consumed_.notify_all();
+    for (std::thread &worker : workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    workers_.clear();
+    decodedRanges_.clear();
+}
+
+void ParallelBamReader::DecodeRanges()
+{
+    // Each worker owns a reader, so that BGZF blocks are inflated concurrently.
+    std::unique_ptr<BamReader> reader;
+    size_t readerFileIndex = 0;
+    while (true) {
+        size_t rangeIndex;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            // Do not run too far ahead of the consumer.
+            consumed_.wait(lock, [this] {
+                return stop_ or nextRange_ >= ranges_.size() or
+                       nextRange_ < curRange_ + maxRangesInFlight_;
+            });
+            if (stop_ or nextRange_ >= ranges_.size()) return;
+            rangeIndex = nextRange_++;
+        }
+
+        std::unique_ptr<DecodedRange> decoded(new DecodedRange);
+        try {
+            DecodeRange(ranges_[rangeIndex], reader, readerFileIndex, *decoded);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (error_ == nullptr) error_ = std::current_exception();
+            stop_ = true;
+            decoded_.notify_all();
+            consumed_.notify_all();
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            decodedRanges_[rangeIndex] = std::move(decoded);
+        }
+        decoded_.notify_all();
+    }
+}
+
+void ParallelBamReader::DecodeRange(const PbiRowRange &range, std::unique_ptr<BamReader> &reader,
+                                    size_t &readerFileIndex, DecodedRange &decoded) const
+{
+    if (reader == nullptr or readerFileIndex != range.fileIndex) {
+        reader.reset(new BamReader(index_->Files()[range.fileIndex]));
+        readerFileIndex = range.fileIndex;
+    }
+
+    const std::vector<BamRecord> records = index_->ReadRange(*reader, range);
+
+    // Construct all reads up front; SMRTSequence must not be reallocated.
+    decoded.reads = std::vector<SMRTSequence>(records.size());
+    decoded.numReads = 0;
+    for (const BamRecord &record : records) {
+        if (not SMRTSequence::IsValid(record)) {
+            std::cerr << "Skipping an invalid read " << record.FullName() << std::endl;
+            continue;
+        }
+        if (lazyQVs_)
+            decoded.reads[decoded.numReads++].LazyCopy(record, copyAllQVs_);
+        else
+            decoded.reads[decoded.numReads++].Copy(record, copyAllQVs_);
+    }
+}
+
+int ParallelBamReader::GetNext(SMRTSequence &seq)
+{
+    while (curRange_ < ranges_.size()) {
+        DecodedRange *decoded;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            decoded_.wait(lock, [this] {
+                return error_ != nullptr or stop_ or decodedRanges_[curRange_] != nullptr;
+            });
+            if (error_ != nullptr) std::rethrow_exception(error_);
+            if (decodedRanges_[curRange_] == nullptr) return 0;  // closed
+            decoded = decodedRanges_[curRange_].get();
+        }
+
+        if (curRead_ < decoded->numReads) {
+            // Decoded reads are released with their range, so hand the
+            // read over instead of copying it.
+            seq.Free();
+            seq.Swap(decoded->reads[curRead_++]);
+            return 1;
+        }
+
+        // Release reads of this range and let workers move on.
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            decodedRanges_[curRange_].reset();
+            curRange_++;
+            curRead_ = 0;
+        }
+        consumed_.notify_all();
+    }
+    return 0;
+}
+
+#endif  // USE_PBBAM
@@ -0,0 +1,107 @@
+#ifndef _BLASR_PARALLEL_BAM_READER_HPP_
+#define _BLASR_PARALLEL_BAM_READER_HPP_
+
+#include <LibBlasrConfig.h>
+
+#ifdef USE_PBBAM
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <pbbam/DataSet.h>
+#include <pbbam/PbiFilter.h>
+
+#include <alignment/query/PbiZmwRanges.h>
+#include <pbdata/SMRTSequence.hpp>
+
+/// Reads subreads from pbi-indexed BAM files with a pool of worker threads.
+///
+/// Records are split into zmw-aligned ranges using the .pbi. Each worker
+/// owns its own BamReader, seeks to the BGZF virtual offset of a range,
+/// inflates and decodes its records, and converts them to SMRTSequences.
+/// Reads are returned by GetNext() in file order, regardless of which
+/// worker decoded them. At most maxRangesInFlight decoded ranges are
+/// buffered ahead of the consumer.
+///
+class ParallelBamReader
+{
+public:
+    /// \param [in] dataset - dataset whose BAM files all have .pbi indexes
+    /// \param [in] filter - only records accepted by filter are read
+    /// \param [in] nThreads - number of decoding threads
+    /// \param [in] recordsPerRange - approximate number of records a worker
+    ///             decodes at a time
+    /// \param [in] copyAllQVs - passed to SMRTSequence::Copy
+    /// \param [in] lazyQVs - convert records with SMRTSequence::LazyCopy
+    /// \param [in] shardIndex, numShards - only read the shardIndex-th of
+    ///             numShards shards, see PbiZmwRanges::Shard
+    ParallelBamReader(const PacBio::BAM::DataSet &dataset, const PacBio::BAM::PbiFilter &filter,
+                      const int nThreads, const size_t recordsPerRange = 1024,
+                      const bool copyAllQVs = false, const bool lazyQVs = false,
+                      const size_t shardIndex = 0, const size_t numShards = 1);
+
+    /// Same as above, reading from an already loaded index which may be
+    /// shared with other queries of the same dataset.
+    ParallelBamReader(const std::shared_ptr<const PacBio::BAM::PbiZmwRanges> &index,
+                      const int nThreads, const size_t recordsPerRange = 1024,
+                      const bool copyAllQVs = false, const bool lazyQVs = false,
+                      const size_t shardIndex = 0, const size_t numShards = 1);
+
+    ~ParallelBamReader();
+
+    /// Get the next valid read in file order.
+    /// Invalid records are reported and skipped, as with EntireFileQuery.
+    /// \returns 1 if a read is copied to seq, 0 if all reads are consumed.
+    int GetNext(SMRTSequence &seq);
+
+    /// Stop and join worker threads, dropping reads not yet consumed.
+    void Close();
+
+private:
+    /// Decoded reads of one range.
+    struct DecodedRange
+    {
+        std::vector<SMRTSequence> reads;
+        size_t numReads;
+    };
+
+    void DecodeRanges();
+
+    void DecodeRange(const PacBio::BAM::PbiRowRange &range,
+                     std::unique_ptr<PacBio::BAM::BamReader> &reader, size_t &readerFileIndex,
+                     DecodedRange &decoded) const;
+
+private:
+    std::shared_ptr<const PacBio::BAM::PbiZmwRanges> index_;
+    std::vector<PacBio::BAM::PbiRowRange> ranges_;
+    bool copyAllQVs_;
+    bool lazyQVs_;
+    size_t maxRangesInFlight_;
+
+    // Guarded by mutex_.
+    std::mutex mutex_;
+    std::condition_variable decoded_;
+    std::condition_variable consumed_;
+    std::vector<std::unique_ptr<DecodedRange>> decodedRanges_;
+    size_t nextRange_;
+    bool stop_;
+    std::exception_ptr error_;
+
+    // Written only by the consumer, under mutex_.  Workers read it under
+    // mutex_ to bound how far ahead of the consumer they decode, so only
+    // the consumer may read it without the lock.
+    size_t curRange_;
+
+    // Only accessed by the consumer.
+    size_t curRead_;
+
+    std::vector<std::thread> workers_;
+};
+
+#endif  // USE_PBBAM
+
+#endif  // _BLASR_PARALLEL_BAM_READER_HPP_
@@ -13,14 +13,22 @@ void ReaderAgglomerate::InitializeParameters()
     readType = ReadType::SUBREAD;
     unrolled = false;  // indicate unrolled mode , needed by GetNext
     polymerase = false;
+    bamDecodeThreads = 1;
+    lazyBamQVs = false;
+    shardIndex = 0;
+    numShards = 1;
 #ifdef USE_PBBAM
     dataSetPtr = nullptr;
     entireFileQueryPtr = nullptr;
     pbiFilterQueryPtr = nullptr;
     sequentialZmwQueryPtr = nullptr;
     pbiFilterZmwQueryPtr = nullptr;
+    pbiShardQueryPtr = nullptr;
+    pbiShardZmwQueryPtr = nullptr;
     // the following two for unrolling
     VPReader = nullptr;  // for PBBAM
+    parallelBamReaderPtr = nullptr;
+    useParallelBamReader = false;
 #endif
 }
 
@@ -105,6 +113,17 @@ void ReaderAgglomerate::UseCCS()
 
 void ReaderAgglomerate::SetScrapsFileName(std::string &pFileName) { scrapsFileName = pFileName; }
 
+void ReaderAgglomerate::SetBamDecodeThreads(int nThreads) { bamDecodeThreads = nThreads; }
+
+void ReaderAgglomerate::SetLazyBamQVs(bool lazy) { lazyBamQVs = lazy; }
+
+void ReaderAgglomerate::SetShard(size_t _shardIndex, size_t _numShards)
+{
+    assert(_numShards > 0 and _shardIndex < _numShards);
+    shardIndex = _shardIndex;
+    numShards = _numShards;
+}
+
 bool ReaderAgglomerate::SetReadFileName(std::string &pFileName)
 {
     if (DetermineFileTypeByExtension(pFileName, fileType)) {
@@ -170,7 +189,7 @@ bool ReaderAgglomerate::HasRegionTable()
             entireFileIterator++;                                                        \
         } else {                                                                         \
             numRecords = 1;                                                              \
-            seq.Copy(*entireFileIterator);                                               \
+            CopyFromBam(seq, *entireFileIterator);                                       \
             entireFileIterator++;                                                        \
             break;                                                                       \
         }                                                                                \
@@ -185,12 +204,27 @@ bool ReaderAgglomerate::HasRegionTable()
             pbiFilterIterator++;                                                        \
         } else {                                                                        \
             numRecords = 1;                                                             \
-            seq.Copy(*pbiFilterIterator);                                               \
+            CopyFromBam(seq, *pbiFilterIterator);                                       \
             pbiFilterIterator++;                                                        \
             break;                                                                      \
         }                                                                               \
     }
 
+#define GET_NEXT_FROM_SHARD()                                                          \
+    numRecords = 0;                                                                    \
+    while (pbiShardIterator != pbiShardQueryPtr->end()) {                              \
+        if (not SMRTSequence::IsValid(*pbiShardIterator)) {                            \
+            std::cerr << "Skipping an invalid read " << (*pbiShardIterator).FullName() \
+                      << std::endl;                                                    \
+            pbiShardIterator++;                                                        \
+        } else {                                                                       \
+            numRecords = 1;                                                            \
+            CopyFromBam(seq, *pbiShardIterator);                                       \
+            pbiShardIterator++;                                                        \
+            break;                                                                     \
+        }                                                                              \
+    }
+
 #define RESET_PBBAM_PTRS()               \
     if (dataSetPtr != nullptr) {         \
         delete dataSetPtr;               \
@@ -212,10 +246,61 @@ bool ReaderAgglomerate::HasRegionTable()
         delete pbiFilterZmwQueryPtr;     \
         pbiFilterZmwQueryPtr = nullptr;  \
     }                                    \
+    if (pbiShardQueryPtr) {              \
+        delete pbiShardQueryPtr;         \
+        pbiShardQueryPtr = nullptr;      \
+    }                                    \
+    if (pbiShardZmwQueryPtr) {           \
+        delete pbiShardZmwQueryPtr;      \
+        pbiShardZmwQueryPtr = nullptr;   \
+    }                                    \
     if (VPReader) {                      \
         delete VPReader;                 \
         VPReader = nullptr;              \
+    }                                    \
+    if (parallelBamReaderPtr) {          \
+        delete parallelBamReaderPtr;     \
+        parallelBamReaderPtr = nullptr;  \
+    }                                    \
+    parallelBamRanges.reset();           \
+    useParallelBamReader = false;
+#endif
+
+#ifdef USE_PBBAM
+ParallelBamReader *ReaderAgglomerate::GetParallelBamReader()
+{
+    if (parallelBamReaderPtr == nullptr) {
+        if (parallelBamRanges) {
+            parallelBamReaderPtr = new ParallelBamReader(parallelBamRanges, bamDecodeThreads, 1024,
+                                                         false, lazyBamQVs, shardIndex, numShards);
+        } else {
+            const PacBio::BAM::PbiFilter filter =
+                (fileType == FileType::PBDATASET) ? PacBio::BAM::PbiFilter::FromDataSet(*dataSetPtr)
+                                                  : PacBio::BAM::PbiFilter();
+            parallelBamReaderPtr = new ParallelBamReader(*dataSetPtr, filter, bamDecodeThreads,
+                                                         1024, false, lazyBamQVs);
+        }
     }
+    return parallelBamReaderPtr;
+}
+
+void ReaderAgglomerate::CopyFromBam(FASTASequence &seq, const PacBio::BAM::BamRecord &record)
+{
+    seq.Copy(record);
+}
+
+void ReaderAgglomerate::CopyFromBam(FASTQSequence &seq, const PacBio::BAM::BamRecord &record)
+{
+    seq.Copy(record);
+}
+
+void ReaderAgglomerate::CopyFromBam(SMRTSequence &seq, const PacBio::BAM::BamRecord &record)
+{
+    if (lazyBamQVs)
+        seq.LazyCopy(record);
+    else
+        seq.Copy(record);
+}
 #endif
 
 int ReaderAgglomerate::Initialize(bool unrolled_mode, bool polymerase_mode)
@@ -281,6 +366,31 @@ int ReaderAgglomerate::Initialize(bool unrolled_mode, bool polymerase_mode)
                     VPReader = new PacBio::BAM::ZmwReadStitcher(*dataSetPtr);
                     assert(VPReader != nullptr);
                 }
+            } else if (numShards > 1) {
+                if (not PacBio::BAM::PbiZmwRanges::IndexesExist(*dataSetPtr)) {
+                    std::cout << "ERROR! Reading a shard of " << fileName
+                              << " requires a .pbi index for every BAM file." << std::endl;
+                    return 0;
+                }
+                const PacBio::BAM::PbiFilter filter =
+                    (fileType == FileType::PBDATASET)
+                        ? PacBio::BAM::PbiFilter::FromDataSet(*dataSetPtr)
+                        : PacBio::BAM::PbiFilter();
+                // Load the .pbi files once for all shard readers.
+                const std::shared_ptr<const PacBio::BAM::PbiZmwRanges> zmwRanges =
+                    std::make_shared<const PacBio::BAM::PbiZmwRanges>(filter, *dataSetPtr);
+
+                pbiShardQueryPtr = new PacBio::BAM::PbiShardQuery(zmwRanges, shardIndex, numShards);
+                assert(pbiShardQueryPtr != nullptr);
+                pbiShardIterator = pbiShardQueryPtr->begin();
+
+                pbiShardZmwQueryPtr =
+                    new PacBio::BAM::PbiShardZmwGroupQuery(zmwRanges, shardIndex, numShards);
+                assert(pbiShardZmwQueryPtr != nullptr);
+                pbiShardZmwIterator = pbiShardZmwQueryPtr->begin();
+
+                parallelBamRanges = zmwRanges;
+                useParallelBamReader = (bamDecodeThreads > 1);
             } else {
                 if (fileType == FileType::PBBAM) {
                     entireFileQueryPtr = new PacBio::BAM::EntireFileQuery(*dataSetPtr);
@@ -302,6 +412,8 @@ int ReaderAgglomerate::Initialize(bool unrolled_mode, bool polymerase_mode)
                     assert(pbiFilterZmwQueryPtr != nullptr);
                     pbiFilterZmwIterator = pbiFilterZmwQueryPtr->begin();
                 }
+                useParallelBamReader =
+                    (bamDecodeThreads > 1 and PacBio::BAM::PbiZmwRanges::IndexesExist(*dataSetPtr));
             }
             break;
 #endif
@@ -366,12 +478,20 @@ int ReaderAgglomerate::GetNext(FASTASequence &seq)
             break;
         case FileType::PBDATASET:
 #ifdef USE_PBBAM
-            GET_NEXT_FROM_DATASET();
+            if (pbiShardQueryPtr) {
+                GET_NEXT_FROM_SHARD();
+            } else {
+                GET_NEXT_FROM_DATASET();
+            }
             break;
 #endif
         case FileType::PBBAM:
 #ifdef USE_PBBAM
-            GET_NEXT_FROM_BAM();
+            if (pbiShardQueryPtr) {
+                GET_NEXT_FROM_SHARD();
+            } else {
+                GET_NEXT_FROM_BAM();
+            }
             break;
 #endif
         case FileType::Fourbit:
@@ -402,12 +522,20 @@ int ReaderAgglomerate::GetNext(FASTQSequence &seq)
             break;
         case FileType::PBDATASET:
 #ifdef USE_PBBAM
-            GET_NEXT_FROM_DATASET();
+            if (pbiShardQueryPtr) {
+                GET_NEXT_FROM_SHARD();
+            } else {
+                GET_NEXT_FROM_DATASET();
+            }
             break;
 #endif
         case FileType::PBBAM:
 #ifdef USE_PBBAM
-            GET_NEXT_FROM_BAM();
+            if (pbiShardQueryPtr) {
+                GET_NEXT_FROM_SHARD();
+            } else {
+                GET_NEXT_FROM_BAM();
+            }
             break;
 #endif
         case FileType::HDFCCSONLY:
@@ -432,6 +560,11 @@ int ReaderAgglomerate::GetNext(std::vector<SMRTSequence> &reads)
     if (Subsample(subsample) == 0) {
         return 0;
     }
+    if (fileType == FileType::PBBAM or fileType == FileType::PBDATASET) {
+#ifdef USE_PBBAM
+        if (pbiShardZmwQueryPtr) return GetNextFromShard(reads);
+#endif
+    }
     if (fileType == FileType::PBBAM) {
 #ifdef USE_PBBAM
         // no need to check for unrolled mode, vector of SMRTS is being received
@@ -452,7 +585,7 @@ int ReaderAgglomerate::GetNext(std::vector<SMRTSequence> &reads)
                 numRecords = records.size();
                 reads.resize(numRecords);
                 for (size_t i = 0; i < records.size(); i++) {
-                    reads[i].Copy(records[i]);
+                    CopyFromBam(reads[i], records[i]);
                 }
                 sequentialZmwIterator++;
                 break;
@@ -480,7 +613,7 @@ int ReaderAgglomerate::GetNext(std::vector<SMRTSequence> &reads)
                 numRecords = records.size();
                 reads.resize(numRecords);
                 for (size_t i = 0; i < records.size(); i++) {
-                    reads[i].Copy(records[i]);
+                    CopyFromBam(reads[i], records[i]);
                 }
                 pbiFilterZmwIterator++;
                 break;
@@ -496,6 +629,39 @@ int ReaderAgglomerate::GetNext(std::vector<SMRTSequence> &reads)
     return numRecords;
 }
 
+#ifdef USE_PBBAM
+int ReaderAgglomerate::GetNextFromShard(std::vector<SMRTSequence> &reads)
+{
+    int numRecords = 0;
+    while (pbiShardZmwIterator != pbiShardZmwQueryPtr->end()) {
+        const std::vector<PacBio::BAM::BamRecord> &records = *pbiShardZmwIterator;
+        bool OK = true;
+        for (size_t i = 0; i < records.size(); i++) {
+            if (not SMRTSequence::IsValid(records[i])) {
+                OK = false;
+                std::cerr << "Skipping all subreads in " << records[i].MovieName() << "/"
+                          << records[i].HoleNumber() << ", because " << records[i].FullName()
+                          << " is invalid." << std::endl;
+                break;
+            }
+        }
+        if (OK) {
+            numRecords = records.size();
+            reads.resize(numRecords);
+            for (size_t i = 0; i < records.size(); i++) {
+                CopyFromBam(reads[i], records[i]);
+            }
+            pbiShardZmwIterator++;
+            break;
+        } else {
+            pbiShardZmwIterator++;
+        }
+    }
+    if (numRecords >= 1) readGroupId = reads[0].ReadGroupId();
+    return numRecords;
+}
+#endif
+
 // for now the only one which might be in unrolled mode: obtains SMRTSequence scalar
 int ReaderAgglomerate::GetNext(SMRTSequence &seq)
 {
@@ -558,6 +724,10 @@ int ReaderAgglomerate::GetNext(SMRTSequence &seq)
                     numRecords = 1;
                     seq.Copy(*record);
                 }
+            } else if (useParallelBamReader) {
+                numRecords = GetParallelBamReader()->GetNext(seq);
+            } else if (pbiShardQueryPtr) {
+                GET_NEXT_FROM_SHARD();
             } else {
                 switch (fileType) {
                     case FileType::PBDATASET:
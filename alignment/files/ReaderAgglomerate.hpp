@@ -2,6 +2,7 @@
 #define _BLASR_READER_AGGLOMERATE_HPP_
 
 #include <cstdlib>
+#include <memory>
 
 #include <pbdata/Enumerations.h>
 #include <alignment/files/BaseSequenceIO.hpp>
@@ -25,7 +26,10 @@
 #include <pbbam/virtual/ZmwReadStitcher.h>  // new interface
 
 #include <alignment/query/PbiFilterZmwGroupQuery.h>
+#include <alignment/query/PbiShardQuery.h>
+#include <alignment/query/PbiShardZmwGroupQuery.h>
 #include <alignment/query/SequentialZmwGroupQuery.h>
+#include <alignment/files/ParallelBamReader.hpp>
 
 #endif
 
@@ -43,6 +47,10 @@ class ReaderAgglomerate : public BaseSequenceIO
     bool unrolled;  // indicate if unrolled mode; needed because GetNext() must know about the mode
     bool polymerase;
     std::string scrapsFileName;  // Needed for unrolled to initiate if in PBBAM
+    int bamDecodeThreads;        // > 1 to decode pbi-indexed BAM in parallel
+    bool lazyBamQVs;             // defer decoding QVs of BAM records, see SetLazyBamQVs
+    size_t shardIndex;           // read only the shardIndex-th of numShards shards of BAM
+    size_t numShards;
 
 public:
     //
@@ -96,6 +104,24 @@ public:
 
     void SetScrapsFileName(std::string &pFileName);  // needed for unrolled
 
+    /// Decode BAM records with nThreads worker threads when every BAM file
+    /// has a .pbi index. Reads are still returned in file order. Only
+    /// GetNext(SMRTSequence &) reads through the worker threads.
+    /// Must be called before Initialize().
+    void SetBamDecodeThreads(int nThreads);
+
+    /// Read SMRTSequences from BAM with SMRTSequence::LazyCopy, so that
+    /// each QV track is only decoded when it is first loaded, see
+    /// FASTQSequence::LoadQVs.
+    void SetLazyBamQVs(bool lazy);
+
+    /// Read only the shardIndex-th of numShards shards of pbi-indexed BAM
+    /// input. Shards are zmw-aligned, hold about the same number of bases,
+    /// and are computed from the .pbi alone, so that numShards independent
+    /// processes together read every zmw exactly once.
+    /// Must be called before Initialize().
+    void SetShard(size_t shardIndex, size_t numShards);
+
     int Initialize(FileType &pFileType, std::string &pFileName);
 
     bool HasRegionTable();
@@ -144,6 +170,26 @@ public:
     PacBio::BAM::PbiFilterZmwGroupQuery::iterator pbiFilterZmwIterator;
     // the following to added to support ZMW reads in unrolled mode
     PacBio::BAM::ZmwReadStitcher *VPReader;  // new interface
+    PacBio::BAM::PbiShardQuery *pbiShardQueryPtr;
+    PacBio::BAM::PbiShardQuery::iterator pbiShardIterator;
+    PacBio::BAM::PbiShardZmwGroupQuery *pbiShardZmwQueryPtr;
+    PacBio::BAM::PbiShardZmwGroupQuery::iterator pbiShardZmwIterator;
+    // the following to decode subreads in parallel worker threads, which
+    // are only started by the first GetNext(SMRTSequence &)
+    ParallelBamReader *parallelBamReaderPtr;
+    std::shared_ptr<const PacBio::BAM::PbiZmwRanges> parallelBamRanges;
+    bool useParallelBamReader;
+
+private:
+    void CopyFromBam(FASTASequence &seq, const PacBio::BAM::BamRecord &record);
+    void CopyFromBam(FASTQSequence &seq, const PacBio::BAM::BamRecord &record);
+    void CopyFromBam(SMRTSequence &seq, const PacBio::BAM::BamRecord &record);
+
+    /// Get the parallel reader, starting its worker threads on first use.
+    ParallelBamReader *GetParallelBamReader();
+
+    /// Get all valid subreads of the next zmw of the shard.
+    int GetNextFromShard(std::vector<SMRTSequence> &reads);
 #endif
 };
 
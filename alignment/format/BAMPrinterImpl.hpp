@@ -71,6 +71,7 @@ void AlignmentToBamRecord(T_AlignmentCandidate &alignment, T_Sequence &read, T_S
             std::cout << "ERROR, can not convert non-pacbio reads to pbbam record." << std::endl;
             exit(-1);
         }
+        alignedSequence.LoadQVs(QualityValueTrack);
         bamRecord.Impl().SetSequenceAndQualities(seqString, alignedSequence.qual.ToString());
         bamRecord.Impl().Bin(0);
         bamRecord.Impl().InsertSize(0);
@@ -0,0 +1,95 @@
+#ifndef _BLASR_FORMAT_ORDERED_OUTPUT_QUEUE_HPP_
+#define _BLASR_FORMAT_ORDERED_OUTPUT_QUEUE_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Throughput counters of an OrderedOutputQueue.
+struct OrderedOutputStats
+{
+    /// Number of batches and records written.
+    uint64_t batches;
+    uint64_t records;
+    /// Number of times Put() blocked because too many batches were pending.
+    uint64_t producerWaits;
+    /// Largest number of batches pending at once.
+    size_t maxPending;
+    /// Time the writer thread spent emitting records.
+    double writeSeconds;
+
+    OrderedOutputStats();
+};
+
+/// Collects batches of formatted records (e.g. SAM lines or BamRecords of
+/// all alignments of one read) from many producer threads, and emits them
+/// from a single writer thread.
+///
+/// In ordered mode batches are emitted in batchIndex order, 0, 1, 2, ...,
+/// so output is the same regardless of the number of producers. Every
+/// index must then be put exactly once, with an empty batch for a read
+/// without alignments. In unordered mode batches are emitted as they come.
+///
+/// At most maxPending batches are buffered; Put() blocks beyond that,
+/// except for the batch the writer is waiting for. Producers must take
+/// batch indices in increasing order, as when reads are dealt out in file
+/// order, and put their batches in that order, so that the batch the
+/// writer waits for can always be put.
+///
+/// \note BGZF compression of BAM output is done by the pbbam BamWriter the
+///       emitter writes to, which compresses blocks with its own threads.
+///
+template <typename T_Record>
+class OrderedOutputQueue
+{
+public:
+    typedef std::function<void(T_Record &)> Emitter;
+
+    OrderedOutputQueue(Emitter emit, const size_t maxPending = 1024, const bool ordered = true);
+
+    ~OrderedOutputQueue();
+
+    /// Queue records of the batchIndex-th batch, and take them over.
+    /// Rethrows an exception thrown by the emitter.
+    void Put(const uint64_t batchIndex, std::vector<T_Record> &records);
+
+    /// Emit all batches put so far and stop the writer thread.
+    /// Rethrows an exception thrown by the emitter.
+    void Close();
+
+    OrderedOutputStats Stats() const;
+
+private:
+    /// \returns true if the writer can emit the first pending batch.
+    bool FirstBatchReady() const;
+
+    void WriteBatches();
+
+private:
+    Emitter emit_;
+    size_t maxPending_;
+    bool ordered_;
+
+    // Guarded by mutex_.
+    mutable std::mutex mutex_;
+    std::condition_variable put_;
+    std::condition_variable written_;
+    // Keyed by batch index in ordered mode, by arrival otherwise.
+    std::map<uint64_t, std::vector<T_Record>> pending_;
+    uint64_t nextBatch_;
+    uint64_t numArrivals_;
+    bool closing_;
+    std::exception_ptr error_;
+    OrderedOutputStats stats_;
+
+    std::thread writer_;
+};
+
+#include "OrderedOutputQueueImpl.hpp"
+
+#endif  // _BLASR_FORMAT_ORDERED_OUTPUT_QUEUE_HPP_
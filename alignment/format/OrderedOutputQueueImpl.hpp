@@ -0,0 +1,126 @@
+#ifndef _BLASR_FORMAT_ORDERED_OUTPUT_QUEUE_IMPL_HPP_
+#define _BLASR_FORMAT_ORDERED_OUTPUT_QUEUE_IMPL_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <utility>
+
+inline OrderedOutputStats::OrderedOutputStats()
+    : batches(0), records(0), producerWaits(0), maxPending(0), writeSeconds(0)
+{
+}
+
+template <typename T_Record>
+OrderedOutputQueue<T_Record>::OrderedOutputQueue(Emitter emit, const size_t maxPending,
+                                                 const bool ordered)
+    : emit_(emit)
+    , maxPending_(std::max(maxPending, static_cast<size_t>(1)))
+    , ordered_(ordered)
+    , nextBatch_(0)
+    , numArrivals_(0)
+    , closing_(false)
+    , error_(nullptr)
+{
+    writer_ = std::thread(&OrderedOutputQueue<T_Record>::WriteBatches, this);
+}
+
+template <typename T_Record>
+OrderedOutputQueue<T_Record>::~OrderedOutputQueue()
+{
+    try {
+        Close();
+    } catch (...) {
+        // Errors are reported by Put() and Close(), never by the destructor.
+    }
+}
+
+template <typename T_Record>
+void OrderedOutputQueue<T_Record>::Put(const uint64_t batchIndex, std::vector<T_Record> &records)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto canPut = [this, batchIndex] {
+        return error_ != nullptr or pending_.size() < maxPending_ or
+               (ordered_ and batchIndex == nextBatch_);
+    };
+    if (not canPut()) {
+        stats_.producerWaits++;
+        written_.wait(lock, canPut);
+    }
+    if (error_ != nullptr) std::rethrow_exception(error_);
+    assert(not closing_);
+
+    const uint64_t key = ordered_ ? batchIndex : numArrivals_;
+    numArrivals_++;
+    assert(ordered_ == false or (batchIndex >= nextBatch_ and pending_.count(key) == 0));
+    pending_[key].swap(records);
+    stats_.maxPending = std::max(stats_.maxPending, pending_.size());
+    lock.unlock();
+    put_.notify_one();
+}
+
+template <typename T_Record>
+void OrderedOutputQueue<T_Record>::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closing_ = true;
+    }
+    put_.notify_one();
+    if (writer_.joinable()) writer_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error_ != nullptr) std::rethrow_exception(error_);
+}
+
+template <typename T_Record>
+OrderedOutputStats OrderedOutputQueue<T_Record>::Stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+template <typename T_Record>
+bool OrderedOutputQueue<T_Record>::FirstBatchReady() const
+{
+    return not pending_.empty() and (not ordered_ or pending_.begin()->first == nextBatch_);
+}
+
+template <typename T_Record>
+void OrderedOutputQueue<T_Record>::WriteBatches()
+{
+    while (true) {
+        std::vector<T_Record> records;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            put_.wait(lock, [this] { return closing_ or FirstBatchReady(); });
+            // On close, batches after a missing index are still written.
+            if (pending_.empty()) return;
+            records.swap(pending_.begin()->second);
+            nextBatch_ = pending_.begin()->first + 1;
+            pending_.erase(pending_.begin());
+        }
+        written_.notify_all();
+
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            for (T_Record &record : records) {
+                emit_(record);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error_ = std::current_exception();
+            pending_.clear();
+            written_.notify_all();
+            return;
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.batches++;
+        stats_.records += records.size();
+        stats_.writeSeconds += elapsed.count();
+    }
+}
+
+#endif  // _BLASR_FORMAT_ORDERED_OUTPUT_QUEUE_IMPL_HPP_
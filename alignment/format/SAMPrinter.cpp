@@ -217,13 +217,57 @@ void SAMOutput::CreateNoClippingCigarOps(T_AlignmentCandidate &alignment, std::v
     }
 }
 
+namespace {
+// Two ascii digits of each number 0 to 99.
+const char twoDigits[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+}  // namespace
+
+void SAMOutput::AppendInteger(std::string &out, int64_t value)
+{
+    uint64_t absValue = static_cast<uint64_t>(value);
+    if (value < 0) {
+        out.push_back('-');
+        absValue = ~absValue + 1;
+    }
+    // Digits are written backwards from the end of buffer.
+    char buffer[20];
+    char *end = buffer + sizeof(buffer), *begin = end;
+    while (absValue >= 100) {
+        const int d = static_cast<int>(absValue % 100) * 2;
+        absValue /= 100;
+        *--begin = twoDigits[d + 1];
+        *--begin = twoDigits[d];
+    }
+    if (absValue >= 10) {
+        const int d = static_cast<int>(absValue) * 2;
+        *--begin = twoDigits[d + 1];
+        *--begin = twoDigits[d];
+    } else {
+        *--begin = static_cast<char>('0' + absValue);
+    }
+    out.append(begin, end);
+}
+
+void SAMOutput::AppendCigarOps(std::vector<int> &opSize, std::vector<char> &opChar,
+                               std::string &cigarString)
+{
+    assert(opSize.size() == opChar.size());
+    // Most ops take at most 4 characters.
+    cigarString.reserve(cigarString.size() + 4 * opSize.size());
+    for (size_t i = 0; i < opSize.size(); i++) {
+        AppendInteger(cigarString, opSize[i]);
+        cigarString.push_back(opChar[i]);
+    }
+}
+
 void SAMOutput::CigarOpsToString(std::vector<int> &opSize, std::vector<char> &opChar,
                                  std::string &cigarString)
 {
-    std::stringstream sstrm;
-    int i, nElem;
-    for (i = 0, nElem = opSize.size(); i < nElem; i++) {
-        sstrm << opSize[i] << opChar[i];
-    }
-    cigarString = sstrm.str();
+    cigarString.clear();
+    AppendCigarOps(opSize, opChar, cigarString);
 }
@@ -77,6 +77,12 @@ template <typename T_Sequence>
 void SetHardClip(T_AlignmentCandidate &alignment, T_Sequence &read, DNALength &prefixClip,
                  DNALength &suffixClip);
 
+// Append the decimal representation of value to out.
+void AppendInteger(std::string &out, int64_t value);
+
+// Append ops to cigarString, e.g. 3M1I2D.
+void AppendCigarOps(std::vector<int> &opSize, std::vector<char> &opChar, std::string &cigarString);
+
 void CigarOpsToString(std::vector<int> &opSize, std::vector<char> &opChar,
                       std::string &cigarString);
 
@@ -94,6 +100,17 @@ template <typename T_Sequence>
 void PrintAlignment(T_AlignmentCandidate &alignment, T_Sequence &read, std::ostream &samFile,
                     AlignmentContext &context, SupplementalQVList &qvList, Clipping clipping = none,
                     bool cigarUseSeqMatch = false, const bool allowAdjacentIndels = true);
+
+//
+// Same as PrintAlignment, but format the SAM line (with its newline)
+// into samRecord, so that alignments of different reads can be formatted
+// concurrently and written by an OrderedOutputQueue.
+//
+template <typename T_Sequence>
+void FormatAlignment(T_AlignmentCandidate &alignment, T_Sequence &read, std::string &samRecord,
+                     AlignmentContext &context, SupplementalQVList &qvList,
+                     Clipping clipping = none, bool cigarUseSeqMatch = false,
+                     const bool allowAdjacentIndels = true);
 }
 
 #include "SAMPrinterImpl.hpp"
@@ -91,27 +91,19 @@ void SAMOutput::CreateCIGARString(T_AlignmentCandidate &alignment, T_Sequence &r
                                   DNALength &prefixHardClip, DNALength &suffixHardClip,
                                   bool cigarUseSeqMatch, const bool allowAdjacentIndels)
 {
-
-    cigarString = "";
-    // All cigarString use the no clipping core
-    std::vector<int> opSize;
-    std::vector<char> opChar;
+    // All cigarString use the no clipping core. Ops are kept per thread
+    // so that their storage is reused from one alignment to the next.
+    thread_local std::vector<int> opSize;
+    thread_local std::vector<char> opChar;
     CreateNoClippingCigarOps(alignment, opSize, opChar, cigarUseSeqMatch, allowAdjacentIndels);
 
     // Clipping needs to be added
-
+    bool addClipping = false;
     if (clipping == hard) {
         SetHardClip(alignment, read, prefixHardClip, suffixHardClip);
-        if (prefixHardClip > 0) {
-            opSize.insert(opSize.begin(), prefixHardClip);
-            opChar.insert(opChar.begin(), 'H');
-        }
-        if (suffixHardClip > 0) {
-            opSize.push_back(suffixHardClip);
-            opChar.push_back('H');
-        }
         prefixSoftClip = 0;
         suffixSoftClip = 0;
+        addClipping = true;
     }
     if (clipping == soft or clipping == subread) {
         //
@@ -134,35 +126,31 @@ void SAMOutput::CreateCIGARString(T_AlignmentCandidate &alignment, T_Sequence &r
             std::swap(prefixHardClip, suffixHardClip);
             std::swap(prefixSoftClip, suffixSoftClip);
         }
-
-        //
-        // Insert the hard and soft clipping so that they are in the
-        // order H then S if both exist.
-        //
-        if (prefixSoftClip > 0) {
-            opSize.insert(opSize.begin(), prefixSoftClip);
-            opChar.insert(opChar.begin(), 'S');
-        }
-        if (prefixHardClip > 0) {
-            opSize.insert(opSize.begin(), prefixHardClip);
-            opChar.insert(opChar.begin(), 'H');
-        }
-
-        //
-        // Append the hard and soft clipping so they are in the order S
-        // then H.
-        //
-        if (suffixSoftClip > 0) {
-            opSize.push_back(suffixSoftClip);
-            opChar.push_back('S');
-        }
-        if (suffixHardClip > 0) {
-            opSize.push_back(suffixHardClip);
-            opChar.push_back('H');
-        }
+        addClipping = true;
     }
 
-    CigarOpsToString(opSize, opChar, cigarString);
+    //
+    // Write the clipping around the core ops, in the order H S on the
+    // prefix and S H on the suffix, if they exist.
+    //
+    cigarString.clear();
+    if (addClipping and prefixHardClip > 0) {
+        AppendInteger(cigarString, prefixHardClip);
+        cigarString.push_back('H');
+    }
+    if (addClipping and prefixSoftClip > 0) {
+        AppendInteger(cigarString, prefixSoftClip);
+        cigarString.push_back('S');
+    }
+    AppendCigarOps(opSize, opChar, cigarString);
+    if (addClipping and suffixSoftClip > 0) {
+        AppendInteger(cigarString, suffixSoftClip);
+        cigarString.push_back('S');
+    }
+    if (addClipping and suffixHardClip > 0) {
+        AppendInteger(cigarString, suffixHardClip);
+        cigarString.push_back('H');
+    }
 }
 
 template <typename T_Sequence>
@@ -182,16 +170,29 @@ void SAMOutput::PrintAlignment(T_AlignmentCandidate &alignment, T_Sequence &read
                       prefixHardClip, suffixHardClip, cigarUseSeqMatch, allowAdjacentIndels);
     SetAlignedSequence(alignment, read, alignedSequence, clipping);
     BuildFlag(alignment, context, flag);
-    samFile << alignment.qName << "\t" << flag << "\t" << alignment.tName << "\t";  // RNAME
+
+    //
+    // Fields are formatted into a per thread buffer and written with few
+    // stream calls, rather than one operator<< per field.
+    //
+    thread_local std::string samFields;
+    samFields.clear();
+    samFields.append(alignment.qName).push_back('\t');
+    AppendInteger(samFields, flag);
+    samFields.push_back('\t');
+    samFields.append(alignment.tName).push_back('\t');  // RNAME
     if (alignment.tStrand == 0) {
-        samFile << alignment.TAlignStart() + 1 << "\t";
         // POS, add 1 to get 1 based coordinate system
+        AppendInteger(samFields, alignment.TAlignStart() + 1);
     } else {
-        samFile << alignment.tLength - (alignment.TAlignStart() + alignment.TEnd()) + 1
-                << "\t";  // includes - 1 for rev-comp,  +1 for one-based
+        // includes - 1 for rev-comp,  +1 for one-based
+        AppendInteger(samFields,
+                      alignment.tLength - (alignment.TAlignStart() + alignment.TEnd()) + 1);
     }
-    samFile << (int)alignment.mapQV << "\t"  // MAPQ
-            << cigarString << "\t";          // CIGAR
+    samFields.push_back('\t');
+    AppendInteger(samFields, (int)alignment.mapQV);  // MAPQ
+    samFields.push_back('\t');
+    samFields.append(cigarString).push_back('\t');  // CIGAR
 
     //
     // Determine RNEXT
@@ -211,34 +212,37 @@ void SAMOutput::PrintAlignment(T_AlignmentCandidate &alignment, T_Sequence &read
       }
     }
     */
-    samFile << rNext << "\t";  // RNEXT
+    samFields.append(rNext).push_back('\t');  // RNEXT
 
     DNALength nextSubreadPos = 0;
     /*
     if (context.hasNextSubreadPos) {
       nextSubreadPos = context.nextSubreadPos + 1;
       }*/
-    samFile << nextSubreadPos << "\t";  // RNEXT, add 1 for 1 based
-                                        // indexing
+    AppendInteger(samFields, nextSubreadPos);  // RNEXT, add 1 for 1 based
+    samFields.push_back('\t');                 // indexing
 
     //DNALength tLen = alignment.GenomicTEnd() - alignment.GenomicTBegin();
     //SAM v1.5, tLen is set as 0 for single-segment template
-    samFile << 0 << "\t";  // TLEN
-    // Print the sequence on one line, and suppress printing the
-    // newline (by setting the line length to alignedSequence.length
-    (static_cast<DNASequence *>(&alignedSequence))->PrintSeq(samFile, 0);  // SEQ
-    samFile << "\t";
+    samFields.append("0\t");  // TLEN
+    // Print the sequence on one line.
+    samFields.append((char *)alignedSequence.seq, alignedSequence.length);  // SEQ
+    samFields.push_back('\t');
+    samFile.write(samFields.data(), samFields.size());
+    alignedSequence.LoadQVs(QualityValueTrack);
     if (alignedSequence.qual.data != NULL && qvList.useqv == 0) {
         alignedSequence.PrintAsciiQual(samFile, 0);  // QUAL
     } else {
-        samFile << "*";
+        samFile.put('*');
     }
-    samFile << "\t";
+    samFields.assign("\t");
     //
     // Add optional fields
     //
-    samFile << "RG:Z:" << context.readGroupId << "\t";
-    samFile << "AS:i:" << alignment.score << "\t";
+    samFields.append("RG:Z:").append(context.readGroupId).push_back('\t');
+    samFields.append("AS:i:");
+    AppendInteger(samFields, alignment.score);
+    samFields.push_back('\t');
 
     //
     // "RG" read group Id
@@ -256,8 +260,11 @@ void SAMOutput::PrintAlignment(T_AlignmentCandidate &alignment, T_Sequence &read
     DNALength qAlignEnd = alignment.QAlignEnd();
 
     if (clipping == none) {
-        samFile << "XS:i:" << qAlignStart + 1 << "\t";
-        samFile << "XE:i:" << qAlignEnd + 1 << "\t";
+        samFields.append("XS:i:");
+        AppendInteger(samFields, qAlignStart + 1);
+        samFields.append("\tXE:i:");
+        AppendInteger(samFields, qAlignEnd + 1);
+        samFields.push_back('\t');
     } else if (clipping == hard or clipping == soft or clipping == subread) {
         DNALength xs = prefixHardClip;
         DNALength xe = read.length - suffixHardClip;
@@ -265,22 +272,32 @@ void SAMOutput::PrintAlignment(T_AlignmentCandidate &alignment, T_Sequence &read
             xs = suffixHardClip;
             xe = read.length - prefixHardClip;
         }
-        samFile << "XS:i:" << xs + 1 << "\t";  // add 1 for 1-based indexing in sam
+        samFields.append("XS:i:");
+        AppendInteger(samFields, xs + 1);  // add 1 for 1-based indexing in sam
         assert(read.length - suffixHardClip == prefixHardClip + alignedSequence.length);
-        samFile << "XE:i:" << xe + 1 << "\t";
+        samFields.append("\tXE:i:");
+        AppendInteger(samFields, xe + 1);
+        samFields.push_back('\t');
     }
-    samFile << "YS:i:" << read.SubreadStart() << "\t";
-    samFile << "YE:i:" << read.SubreadEnd() << "\t";
-    samFile << "ZM:i:" << read.HoleNumber() << "\t";
-    samFile << "XL:i:" << alignment.qAlignedSeq.length << "\t";
-    samFile << "XT:i:1\t";  // reads are allways continuous reads, not
-                            // referenced based circular consensus when
-                            // output by blasr.
-    samFile << "NM:i:" << context.editDist << "\t";
-    samFile << "FI:i:" << alignment.qAlignedSeqPos + 1;
+    samFields.append("YS:i:");
+    AppendInteger(samFields, read.SubreadStart());
+    samFields.append("\tYE:i:");
+    AppendInteger(samFields, read.SubreadEnd());
+    samFields.append("\tZM:i:");
+    AppendInteger(samFields, read.HoleNumber());
+    samFields.append("\tXL:i:");
+    AppendInteger(samFields, alignment.qAlignedSeq.length);
+    samFields.append("\tXT:i:1\t");  // reads are allways continuous reads, not
+                                     // referenced based circular consensus when
+                                     // output by blasr.
+    samFields.append("NM:i:");
+    AppendInteger(samFields, context.editDist);
+    samFields.append("\tFI:i:");
+    AppendInteger(samFields, alignment.qAlignedSeqPos + 1);
     // Add query sequence length
-    samFile << "\t"
-            << "XQ:i:" << alignment.qLength;
+    samFields.append("\tXQ:i:");
+    AppendInteger(samFields, alignment.qLength);
+    samFile.write(samFields.data(), samFields.size());
 
     //
     // Write out optional quality values.  If qvlist does not
@@ -290,5 +307,21 @@ void SAMOutput::PrintAlignment(T_AlignmentCandidate &alignment, T_Sequence &read
     qvList.FormatQVOptionalFields(alignedSequence);
     qvList.PrintQVOptionalFields(alignedSequence, samFile);
 
-    samFile << std::endl;
+    // A newline rather than std::endl, which would flush every record.
+    samFile.put('\n');
+}
+
+template <typename T_Sequence>
+void SAMOutput::FormatAlignment(T_AlignmentCandidate &alignment, T_Sequence &read,
+                                std::string &samRecord, AlignmentContext &context,
+                                SupplementalQVList &qvList, Clipping clipping,
+                                bool cigarUseSeqMatch, const bool allowAdjacentIndels)
+{
+    // One buffer per formatting thread, reused across alignments.
+    thread_local std::ostringstream samBuffer;
+    samBuffer.str("");
+    samBuffer.clear();
+    PrintAlignment(alignment, read, samBuffer, context, qvList, clipping, cigarUseSeqMatch,
+                   allowAdjacentIndels);
+    samRecord = samBuffer.str();
 }
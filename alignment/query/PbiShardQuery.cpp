@@ -0,0 +1,66 @@
+#include <LibBlasrConfig.h>
+
+#ifdef USE_PBBAM
+
+#include <alignment/query/PbiShardQuery.h>
+#include <alignment/query/PbiShardZmwGroupQuery.h>
+
+using namespace PacBio;
+using namespace PacBio::BAM;
+using namespace PacBio::BAM::internal;
+
+struct PbiShardQuery::PbiShardQueryPrivate
+{
+public:
+    PbiShardQueryPrivate(const std::shared_ptr<const PbiZmwRanges>& index, const size_t shardIndex,
+                         const size_t numShards)
+        : query_(index, shardIndex, numShards), nextRecord_(0)
+    {
+    }
+
+    bool GetNext(BamRecord& record)
+    {
+        while (nextRecord_ >= records_.size()) {
+            if (not query_.GetNext(records_)) return false;
+            nextRecord_ = 0;
+        }
+        record = records_[nextRecord_++];
+        return true;
+    }
+
+public:
+    PbiShardZmwGroupQuery query_;
+
+    // Records of the current zmw, and the next one to return.
+    std::vector<BamRecord> records_;
+    size_t nextRecord_;
+};
+
+PbiShardQuery::PbiShardQuery(const DataSet& dataset, const size_t shardIndex,
+                             const size_t numShards)
+    : internal::IQuery()
+    , d_(new PbiShardQueryPrivate(
+          std::make_shared<const PbiZmwRanges>(PbiFilter::FromDataSet(dataset), dataset),
+          shardIndex, numShards))
+{
+}
+
+PbiShardQuery::PbiShardQuery(const PbiFilter& filter, const DataSet& dataset,
+                             const size_t shardIndex, const size_t numShards)
+    : internal::IQuery()
+    , d_(new PbiShardQueryPrivate(std::make_shared<const PbiZmwRanges>(filter, dataset), shardIndex,
+                                  numShards))
+{
+}
+
+PbiShardQuery::PbiShardQuery(const std::shared_ptr<const PbiZmwRanges>& index,
+                             const size_t shardIndex, const size_t numShards)
+    : internal::IQuery(), d_(new PbiShardQueryPrivate(index, shardIndex, numShards))
+{
+}
+
+PbiShardQuery::~PbiShardQuery(void) {}
+
+bool PbiShardQuery::GetNext(BamRecord& record) { return d_->GetNext(record); }
+
+#endif
@@ -0,0 +1,45 @@
+#include <LibBlasrConfig.h>
+
+#ifdef USE_PBBAM
+#ifndef PBISHARD_QUERY_H
+#define PBISHARD_QUERY_H
+
+#include <memory>
+
+#include <pbbam/PbiFilter.h>
+#include <pbbam/internal/QueryBase.h>
+
+#include <alignment/query/PbiZmwRanges.h>
+
+namespace PacBio {
+namespace BAM {
+
+/// This class iterates over records of the shardIndex-th of numShards shards
+/// of a pbi-indexed dataset, one record at a time, in file order.
+///
+/// \note Shards are the same as those of PbiShardZmwGroupQuery.
+///
+class PBBAM_EXPORT PbiShardQuery : public internal::IQuery
+{
+public:
+    PbiShardQuery(const DataSet& dataset, const size_t shardIndex, const size_t numShards);
+    PbiShardQuery(const PbiFilter& filter, const DataSet& dataset, const size_t shardIndex,
+                  const size_t numShards);
+    /// Read a shard of an already loaded index, see PbiShardZmwGroupQuery.
+    PbiShardQuery(const std::shared_ptr<const PbiZmwRanges>& index, const size_t shardIndex,
+                  const size_t numShards);
+    ~PbiShardQuery(void);
+
+public:
+    bool GetNext(BamRecord& record);
+
+private:
+    struct PbiShardQueryPrivate;
+    std::unique_ptr<PbiShardQueryPrivate> d_;
+};
+
+}  // namespace BAM
+}  // namespace PacBio
+
+#endif  // PBISHARD_QUERY_H
+#endif
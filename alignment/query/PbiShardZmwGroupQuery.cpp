@@ -0,0 +1,109 @@
+#include <LibBlasrConfig.h>
+
+#ifdef USE_PBBAM
+
+#include <alignment/query/PbiShardZmwGroupQuery.h>
+#include <alignment/query/PbiZmwRanges.h>
+
+#include <pbbam/BamReader.h>
+
+#include <cassert>
+
+using namespace PacBio;
+using namespace PacBio::BAM;
+using namespace PacBio::BAM::internal;
+
+struct PbiShardZmwGroupQuery::PbiShardZmwGroupQueryPrivate
+{
+public:
+    PbiShardZmwGroupQueryPrivate(const std::shared_ptr<const PbiZmwRanges>& index,
+                                 const size_t shardIndex, const size_t numShards)
+        : index_(index)
+        , ranges_(index_->Shard(shardIndex, numShards))
+        , readerFileIndex_(0)
+        , curRange_(0)
+        , curRow_(0)
+        , seeked_(false)
+    {
+    }
+
+    bool GetNext(std::vector<BamRecord>& records)
+    {
+        records.clear();
+
+        BamRecord record;
+        while (curRange_ < ranges_.size()) {
+            const PbiRowRange& range = ranges_[curRange_];
+            if (not seeked_) {
+                if (reader_ == nullptr or readerFileIndex_ != range.fileIndex) {
+                    reader_.reset(new BamReader(index_->Files()[range.fileIndex]));
+                    readerFileIndex_ = range.fileIndex;
+                }
+                reader_->VirtualSeek(range.virtualOffset);
+                curRow_ = range.beginRow;
+                seeked_ = true;
+            }
+
+            while (curRow_ < range.endRow) {
+                // Stop before the first record of the next zmw.
+                if (not records.empty() and index_->IsZmwStart(range.fileIndex, curRow_))
+                    return true;
+                if (not reader_->GetNext(record)) {
+                    curRow_ = range.endRow;
+                    break;
+                }
+                if (index_->Accepts(range.fileIndex, curRow_)) records.push_back(record);
+                curRow_++;
+            }
+
+            curRange_++;
+            seeked_ = false;
+            if (not records.empty()) return true;
+        }
+        return false;
+    }
+
+public:
+    std::shared_ptr<const PbiZmwRanges> index_;
+    std::vector<PbiRowRange> ranges_;
+
+    std::unique_ptr<BamReader> reader_;
+    size_t readerFileIndex_;
+
+    // Position of the next record to read.
+    size_t curRange_;
+    size_t curRow_;
+    bool seeked_;
+};
+
+PbiShardZmwGroupQuery::PbiShardZmwGroupQuery(const DataSet& dataset, const size_t shardIndex,
+                                             const size_t numShards)
+    : internal::IGroupQuery()
+    , d_(new PbiShardZmwGroupQueryPrivate(
+          std::make_shared<const PbiZmwRanges>(PbiFilter::FromDataSet(dataset), dataset),
+          shardIndex, numShards))
+{
+}
+
+PbiShardZmwGroupQuery::PbiShardZmwGroupQuery(const PbiFilter& filter, const DataSet& dataset,
+                                             const size_t shardIndex, const size_t numShards)
+    : internal::IGroupQuery()
+    , d_(new PbiShardZmwGroupQueryPrivate(std::make_shared<const PbiZmwRanges>(filter, dataset),
+                                          shardIndex, numShards))
+{
+}
+
+PbiShardZmwGroupQuery::PbiShardZmwGroupQuery(const std::shared_ptr<const PbiZmwRanges>& index,
+                                             const size_t shardIndex, const size_t numShards)
+    : internal::IGroupQuery(), d_(new PbiShardZmwGroupQueryPrivate(index, shardIndex, numShards))
+{
+}
+
+PbiShardZmwGroupQuery::~PbiShardZmwGroupQuery(void) {}
+
+bool PbiShardZmwGroupQuery::GetNext(std::vector<BamRecord>& records)
+{
+    return d_->GetNext(records);
+}
+
+#endif
@@ -0,0 +1,52 @@
+#include <LibBlasrConfig.h>
+
+#ifdef USE_PBBAM
+#ifndef PBISHARD_ZMWGROUPQUERY_H
+#define PBISHARD_ZMWGROUPQUERY_H
+
+#include <memory>
+
+#include <pbbam/PbiFilter.h>
+#include <pbbam/internal/QueryBase.h>
+
+#include <alignment/query/PbiZmwRanges.h>
+
+namespace PacBio {
+namespace BAM {
+
+/// This class operates on pbi-indexed BAM files, with each iteration of the query
+/// returning each contiguous block of records that share a zmw, restricted to
+/// the shardIndex-th of numShards shards of the dataset.
+///
+/// Shards are balanced by number of bases and never split a zmw (see
+/// PbiZmwRanges::Shard). The query seeks directly to the start of its shard,
+/// so processing one shard takes time proportional to the shard, not to the
+/// BAM files.
+///
+/// \note Iterate over zmws, return vector of subreads of a zmw each time.
+///
+class PBBAM_EXPORT PbiShardZmwGroupQuery : public internal::IGroupQuery
+{
+public:
+    PbiShardZmwGroupQuery(const DataSet& dataset, const size_t shardIndex, const size_t numShards);
+    PbiShardZmwGroupQuery(const PbiFilter& filter, const DataSet& dataset, const size_t shardIndex,
+                          const size_t numShards);
+    /// Read a shard of an already loaded index, which may be shared with
+    /// other queries and readers of the same dataset.
+    PbiShardZmwGroupQuery(const std::shared_ptr<const PbiZmwRanges>& index, const size_t shardIndex,
+                          const size_t numShards);
+    ~PbiShardZmwGroupQuery(void);
+
+public:
+    bool GetNext(std::vector<BamRecord>& records);
+
+private:
+    struct PbiShardZmwGroupQueryPrivate;
+    std::unique_ptr<PbiShardZmwGroupQueryPrivate> d_;
+};
+
+}  // namespace BAM
+}  // namespace PacBio
+
+#endif  // PBISHARD_ZMWGROUPQUERY_H
+#endif
@@ -0,0 +1,201 @@
+#include <LibBlasrConfig.h>
+
+#ifdef USE_PBBAM
+
+#include <alignment/query/PbiZmwRanges.h>
+
+#include <pbbam/PbiRawData.h>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+using namespace PacBio;
+using namespace PacBio::BAM;
+
+PbiZmwRanges::PbiZmwRanges(const DataSet& dataset) : numRecords_(0)
+{
+    Load(PbiFilter::FromDataSet(dataset), dataset);
+}
+
+PbiZmwRanges::PbiZmwRanges(const PbiFilter& filter, const DataSet& dataset) : numRecords_(0)
+{
+    Load(filter, dataset);
+}
+
+bool PbiZmwRanges::IndexesExist(const DataSet& dataset)
+{
+    const std::vector<BamFile> files = dataset.BamFiles();
+    if (files.empty()) return false;
+    for (const BamFile& file : files) {
+        if (not file.PacBioIndexExists()) return false;
+    }
+    return true;
+}
+
+void PbiZmwRanges::Load(const PbiFilter& filter, const DataSet& dataset)
+{
+    files_ = dataset.BamFiles();
+    fileOffsets_.resize(files_.size());
+    readGroupIds_.resize(files_.size());
+    holeNumbers_.resize(files_.size());
+    readLengths_.resize(files_.size());
+    accepted_.resize(files_.size());
+
+    for (size_t i = 0; i < files_.size(); i++) {
+        const PbiRawData index(files_[i].PacBioIndexFilename());
+        const PbiRawBasicData& basic = index.BasicData();
+        const size_t numReads = index.NumReads();
+
+        fileOffsets_[i] = basic.fileOffset_;
+        readGroupIds_[i] = basic.rgId_;
+        holeNumbers_[i] = basic.holeNumber_;
+        readLengths_[i].resize(numReads);
+        accepted_[i].resize(numReads);
+        for (size_t row = 0; row < numReads; row++) {
+            readLengths_[i][row] = static_cast<uint32_t>(basic.qEnd_[row] - basic.qStart_[row]);
+            accepted_[i][row] = filter.Accepts(index, row);
+            if (accepted_[i][row]) numRecords_++;
+        }
+    }
+}
+
+const std::vector<BamFile>& PbiZmwRanges::Files(void) const { return files_; }
+
+bool PbiZmwRanges::Accepts(const size_t fileIndex, const size_t row) const
+{
+    return accepted_[fileIndex][row];
+}
+
+size_t PbiZmwRanges::NumRecords(void) const { return numRecords_; }
+
+bool PbiZmwRanges::IsZmwStart(const size_t fileIndex, const size_t row) const
+{
+    if (row == 0) return true;
+    return (holeNumbers_[fileIndex][row] != holeNumbers_[fileIndex][row - 1] or
+            readGroupIds_[fileIndex][row] != readGroupIds_[fileIndex][row - 1]);
+}
+
+PbiRowRange PbiZmwRanges::MakeRange(const size_t fileIndex, const size_t beginRow,
+                                    const size_t endRow) const
+{
+    assert(beginRow < endRow and endRow <= fileOffsets_[fileIndex].size());
+    PbiRowRange range;
+    range.fileIndex = fileIndex;
+    range.beginRow = beginRow;
+    range.endRow = endRow;
+    range.virtualOffset = fileOffsets_[fileIndex][beginRow];
+    range.numRecords = 0;
+    range.numBases = 0;
+    for (size_t row = beginRow; row < endRow; row++) {
+        if (accepted_[fileIndex][row]) {
+            range.numRecords++;
+            range.numBases += readLengths_[fileIndex][row];
+        }
+    }
+    return range;
+}
+
+void PbiZmwRanges::Split(const size_t fileIndex, const size_t beginRow, const size_t endRow,
+                         const size_t maxRecords, std::vector<PbiRowRange>& ranges) const
+{
+    size_t rangeBegin = beginRow;
+    size_t numAccepted = 0;
+    for (size_t row = beginRow; row < endRow; row++) {
+        // Cut before a new zmw once this range is full.
+        if (numAccepted >= maxRecords and IsZmwStart(fileIndex, row)) {
+            ranges.push_back(MakeRange(fileIndex, rangeBegin, row));
+            rangeBegin = row;
+            numAccepted = 0;
+        }
+        // Leading rows rejected by the filter need not be read at all.
+        if (numAccepted == 0 and not accepted_[fileIndex][row]) {
+            rangeBegin = row + 1;
+            continue;
+        }
+        if (accepted_[fileIndex][row]) numAccepted++;
+    }
+    if (numAccepted > 0) ranges.push_back(MakeRange(fileIndex, rangeBegin, endRow));
+}
+
+std::vector<PbiRowRange> PbiZmwRanges::SplitByRecords(const size_t maxRecords) const
+{
+    std::vector<PbiRowRange> ranges;
+    for (size_t i = 0; i < files_.size(); i++) {
+        Split(i, 0, fileOffsets_[i].size(), maxRecords, ranges);
+    }
+    return ranges;
+}
+
+std::vector<PbiRowRange> PbiZmwRanges::SplitByRecords(const size_t maxRecords,
+                                                      const std::vector<PbiRowRange>& within) const
+{
+    std::vector<PbiRowRange> ranges;
+    for (const PbiRowRange& range : within) {
+        Split(range.fileIndex, range.beginRow, range.endRow, maxRecords, ranges);
+    }
+    return ranges;
+}
+
+std::vector<PbiRowRange> PbiZmwRanges::Shard(const size_t shardIndex,
+                                             const size_t numShards) const
+{
+    assert(numShards > 0 and shardIndex < numShards);
+
+    uint64_t totalBases = 0;
+    for (size_t i = 0; i < files_.size(); i++) {
+        for (size_t row = 0; row < accepted_[i].size(); row++) {
+            if (accepted_[i][row]) totalBases += readLengths_[i][row];
+        }
+    }
+
+    std::vector<PbiRowRange> ranges;
+    uint64_t basesBefore = 0;  // accepted bases before the current zmw
+    for (size_t i = 0; i < files_.size(); i++) {
+        const size_t numRows = accepted_[i].size();
+        size_t beginRow = numRows, endRow = numRows;
+        uint64_t zmwBases = 0;
+        size_t zmwShard = 0;
+        for (size_t row = 0; row < numRows; row++) {
+            if (IsZmwStart(i, row)) {
+                basesBefore += zmwBases;
+                zmwBases = 0;
+                // Shard of the zmw in which its first base falls.
+                zmwShard = (totalBases == 0)
+                               ? 0
+                               : static_cast<size_t>((static_cast<long double>(basesBefore) *
+                                                      numShards) /
+                                                     totalBases);
+                zmwShard = std::min(zmwShard, numShards - 1);
+                if (zmwShard == shardIndex and beginRow == numRows) beginRow = row;
+                if (zmwShard > shardIndex and beginRow != numRows and endRow == numRows)
+                    endRow = row;
+            }
+            if (accepted_[i][row]) zmwBases += readLengths_[i][row];
+        }
+        basesBefore += zmwBases;
+        if (beginRow < endRow) {
+            const PbiRowRange range = MakeRange(i, beginRow, endRow);
+            if (range.numRecords > 0) ranges.push_back(range);
+        }
+        if (zmwShard > shardIndex) break;  // later files belong to later shards
+    }
+    return ranges;
+}
+
+std::vector<BamRecord> PbiZmwRanges::ReadRange(BamReader& reader, const PbiRowRange& range) const
+{
+    std::vector<BamRecord> records;
+    records.reserve(range.numRecords);
+    reader.VirtualSeek(range.virtualOffset);
+    for (size_t row = range.beginRow; row < range.endRow; row++) {
+        // A record is read into a new BamRecord and moved into the range,
+        // since a moved-from BamRecord can not be read into again.
+        BamRecord record;
+        if (not reader.GetNext(record)) break;
+        if (accepted_[range.fileIndex][row]) records.push_back(std::move(record));
+    }
+    return records;
+}
+
+#endif
@@ -0,0 +1,113 @@
+#include <LibBlasrConfig.h>
+
+#ifdef USE_PBBAM
+#ifndef PBI_ZMWRANGES_H
+#define PBI_ZMWRANGES_H
+
+#include <cstdint>
+#include <vector>
+
+#include <pbbam/BamFile.h>
+#include <pbbam/BamReader.h>
+#include <pbbam/BamRecord.h>
+#include <pbbam/DataSet.h>
+#include <pbbam/PbiFilter.h>
+
+namespace PacBio {
+namespace BAM {
+
+/// A contiguous run of .pbi rows of one BAM file. Ranges never split the
+/// subreads of a zmw, so each range can be read and grouped independently.
+struct PbiRowRange
+{
+    /// Index of the BAM file in PbiZmwRanges::Files().
+    size_t fileIndex;
+    /// First row of this range in the .pbi of the BAM file.
+    size_t beginRow;
+    /// One past the last row of this range.
+    size_t endRow;
+    /// BGZF virtual offset of the record at beginRow.
+    int64_t virtualOffset;
+    /// Number of records in [beginRow, endRow) accepted by the filter.
+    size_t numRecords;
+    /// Number of bases of accepted records in [beginRow, endRow).
+    uint64_t numBases;
+};
+
+/// Loads the .pbi of every BAM file in a dataset, and partitions records
+/// into zmw-aligned row ranges with BGZF virtual offsets, so that ranges
+/// can be read by seeking directly rather than by scanning from the start.
+///
+/// \note Records of a zmw are assumed to be stored contiguously, as they
+///       are in movie.subreads.bam.
+///
+class PBBAM_EXPORT PbiZmwRanges
+{
+public:
+    PbiZmwRanges(const DataSet& dataset);
+    PbiZmwRanges(const PbiFilter& filter, const DataSet& dataset);
+
+    /// \returns true if every BAM file in dataset has a .pbi index.
+    static bool IndexesExist(const DataSet& dataset);
+
+public:
+    /// \returns BAM files of the dataset, in dataset order.
+    const std::vector<BamFile>& Files(void) const;
+
+    /// \returns true if row of the fileIndex-th BAM file passes the filter.
+    bool Accepts(const size_t fileIndex, const size_t row) const;
+
+    /// \returns total number of accepted records over all BAM files.
+    size_t NumRecords(void) const;
+
+    /// \returns true if row begins a new zmw in the fileIndex-th BAM file.
+    bool IsZmwStart(const size_t fileIndex, const size_t row) const;
+
+    /// Split all accepted records into consecutive ranges, each holding
+    /// about maxRecords records. A zmw is never split, so a range may
+    /// exceed maxRecords when a single zmw has more subreads than that.
+    std::vector<PbiRowRange> SplitByRecords(const size_t maxRecords) const;
+
+    /// Same as SplitByRecords(maxRecords), restricted to the given ranges.
+    std::vector<PbiRowRange> SplitByRecords(const size_t maxRecords,
+                                            const std::vector<PbiRowRange>& within) const;
+
+    /// Partition zmws into numShards consecutive shards with about the same
+    /// number of accepted bases (not reads), and return the shardIndex-th.
+    /// A zmw belongs to the shard in which its first base falls, so shards
+    /// are disjoint, cover all zmws, and are identical across processes.
+    /// \returns row ranges of the shard, at most one per BAM file.
+    std::vector<PbiRowRange> Shard(const size_t shardIndex, const size_t numShards) const;
+
+    /// Seek reader to the start of range, then read all records in range,
+    /// skipping records rejected by the filter.
+    /// \returns accepted records in file order.
+    std::vector<BamRecord> ReadRange(BamReader& reader, const PbiRowRange& range) const;
+
+private:
+    void Load(const PbiFilter& filter, const DataSet& dataset);
+
+    /// \returns a range of fileIndex-th BAM file covering [beginRow, endRow).
+    PbiRowRange MakeRange(const size_t fileIndex, const size_t beginRow, const size_t endRow) const;
+
+    /// Append ranges of about maxRecords records covering accepted
+    /// records in [beginRow, endRow) of the fileIndex-th BAM file.
+    void Split(const size_t fileIndex, const size_t beginRow, const size_t endRow,
+               const size_t maxRecords, std::vector<PbiRowRange>& ranges) const;
+
+private:
+    std::vector<BamFile> files_;
+    // Per BAM file, per .pbi row.
+    std::vector<std::vector<int64_t>> fileOffsets_;
+    std::vector<std::vector<int32_t>> readGroupIds_;
+    std::vector<std::vector<int32_t>> holeNumbers_;
+    std::vector<std::vector<uint32_t>> readLengths_;
+    std::vector<std::vector<bool>> accepted_;
+    size_t numRecords_;
+};
+
+}  // namespace BAM
+}  // namespace PacBio
+
+#endif  // PBI_ZMWRANGES_H
+#endif
@@ -2,6 +2,7 @@
 
 void QualitySample::CopyFromSequence(SMRTSequence &seq, int pos)
 {
+    seq.LoadQVs(AllQVTracks);
     qv[0] = seq.qual[pos];
     qv[1] = seq.deletionQV[pos];
     qv[2] = seq.insertionQV[pos];
@@ -45,6 +46,7 @@ void QualitySample::CreateFromRead(SMRTSequence &seq, DNALength pos)
      * 2 WidthInFrames
      */
     //		qv.resize(4);
+    seq.LoadQVs(AllQVTracks);
     std::fill(&qv[0], &qv[NQV], 0);
     if (seq.qual.Empty() == false) {
         qv[0] = seq.qual[pos];
@@ -3,6 +3,7 @@
 
 #include <alignment/tuples/TupleList.hpp>
 #include <alignment/tuples/TupleMetrics.hpp>
+#include <alignment/tuples/TuplePositionIndex.hpp>
 #include <pbdata/DNASequence.hpp>
 
 template <typename T_Tuple>
@@ -54,6 +55,6 @@ public:
 template <typename T_Tuple>
 void SequenceToHash(DNASequence &seq, HashedTupleList<T_Tuple> &hash, TupleMetrics &tm);
 
-#include "HashedTupleList.hpp"
+#include "HashedTupleListImpl.hpp"
 
 #endif
@@ -120,16 +120,16 @@ int HashedTupleList<T_Tuple>::GetHashLength()
 template <typename T_Tuple>
 void SequenceToHash(DNASequence &seq, HashedTupleList<T_Tuple> &hash, TupleMetrics &tm)
 {
-
-    int i;
+    //
+    // Roll tuples over seq and append them to their buckets, then sort
+    // each bucket once, instead of a sorted insert per tuple.
+    //
     T_Tuple tuple;
-    int res = 0;
-    for (i = 0; i < seq.length - hash.hashLength + 1; i++) {
-        if ((res and (res = tuple.ShiftAddRL(seq.seq[i + tm.tupleSize - 1], tm))) or
-            (!res and (res = tuple.FromStringRL(&seq.seq[i], tm)))) {
-            hash.Insert(tuple);
-        }
-    }
+    ForEachTupleRL(seq.seq, seq.length, tm, [&hash, &tuple](DNALength, TupleData tupleData) {
+        tuple.tuple = tupleData;
+        hash.hashTable[tupleData & hash.mask].tupleList.push_back(tuple);
+    });
+    hash.Sort();
 }
 
 #endif
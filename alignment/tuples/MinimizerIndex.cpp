@@ -0,0 +1,182 @@
+#include <alignment/tuples/MinimizerIndex.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// "BLASRMIN"
+const uint64_t MinimizerIndex::Magic = 0x4e494d5253414c42ULL;
+
+MinimizerIndex::MinimizerIndex()
+    : k_(0)
+    , w_(0)
+    , nMinimizers_(0)
+    , nPositions_(0)
+    , hashes_(NULL)
+    , offsets_(NULL)
+    , positions_(NULL)
+    , mappedFile_(NULL)
+    , mappedSize_(0)
+{
+}
+
+MinimizerIndex::~MinimizerIndex() { Free(); }
+
+void MinimizerIndex::Build(const Nucleotide *seq, DNALength length, int k, int w)
+{
+    std::vector<std::pair<DNALength, DNALength> > contigs(1, std::make_pair(0, length));
+    BuildContigs(seq, contigs, k, w);
+}
+
+void MinimizerIndex::BuildContigs(const Nucleotide *seq,
+                                  const std::vector<std::pair<DNALength, DNALength> > &contigs,
+                                  int k, int w)
+{
+    assert(k > 0 and k <= 32 and w > 0);
+    Free();
+    k_ = k;
+    w_ = w;
+    TupleMetrics tm;
+    tm.tupleSize = k;
+
+    std::vector<std::pair<TupleData, DNALength> > minimizers;
+    for (size_t c = 0; c < contigs.size(); c++) {
+        DNALength start = contigs[c].first;
+        ForEachMinimizer(&seq[start], contigs[c].second - start, tm, w,
+                         [&](DNALength pos, TupleData hash) {
+                             minimizers.push_back(std::make_pair(hash, start + pos));
+                         });
+    }
+    std::sort(minimizers.begin(), minimizers.end());
+
+    positionBuffer_.resize(minimizers.size());
+    for (size_t i = 0; i < minimizers.size(); i++) {
+        if (i == 0 or minimizers[i].first != minimizers[i - 1].first) {
+            hashBuffer_.push_back(minimizers[i].first);
+            offsetBuffer_.push_back(i);
+        }
+        positionBuffer_[i] = minimizers[i].second;
+    }
+    offsetBuffer_.push_back(minimizers.size());
+
+    nMinimizers_ = hashBuffer_.size();
+    nPositions_ = positionBuffer_.size();
+    hashes_ = hashBuffer_.data();
+    offsets_ = offsetBuffer_.data();
+    positions_ = positionBuffer_.data();
+}
+
+void MinimizerIndex::Write(const std::string &fileName) const
+{
+    std::ofstream out(fileName.c_str(), std::ios::out | std::ios::binary);
+    if (not out) {
+        std::cout << "ERROR, could not open minimizer index " << fileName << " for writing."
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    Header header;
+    header.magic = Magic;
+    header.k = k_;
+    header.w = w_;
+    header.nMinimizers = nMinimizers_;
+    header.nPositions = nPositions_;
+    out.write((const char *)&header, sizeof(Header));
+    out.write((const char *)hashes_, sizeof(TupleData) * nMinimizers_);
+    // An index that was never built still has the offset of its end.
+    const uint64_t noOffsets = 0;
+    out.write((const char *)(offsets_ != NULL ? offsets_ : &noOffsets),
+              sizeof(uint64_t) * (nMinimizers_ + 1));
+    out.write((const char *)positions_, sizeof(DNALength) * nPositions_);
+}
+
+void MinimizerIndex::Read(const std::string &fileName)
+{
+    Free();
+    int fileDes = open(fileName.c_str(), O_RDONLY);
+    if (fileDes < 0) {
+        std::cout << "ERROR, could not open minimizer index " << fileName << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    struct stat fileStat;
+    fstat(fileDes, &fileStat);
+    size_t fileSize = fileStat.st_size;
+    void *filePtr = MAP_FAILED;
+    if (fileSize >= sizeof(Header)) {
+        filePtr = mmap(0, fileSize, PROT_READ, MAP_PRIVATE, fileDes, 0);
+    }
+    close(fileDes);
+    if (filePtr == MAP_FAILED) {
+        std::cout << "ERROR, Fail to load minimizer index " << fileName << " to virtual memory."
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    const Header *header = (const Header *)filePtr;
+    const char *data = (const char *)filePtr + sizeof(Header);
+    if (header->magic != Magic or
+        fileSize !=
+            sizeof(Header) + sizeof(TupleData) * header->nMinimizers +
+                sizeof(uint64_t) * (header->nMinimizers + 1) +
+                sizeof(DNALength) * header->nPositions) {
+        munmap(filePtr, fileSize);
+        std::cout << "ERROR, " << fileName << " is not a minimizer index." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    mappedFile_ = filePtr;
+    mappedSize_ = fileSize;
+    k_ = header->k;
+    w_ = header->w;
+    nMinimizers_ = header->nMinimizers;
+    nPositions_ = header->nPositions;
+    hashes_ = (const TupleData *)data;
+    offsets_ = (const uint64_t *)(data + sizeof(TupleData) * nMinimizers_);
+    positions_ = (const DNALength *)(data + sizeof(TupleData) * nMinimizers_ +
+                                     sizeof(uint64_t) * (nMinimizers_ + 1));
+}
+
+void MinimizerIndex::Free()
+{
+    if (mappedFile_ != NULL) {
+        munmap(mappedFile_, mappedSize_);
+        mappedFile_ = NULL;
+        mappedSize_ = 0;
+    }
+    std::vector<TupleData>().swap(hashBuffer_);
+    std::vector<uint64_t>().swap(offsetBuffer_);
+    std::vector<DNALength>().swap(positionBuffer_);
+    k_ = w_ = 0;
+    nMinimizers_ = nPositions_ = 0;
+    hashes_ = NULL;
+    offsets_ = NULL;
+    positions_ = NULL;
+}
+
+int MinimizerIndex::TupleSize() const { return k_; }
+
+int MinimizerIndex::WindowSize() const { return w_; }
+
+size_t MinimizerIndex::NumMinimizers() const { return nMinimizers_; }
+
+size_t MinimizerIndex::size() const { return nPositions_; }
+
+void MinimizerIndex::FindAll(TupleData hash, const DNALength *&begin, const DNALength *&end) const
+{
+    begin = end = positions_;
+    if (nMinimizers_ == 0) {
+        return;
+    }
+    const TupleData *it = std::lower_bound(hashes_, hashes_ + nMinimizers_, hash);
+    if (it == hashes_ + nMinimizers_ or *it != hash) {
+        return;
+    }
+    size_t i = it - hashes_;
+    begin = positions_ + offsets_[i];
+    end = positions_ + offsets_[i + 1];
+}
@@ -0,0 +1,189 @@
+#ifndef _BLASR_MINIMIZER_INDEX_HPP_
+#define _BLASR_MINIMIZER_INDEX_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pbdata/Types.h>
+#include <alignment/tuples/TupleMetrics.hpp>
+#include <alignment/tuples/TuplePositionIndex.hpp>
+
+//
+// Invertible mix of the 2*tupleSize bits of a tuple, so that minimizers
+// are spread over the tuples rather than biased to poly-A.  Distinct
+// tuples have distinct hashes.
+//
+inline TupleData HashTuple(TupleData tuple, TupleData mask)
+{
+    tuple = (~tuple + (tuple << 21)) & mask;
+    tuple = tuple ^ (tuple >> 24);
+    tuple = (tuple + (tuple << 3) + (tuple << 8)) & mask;
+    tuple = tuple ^ (tuple >> 14);
+    tuple = (tuple + (tuple << 2) + (tuple << 4)) & mask;
+    tuple = tuple ^ (tuple >> 28);
+    tuple = (tuple + (tuple << 31)) & mask;
+    return tuple;
+}
+
+inline TupleData HashTupleMask(int tupleSize)
+{
+    return (tupleSize >= 32) ? ~static_cast<TupleData>(0)
+                             : (static_cast<TupleData>(1) << (2 * tupleSize)) - 1;
+}
+
+//
+// Call f(pos, hash) for the (w,k) minimizers of seq[0, length), in order
+// of pos: the tuple with the smallest hash in each window of w
+// consecutive tuples, the leftmost one on ties.  A minimizer shared by
+// consecutive windows is reported once.  Windows do not span an N, and
+// a run of fewer than w tuples between Ns reports its smallest tuple.
+//
+template <typename T_Function>
+void ForEachMinimizer(const Nucleotide *seq, DNALength length, const TupleMetrics &tm, int w,
+                      T_Function f)
+{
+    const TupleData mask = HashTupleMask(tm.tupleSize);
+    std::deque<std::pair<TupleData, DNALength> > window;
+    DNALength runStart = 0, runEnd = 0;
+    bool inRun = false, reported = false;
+    DNALength lastReported = 0;
+
+    auto report = [&](const std::pair<TupleData, DNALength> &minimizer) {
+        if (reported and lastReported == minimizer.second) {
+            return;
+        }
+        f(minimizer.second, minimizer.first);
+        reported = true;
+        lastReported = minimizer.second;
+    };
+    auto endRun = [&]() {
+        if (inRun and runEnd - runStart < static_cast<DNALength>(w)) {
+            report(window.front());
+        }
+        window.clear();
+        inRun = false;
+    };
+
+    ForEachTupleRL(seq, length, tm, [&](DNALength pos, TupleData tuple) {
+        if (inRun and pos != runEnd) {
+            endRun();
+        }
+        if (not inRun) {
+            runStart = pos;
+            inRun = true;
+        }
+        runEnd = pos + 1;
+        TupleData hash = HashTuple(tuple, mask);
+        while (not window.empty() and window.back().first > hash) {
+            window.pop_back();
+        }
+        window.push_back(std::make_pair(hash, pos));
+        if (runEnd - runStart >= static_cast<DNALength>(w)) {
+            while (window.front().second + w <= pos) {
+                window.pop_front();
+            }
+            report(window.front());
+        }
+    });
+    endRun();
+}
+
+//
+// The (w,k) minimizers of a reference and the positions they occur at,
+// for sparse seeding: a read is anchored by looking up only its own
+// minimizers, roughly 2/(w+1) of its tuples, rather than every position.
+//
+// The index is three flat arrays, the distinct minimizer hashes in
+// increasing order, the offset of the positions of each hash, and the
+// positions, so that a file written by Write() is used in place by
+// mapping it into memory with Read().
+//
+class MinimizerIndex
+{
+public:
+    MinimizerIndex();
+
+    ~MinimizerIndex();
+
+    MinimizerIndex(const MinimizerIndex &) = delete;
+    MinimizerIndex &operator=(const MinimizerIndex &) = delete;
+
+    // Index seq[0, length) as a single contig.
+    void Build(const Nucleotide *seq, DNALength length, int k, int w);
+
+    //
+    // Index a concatenated reference whose contigs are given by a
+    // SequenceIndexDatabase.  Windows do not span contigs, and positions
+    // are in the concatenated reference.
+    //
+    template <typename T_SequenceDB>
+    void Build(const Nucleotide *seq, DNALength length, T_SequenceDB &seqDB, int k, int w)
+    {
+        std::vector<std::pair<DNALength, DNALength> > contigs;
+        for (int i = 0; i < seqDB.nSeqPos - 1; i++) {
+            DNALength start = seqDB.seqStartPos[i];
+            DNALength end = start + seqDB.GetLengthOfSeq(i);
+            if (start < length) {
+                contigs.push_back(std::make_pair(start, std::min(end, length)));
+            }
+        }
+        BuildContigs(seq, contigs, k, w);
+    }
+
+    void Write(const std::string &fileName) const;
+
+    // Map an index written by Write() into memory, read only.
+    void Read(const std::string &fileName);
+
+    void Free();
+
+    int TupleSize() const;
+
+    int WindowSize() const;
+
+    // Number of distinct minimizers.
+    size_t NumMinimizers() const;
+
+    // Number of positions in the index.
+    size_t size() const;
+
+    // Set [begin, end) to the positions, in increasing order, of the
+    // minimizer with this hash.
+    void FindAll(TupleData hash, const DNALength *&begin, const DNALength *&end) const;
+
+private:
+    struct Header
+    {
+        uint64_t magic;
+        int32_t k;
+        int32_t w;
+        uint64_t nMinimizers;
+        uint64_t nPositions;
+    };
+
+    static const uint64_t Magic;
+
+    void BuildContigs(const Nucleotide *seq,
+                      const std::vector<std::pair<DNALength, DNALength> > &contigs, int k, int w);
+
+    int k_, w_;
+    uint64_t nMinimizers_, nPositions_;
+    const TupleData *hashes_;
+    // Positions of hashes_[i] are positions_[offsets_[i], offsets_[i+1]).
+    const uint64_t *offsets_;
+    const DNALength *positions_;
+
+    std::vector<TupleData> hashBuffer_;
+    std::vector<uint64_t> offsetBuffer_;
+    std::vector<DNALength> positionBuffer_;
+
+    void *mappedFile_;
+    size_t mappedSize_;
+};
+
+#endif
@@ -0,0 +1,131 @@
+#include <alignment/tuples/TupleFrequencyTable.hpp>
+
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <alignment/tuples/TuplePositionIndex.hpp>
+
+const uint8_t TupleFrequencyTable::MaxCount;
+
+// "BLASRTFQ"
+const uint64_t TupleFrequencyTable::Magic = 0x5146545253414c42ULL;
+
+TupleFrequencyTable::TupleFrequencyTable()
+    : tupleSize_(0), nCounts_(0), counts_(NULL), mappedFile_(NULL), mappedSize_(0)
+{
+}
+
+TupleFrequencyTable::~TupleFrequencyTable() { Free(); }
+
+void TupleFrequencyTable::Build(const Nucleotide *seq, DNALength length, int tupleSize)
+{
+    // A table of 4^16 bytes is already 4GB.
+    assert(tupleSize > 0 and tupleSize <= 16);
+    Free();
+    tupleSize_ = tupleSize;
+    nCounts_ = static_cast<uint64_t>(1) << (2 * tupleSize);
+    countBuffer_.assign(nCounts_, 0);
+    TupleMetrics tm;
+    tm.tupleSize = tupleSize;
+    ForEachTupleRL(seq, length, tm, [this](DNALength, TupleData tuple) {
+        if (countBuffer_[tuple] < MaxCount) {
+            countBuffer_[tuple]++;
+        }
+    });
+    counts_ = countBuffer_.data();
+}
+
+void TupleFrequencyTable::Write(const std::string &fileName) const
+{
+    std::ofstream out(fileName.c_str(), std::ios::out | std::ios::binary);
+    if (not out) {
+        std::cout << "ERROR, could not open tuple frequency table " << fileName << " for writing."
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    Header header;
+    header.magic = Magic;
+    header.tupleSize = tupleSize_;
+    header.unused = 0;
+    header.nCounts = nCounts_;
+    out.write((const char *)&header, sizeof(Header));
+    out.write((const char *)counts_, nCounts_);
+}
+
+void TupleFrequencyTable::Read(const std::string &fileName)
+{
+    Free();
+    int fileDes = open(fileName.c_str(), O_RDONLY);
+    if (fileDes < 0) {
+        std::cout << "ERROR, could not open tuple frequency table " << fileName << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    struct stat fileStat;
+    fstat(fileDes, &fileStat);
+    size_t fileSize = fileStat.st_size;
+    void *filePtr = MAP_FAILED;
+    if (fileSize >= sizeof(Header)) {
+        filePtr = mmap(0, fileSize, PROT_READ, MAP_PRIVATE, fileDes, 0);
+    }
+    close(fileDes);
+    if (filePtr == MAP_FAILED) {
+        std::cout << "ERROR, Fail to load tuple frequency table " << fileName
+                  << " to virtual memory." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    const Header *header = (const Header *)filePtr;
+    if (header->magic != Magic or header->tupleSize <= 0 or header->tupleSize > 16 or
+        header->nCounts != static_cast<uint64_t>(1) << (2 * header->tupleSize) or
+        fileSize != sizeof(Header) + header->nCounts) {
+        munmap(filePtr, fileSize);
+        std::cout << "ERROR, " << fileName << " is not a tuple frequency table." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    mappedFile_ = filePtr;
+    mappedSize_ = fileSize;
+    tupleSize_ = header->tupleSize;
+    nCounts_ = header->nCounts;
+    counts_ = (const uint8_t *)filePtr + sizeof(Header);
+}
+
+void TupleFrequencyTable::Free()
+{
+    if (mappedFile_ != NULL) {
+        munmap(mappedFile_, mappedSize_);
+        mappedFile_ = NULL;
+        mappedSize_ = 0;
+    }
+    std::vector<uint8_t>().swap(countBuffer_);
+    tupleSize_ = 0;
+    nCounts_ = 0;
+    counts_ = NULL;
+}
+
+int TupleFrequencyTable::TupleSize() const { return tupleSize_; }
+
+uint8_t TupleFrequencyTable::Count(TupleData tuple) const
+{
+    assert(tuple < nCounts_);
+    return counts_[tuple];
+}
+
+void TupleFrequencyTable::CountTuples(const Nucleotide *seq, DNALength length,
+                                      std::vector<uint8_t> &counts) const
+{
+    counts.assign(length, 0);
+    if (counts_ == NULL) {
+        return;
+    }
+    TupleMetrics tm;
+    tm.tupleSize = tupleSize_;
+    ForEachTupleRL(seq, length, tm,
+                   [&](DNALength pos, TupleData tuple) { counts[pos] = counts_[tuple]; });
+}
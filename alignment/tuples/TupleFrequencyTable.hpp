@@ -0,0 +1,76 @@
+#ifndef _BLASR_TUPLE_FREQUENCY_TABLE_HPP_
+#define _BLASR_TUPLE_FREQUENCY_TABLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <pbdata/Types.h>
+#include <alignment/tuples/TupleMetrics.hpp>
+
+//
+// The number of times each tuple of a reference occurs, saturating at
+// MaxCount, in one byte per tuple.  This is meant to be built once with
+// the suffix array of a reference and written next to it, so that
+// over-represented seeds of a read are found with a table lookup before
+// the suffix array is searched for them.
+//
+// Tuples are encoded as ForEachTupleRL encodes them.  The file written
+// by Write() is a header and the 4^tupleSize counts, and is used in
+// place by mapping it into memory with Read().
+//
+class TupleFrequencyTable
+{
+public:
+    static const uint8_t MaxCount = 255;
+
+    TupleFrequencyTable();
+
+    ~TupleFrequencyTable();
+
+    TupleFrequencyTable(const TupleFrequencyTable &) = delete;
+    TupleFrequencyTable &operator=(const TupleFrequencyTable &) = delete;
+
+    // Count the tuples of seq[0, length) that do not contain an N.
+    void Build(const Nucleotide *seq, DNALength length, int tupleSize);
+
+    void Write(const std::string &fileName) const;
+
+    // Map a table written by Write() into memory, read only.
+    void Read(const std::string &fileName);
+
+    void Free();
+
+    int TupleSize() const;
+
+    uint8_t Count(TupleData tuple) const;
+
+    //
+    // Set counts[i] to the count of the tuple that starts at seq[i], or
+    // to 0 if there is no tuple there because of an N or the end of seq.
+    //
+    void CountTuples(const Nucleotide *seq, DNALength length, std::vector<uint8_t> &counts) const;
+
+private:
+    struct Header
+    {
+        uint64_t magic;
+        int32_t tupleSize;
+        int32_t unused;
+        uint64_t nCounts;
+    };
+
+    static const uint64_t Magic;
+
+    int tupleSize_;
+    uint64_t nCounts_;
+    const uint8_t *counts_;
+
+    std::vector<uint8_t> countBuffer_;
+
+    void *mappedFile_;
+    size_t mappedSize_;
+};
+
+#endif
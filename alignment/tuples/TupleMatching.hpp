@@ -6,6 +6,7 @@
 #include <alignment/tuples/TupleList.hpp>
 #include <alignment/tuples/TupleMatching.hpp>
 #include <alignment/tuples/TupleMetrics.hpp>
+#include <alignment/tuples/TuplePositionIndex.hpp>
 
 template <typename Sequence, typename T_TupleList>
 int SequenceToTupleList(Sequence &seq, TupleMetrics &tm, T_TupleList &tupleList);
@@ -14,6 +15,17 @@ template <typename TSequence, typename TMatch, typename T_TupleList>
 int StoreMatchingPositions(TSequence &querySeq, TupleMetrics &tm, T_TupleList &targetTupleList,
                            std::vector<TMatch> &matchSet);
 
+//
+// Same as above with a TuplePositionIndex of the target, which is built
+// in linear time and needs no Sort().
+//
+template <typename Sequence>
+int SequenceToTupleList(Sequence &seq, TupleMetrics &tm, TuplePositionIndex &targetIndex);
+
+template <typename TSequence, typename TMatch>
+int StoreMatchingPositions(TSequence &querySeq, TupleMetrics &tm, TuplePositionIndex &targetIndex,
+                           std::vector<TMatch> &matchSet);
+
 template <typename Sequence, typename Tuple>
 int StoreUniqueTuplePosList(Sequence seq, TupleMetrics &tm, std::vector<int> &uniqueTuplePosList);
 
@@ -60,6 +60,28 @@ int StoreMatchingPositions(TSequence &querySeq, TupleMetrics &tm, T_TupleList &t
     return matchSet.size();
 }
 
+template <typename Sequence>
+int SequenceToTupleList(Sequence &seq, TupleMetrics &tm, TuplePositionIndex &targetIndex)
+{
+    targetIndex.Build(seq, tm);
+    return targetIndex.size();
+}
+
+template <typename TSequence, typename TMatch>
+int StoreMatchingPositions(TSequence &querySeq, TupleMetrics &tm, TuplePositionIndex &targetIndex,
+                           std::vector<TMatch> &matchSet)
+{
+    ForEachTupleRL(querySeq.seq, querySeq.length, tm,
+                   [&targetIndex, &matchSet](DNALength s, TupleData tuple) {
+                       const DNALength *curIt, *endIt;
+                       targetIndex.FindAll(tuple, curIt, endIt);
+                       for (; curIt != endIt; curIt++) {
+                           matchSet.push_back(TMatch(s, *curIt));
+                       }
+                   });
+    return matchSet.size();
+}
+
 template <typename Sequence, typename Tuple>
 int StoreUniqueTuplePosList(Sequence seq, TupleMetrics &tm, std::vector<int> &uniqueTuplePosList)
 {
@@ -0,0 +1,93 @@
+#include <alignment/tuples/TuplePositionIndex.hpp>
+
+TuplePositionIndex::TuplePositionIndex() : directAddress_(false), hashShift_(0), slotMask_(0) {}
+
+void TuplePositionIndex::Build(const Nucleotide *seq, DNALength length, const TupleMetrics &tm)
+{
+    clear();
+    size_t nTuples = 0;
+    if (tm.tupleSize > 0 and length >= static_cast<DNALength>(tm.tupleSize)) {
+        nTuples = length - tm.tupleSize + 1;
+    }
+
+    int slotBits = 4;
+    while ((static_cast<size_t>(1) << slotBits) < 2 * nTuples) {
+        slotBits++;
+    }
+    directAddress_ = (2 * tm.tupleSize <= slotBits);
+    if (directAddress_) {
+        slotBits = 2 * tm.tupleSize;
+    }
+    size_t nSlots = static_cast<size_t>(1) << slotBits;
+    hashShift_ = 64 - slotBits;
+    slotMask_ = nSlots - 1;
+    slotTuples_.assign(nSlots, 0);
+    slotBegin_.assign(nSlots, 0);
+    slotEnd_.assign(nSlots, 0);
+
+    //
+    // Count the positions of each tuple, using slotEnd_ as the count.
+    //
+    ForEachTupleRL(seq, length, tm, [this](DNALength pos, TupleData tuple) {
+        size_t slot = FindSlot(tuple);
+        slotTuples_[slot] = tuple;
+        slotEnd_[slot]++;
+        tupleSlots_.push_back(static_cast<uint32_t>(slot));
+        tuplePositions_.push_back(pos);
+    });
+
+    DNALength offset = 0;
+    for (size_t s = 0; s < nSlots; s++) {
+        DNALength count = slotEnd_[s];
+        slotBegin_[s] = slotEnd_[s] = offset;
+        offset += count;
+    }
+
+    //
+    // Fill positions in order, which leaves them sorted within a tuple.
+    //
+    positions_.resize(tuplePositions_.size());
+    for (size_t i = 0; i < tuplePositions_.size(); i++) {
+        positions_[slotEnd_[tupleSlots_[i]]++] = tuplePositions_[i];
+    }
+}
+
+void TuplePositionIndex::clear()
+{
+    slotTuples_.clear();
+    slotBegin_.clear();
+    slotEnd_.clear();
+    positions_.clear();
+    tupleSlots_.clear();
+    tuplePositions_.clear();
+}
+
+size_t TuplePositionIndex::size() const { return positions_.size(); }
+
+void TuplePositionIndex::FindAll(TupleData tuple, const DNALength *&begin,
+                                 const DNALength *&end) const
+{
+    begin = end = positions_.data();
+    if (slotTuples_.empty()) {
+        return;
+    }
+    if (directAddress_ and tuple > slotMask_) {
+        return;
+    }
+    size_t slot = FindSlot(tuple);
+    begin = positions_.data() + slotBegin_[slot];
+    end = positions_.data() + slotEnd_[slot];
+}
+
+size_t TuplePositionIndex::FindSlot(TupleData tuple) const
+{
+    if (directAddress_) {
+        return static_cast<size_t>(tuple);
+    }
+    // Fibonacci hashing spreads the low bits of tuples over the table.
+    size_t slot = static_cast<size_t>((tuple * 0x9E3779B97F4A7C15ULL) >> hashShift_);
+    while (slotBegin_[slot] != slotEnd_[slot] and slotTuples_[slot] != tuple) {
+        slot = (slot + 1) & slotMask_;
+    }
+    return slot;
+}
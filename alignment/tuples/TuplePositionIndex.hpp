@@ -0,0 +1,96 @@
+#ifndef _BLASR_TUPLE_POSITION_INDEX_HPP_
+#define _BLASR_TUPLE_POSITION_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <pbdata/Types.h>
+#include <alignment/tuples/TupleMetrics.hpp>
+#include <pbdata/NucConversion.hpp>
+
+//
+// Call f(pos, tuple) for every tuple of seq[0, length) without an N, in
+// order of pos.  Tuples are encoded as DNATuple::FromStringRL encodes
+// them, two bits per base with the first base in the lowest bits, but
+// are rolled with one shift and add per base.
+//
+template <typename T_Function>
+void ForEachTupleRL(const Nucleotide *seq, DNALength length, const TupleMetrics &tm, T_Function f)
+{
+    if (tm.tupleSize <= 0 or length < static_cast<DNALength>(tm.tupleSize)) {
+        return;
+    }
+    const int lastBaseShift = 2 * (tm.tupleSize - 1);
+    TupleData tuple = 0;
+    int nValid = 0;
+    for (DNALength p = 0; p < length; p++) {
+        if (not IsACTG[seq[p]]) {
+            nValid = 0;
+            continue;
+        }
+        tuple = (tuple >> 2) + (static_cast<TupleData>(TwoBit[seq[p]]) << lastBaseShift);
+        if (nValid < tm.tupleSize) {
+            nValid++;
+        }
+        if (nValid == tm.tupleSize) {
+            f(p + 1 - tm.tupleSize, tuple);
+        }
+    }
+}
+
+//
+// Positions of the tuples of a sequence, grouped by tuple.  This replaces
+// sorting a TupleList<PositionDNATuple> and searching it once per query
+// tuple: the index is built in linear time with a counting pass and a
+// fill pass, and FindAll is a table lookup.
+//
+// Tuples are looked up in a table of slots with twice as many slots as
+// tuples.  When all 4^tupleSize tuples fit in that many slots, a tuple
+// is its own slot; otherwise slots are found by open addressing with
+// linear probing.  Positions of a tuple are in increasing order, as in a
+// sorted TupleList.  Buffers are kept by clear() for reuse.
+//
+class TuplePositionIndex
+{
+public:
+    TuplePositionIndex();
+
+    void Build(const Nucleotide *seq, DNALength length, const TupleMetrics &tm);
+
+    template <typename T_Sequence>
+    void Build(T_Sequence &seq, const TupleMetrics &tm)
+    {
+        Build(seq.seq, seq.length, tm);
+    }
+
+    void clear();
+
+    // Positions are grouped when the index is built.  This lets the index
+    // stand in for a TupleList, e.g. in SDPAlign.
+    void Sort() {}
+
+    // Number of positions in the index.
+    size_t size() const;
+
+    // Set [begin, end) to the positions of tuple.
+    void FindAll(TupleData tuple, const DNALength *&begin, const DNALength *&end) const;
+
+private:
+    size_t FindSlot(TupleData tuple) const;
+
+    bool directAddress_;
+    int hashShift_;
+    size_t slotMask_;
+    std::vector<TupleData> slotTuples_;
+    // Positions of the tuple in slot s are positions_[slotBegin_[s],
+    // slotEnd_[s]); a slot is empty when they are equal.
+    std::vector<DNALength> slotBegin_;
+    std::vector<DNALength> slotEnd_;
+    std::vector<DNALength> positions_;
+    // Slot of each tuple of the sequence, from the counting pass.
+    std::vector<uint32_t> tupleSlots_;
+    std::vector<DNALength> tuplePositions_;
+};
+
+#endif
@@ -5,7 +5,7 @@ bool LookupHQRegion(int holeNumber, RegionTable &regionTable, int &start, int &e
 {
 
     if (regionTable.HasHoleNumber(holeNumber)) {
-        RegionAnnotations zmwRegions = regionTable[holeNumber];
+        const RegionAnnotations &zmwRegions = regionTable[holeNumber];
         if (zmwRegions.HasHQRegion()) {
             start = zmwRegions.HQStart();
             end = zmwRegions.HQEnd();
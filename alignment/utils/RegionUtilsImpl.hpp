@@ -8,7 +8,7 @@ bool MaskRead(T_Sequence &fastaRead, ZMWGroupEntry &zmwData, RegionTable &region
     if (not regionTable.HasHoleNumber(zmwData.holeNumber)) {
         return false;
     } else {
-        RegionAnnotations regions = regionTable[zmwData.holeNumber];
+        const RegionAnnotations &regions = regionTable[zmwData.holeNumber];
 
         // Mask off the low quality portion of this read.
         DNALength readPos;
@@ -33,7 +33,7 @@ bool GetReadTrimCoordinates(T_Sequence &fastaRead, ZMWGroupEntry &zmwData, Regio
 {
 
     if (regionTable.HasHoleNumber(zmwData.holeNumber)) {
-        RegionAnnotations regions = regionTable[zmwData.holeNumber];
+        const RegionAnnotations &regions = regionTable[zmwData.holeNumber];
         if (regions.HasHQRegion()) {
             readStart = regions.HQStart();
             readEnd = regions.HQEnd();
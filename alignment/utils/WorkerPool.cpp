@@ -0,0 +1,73 @@
+#include <alignment/utils/WorkerPool.hpp>
+
+WorkerPool::WorkerPool(unsigned int numThreads)
+    : body_(nullptr), numIterations_(0), nextIteration_(0), numLoops_(0), numBusy_(0), stop_(false)
+{
+    for (unsigned int t = 1; t < numThreads; t++) {
+        workers_.push_back(std::thread(&WorkerPool::RunLoops, this, t));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    started_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+unsigned int WorkerPool::NumThreads() const { return workers_.size() + 1; }
+
+void WorkerPool::ParallelFor(unsigned int n, const Body &body)
+{
+    if (workers_.empty() or n < 2) {
+        for (unsigned int i = 0; i < n; i++) {
+            body(i, 0);
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        body_ = &body;
+        numIterations_ = n;
+        nextIteration_ = 0;
+        numBusy_ = workers_.size();
+        numLoops_++;
+    }
+    started_.notify_all();
+    RunIterations(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    finished_.wait(lock, [this] { return numBusy_ == 0; });
+    body_ = nullptr;
+}
+
+void WorkerPool::RunLoops(unsigned int threadIndex)
+{
+    uint64_t numLoopsRun = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            started_.wait(lock, [this, numLoopsRun] { return stop_ or numLoops_ != numLoopsRun; });
+            if (stop_) return;
+            numLoopsRun = numLoops_;
+        }
+        RunIterations(threadIndex);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--numBusy_ == 0) finished_.notify_one();
+        }
+    }
+}
+
+void WorkerPool::RunIterations(unsigned int threadIndex)
+{
+    unsigned int i;
+    while ((i = nextIteration_++) < numIterations_) {
+        (*body_)(i, threadIndex);
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef _BLASR_WORKER_POOL_HPP_
+#define _BLASR_WORKER_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Threads that run the iterations of a loop together with the thread
+ * that calls ParallelFor.  The threads are started once and wait between
+ * loops, so a pool kept by the caller, e.g. one per mapping thread, can
+ * run many short loops without starting threads for each.
+ *
+ * One loop runs at a time: ParallelFor must not be called from several
+ * threads at once, nor from a loop body.  Loop bodies must not throw.
+ */
+class WorkerPool
+{
+public:
+    // Run iteration i on the thread with index threadIndex, in
+    // [0, NumThreads()); the calling thread has index 0.
+    typedef std::function<void(unsigned int i, unsigned int threadIndex)> Body;
+
+    // Run loops on numThreads threads, including the calling thread.
+    explicit WorkerPool(unsigned int numThreads);
+
+    ~WorkerPool();
+
+    unsigned int NumThreads() const;
+
+    // Run body for i in [0, n), and return once all iterations are done.
+    void ParallelFor(unsigned int n, const Body &body);
+
+private:
+    void RunLoops(unsigned int threadIndex);
+
+    void RunIterations(unsigned int threadIndex);
+
+private:
+    std::mutex mutex_;
+    std::condition_variable started_;
+    std::condition_variable finished_;
+    const Body *body_;
+    unsigned int numIterations_;
+    std::atomic<unsigned int> nextIteration_;
+    uint64_t numLoops_;
+    unsigned int numBusy_;
+    bool stop_;
+
+    std::vector<std::thread> workers_;
+};
+
+#endif
@@ -11,7 +11,9 @@
 #include <hdf/HDFConfig.hpp>
 #include <hdf/HDFData.hpp>
 #include <hdf/HDFGroup.hpp>
+#include <hdf/HDFIOStats.hpp>
 #include <hdf/HDFWriteBuffer.hpp>
+#include <hdf/HDFWriteOptions.hpp>
 
 /*
  *
@@ -57,6 +59,15 @@ public:
 
     BufferedHDF2DArray();
 
+    HDFWriteOptions writeOptions;
+
+    /*
+     * Set chunking and filters of datasets created by this array.
+     * Rows are buffered up to the larger of options.bufferSize
+     * elements and one row.  Call this before Initialize or Create.
+     */
+    void SetWriteOptions(const HDFWriteOptions &options);
+
     DSLength GetNRows();
 
     DSLength GetNCols();
@@ -110,7 +121,19 @@ public:
      */
     void WriteRow(const T *data, DSLength dataLength, DSLength destRow = static_cast<DSLength>(-1));
 
+    /*
+     * Write the buffered rows to the dataset.  With a write queue in
+     * writeOptions the rows are written in the background, and Close()
+     * waits for them.
+     */
     void Flush(DSLength destRow = static_cast<DSLength>(-1));
+
+    void WriteRows(const T *data, DSLength numDataRows, DSLength destRow);
+
+    /*
+     * Wait for background writes, before calling HDF5 directly.
+     */
+    void WaitForWrites();
 };
 
 DSLength GetDatasetNDim(H5::Group &parentGroup, std::string datasetName);
@@ -3,6 +3,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <utility>
 
 #include <pbdata/utils.hpp>
 
@@ -22,6 +23,16 @@ BufferedHDF2DArray<T>::BufferedHDF2DArray() : HDFData()
     colLength = -1;
 }
 
+template <typename T>
+void BufferedHDF2DArray<T>::SetWriteOptions(const HDFWriteOptions &options)
+{
+    writeOptions = options;
+    if (static_cast<DSLength>(options.bufferSize) != this->bufferSize) {
+        assert(this->WriteBufferEmpty());
+        this->InitializeBuffer(options.bufferSize);
+    }
+}
+
 template <typename T>
 DSLength BufferedHDF2DArray<T>::GetNRows()
 {
@@ -42,6 +53,7 @@ void BufferedHDF2DArray<T>::Close()
     // Clean up the write buffer.
     //
     //		Flush();
+    WaitForWrites();
     if (dimSize != NULL) {
         delete[] dimSize;
         dimSize = NULL;
@@ -186,7 +198,10 @@ void BufferedHDF2DArray<T>::Read(DSLength startX, DSLength endX, DSLength startY
 
     H5::DataSpace destSpace(2, memSpaceSize);
     fullSourceSpace.selectHyperslab(H5S_SELECT_SET, memSpaceSize, sourceSpaceOffset);
-    dataset.read(dest, typeID, destSpace, fullSourceSpace);
+    {
+        HDFIOTimer timer(dataset, HDFIOStats::Read, memSpaceSize[0] * memSpaceSize[1] * sizeof(T));
+        dataset.read(dest, typeID, destSpace, fullSourceSpace);
+    }
     destSpace.close();
 }
 
@@ -225,9 +240,12 @@ void BufferedHDF2DArray<T>::Create(H5::Group *_container, std::string _datasetNa
      * docuemntation was written for people who enjoy learning how to
      * use an API by reading comments in source code.
      */
-    hsize_t chunkDims[2] = {16384, hsize_t(rowLength)};
-    cparms.setChunk(2, chunkDims);
-    TypedCreate(fileSpace, cparms);
+    hsize_t rowDims[1] = {hsize_t(rowLength)};
+    writeOptions.SetCreateProperties(cparms, 2, rowDims, sizeof(T));
+    {
+        HDFIOTimer timer(*container, datasetName, HDFIOStats::Create);
+        TypedCreate(fileSpace, cparms);
+    }
     fileSpace.close();
 
     //
@@ -325,78 +343,111 @@ void BufferedHDF2DArray<T>::Flush(DSLength destRow)
 
     if (numDataRows > 0) {
         assert(fileDataSpaceInitialized);
+        if (writeOptions.writeQueue) {
+            //
+            // Hand the full buffer to the write queue, and fill the
+            // buffer of its previous write of this dataset meanwhile.
+            //
+            HDFWriteQueue &writeQueue = *writeOptions.writeQueue;
+            writeQueue.WaitFor(this->pendingWrite);
+            if (this->spareBuffer == NULL) {
+                this->spareBuffer = ProtectedNew<T>(this->bufferSize);
+            }
+            std::swap(this->writeBuffer, this->spareBuffer);
+            const T *data = this->spareBuffer;
+            this->pendingWrite = writeQueue.Submit(
+                [this, data, numDataRows, destRow]() { WriteRows(data, numDataRows, destRow); });
+        } else {
+            WriteRows(this->writeBuffer, numDataRows, destRow);
+        }
+    }
+    this->ResetWriteBuffer();
+}
 
-        H5::DataSpace fileSpace;
-        fileSpace = dataset.getSpace();
+template <typename T>
+void BufferedHDF2DArray<T>::WriteRows(const T *data, DSLength numDataRows, DSLength destRow)
+{
+    H5::DataSpace fileSpace;
+    fileSpace = dataset.getSpace();
 
-        //
-        // Load the current size of the array on disk.
-        //
-        hsize_t fileArraySize[2], fileArrayMaxSize[2], blockStart[2];
-        fileSpace.getSimpleExtentDims(fileArraySize, fileArrayMaxSize);
+    //
+    // Load the current size of the array on disk.
+    //
+    hsize_t fileArraySize[2], fileArrayMaxSize[2], blockStart[2];
+    fileSpace.getSimpleExtentDims(fileArraySize, fileArrayMaxSize);
 
-        // Save this for later to determine the offsets
-        blockStart[0] = fileArraySize[0];
-        blockStart[1] = fileArraySize[1];
+    // Save this for later to determine the offsets
+    blockStart[0] = fileArraySize[0];
+    blockStart[1] = fileArraySize[1];
 
-        //
-        // Calculate the number of rows to create.  This is dependent
-        // on the current file size, the destination of where the data
-        // will go, and how much to write.
-        //
+    //
+    // Calculate the number of rows to create.  This is dependent
+    // on the current file size, the destination of where the data
+    // will go, and how much to write.
+    //
 
-        if (destRow == static_cast<DSLength>(-1)) {
-            fileArraySize[0] += numDataRows;
-        } else {
-            // If the data cannot fit in the current file size, extend
-            // it,  otherwise, do not toch the file array size.
-            if (destRow + numDataRows > fileArraySize[0]) {
-                fileArraySize[0] = destRow + numDataRows;
-            }
+    if (destRow == static_cast<DSLength>(-1)) {
+        fileArraySize[0] += numDataRows;
+    } else {
+        // If the data cannot fit in the current file size, extend
+        // it,  otherwise, do not toch the file array size.
+        if (destRow + numDataRows > fileArraySize[0]) {
+            fileArraySize[0] = destRow + numDataRows;
         }
+    }
 
-        //
-        // Make room in the file for the array.
-        //
+    //
+    // Make room in the file for the array.
+    //
+    {
+        HDFIOTimer timer(dataset, HDFIOStats::Extend, numDataRows * rowLength * sizeof(T));
         dataset.extend(fileArraySize);
+    }
 
-        H5::DataSpace extendedSpace = dataset.getSpace();
-        //
-        // Store the newly dimensioned dataspaces.
-        //
-        fileSpace.getSimpleExtentDims(fileArraySize, fileArrayMaxSize);
-        //
-        // Configure the proper addressing to append to the array.
-        //
-        hsize_t dataSize[2];
-        dataSize[0] = numDataRows;
-        dataSize[1] = rowLength;
-        hsize_t offset[2];
-        //
-        // Determine which row to write to.
-        //
-        if (destRow == static_cast<DSLength>(-1)) {
-            offset[0] = blockStart[0];
-        } else {
-            offset[0] = destRow;
-        }
-        offset[1] = 0;
-        extendedSpace.selectHyperslab(H5S_SELECT_SET, dataSize, offset);
-        H5::DataSpace memorySpace(2, dataSize);
+    H5::DataSpace extendedSpace = dataset.getSpace();
+    //
+    // Store the newly dimensioned dataspaces.
+    //
+    fileSpace.getSimpleExtentDims(fileArraySize, fileArrayMaxSize);
+    //
+    // Configure the proper addressing to append to the array.
+    //
+    hsize_t dataSize[2];
+    dataSize[0] = numDataRows;
+    dataSize[1] = rowLength;
+    hsize_t offset[2];
+    //
+    // Determine which row to write to.
+    //
+    if (destRow == static_cast<DSLength>(-1)) {
+        offset[0] = blockStart[0];
+    } else {
+        offset[0] = destRow;
+    }
+    offset[1] = 0;
+    extendedSpace.selectHyperslab(H5S_SELECT_SET, dataSize, offset);
+    H5::DataSpace memorySpace(2, dataSize);
 
-        //
-        // Finally, write out the data.
-        // This uses a generic function which is specialized with
-        // templates later on to t
-        // memorySpace addresses the entire array in linear format
-        // fileSpace addresses the last dataLength blocks of dataset.
-        //
-        TypedWriteRow(this->writeBuffer, memorySpace, extendedSpace);
-        memorySpace.close();
-        extendedSpace.close();
-        fileSpace.close();
+    //
+    // Finally, write out the data.
+    // This uses a generic function which is specialized with
+    // templates later on to t
+    // memorySpace addresses the entire array in linear format
+    // fileSpace addresses the last dataLength blocks of dataset.
+    //
+    {
+        HDFIOTimer timer(dataset, HDFIOStats::Write, numDataRows * rowLength * sizeof(T));
+        TypedWriteRow(data, memorySpace, extendedSpace);
     }
-    this->ResetWriteBuffer();
+    memorySpace.close();
+    extendedSpace.close();
+    fileSpace.close();
+}
+
+template <typename T>
+void BufferedHDF2DArray<T>::WaitForWrites()
+{
+    if (writeOptions.writeQueue) writeOptions.writeQueue->Wait();
 }
 
 #endif  // _BLASR_HDF_BUFFERED_HDF_2D_ARRAY_IMPL_HPP_
@@ -15,7 +15,9 @@
 #include <hdf/HDFData.hpp>
 #include <hdf/HDFFile.hpp>
 #include <hdf/HDFGroup.hpp>
+#include <hdf/HDFIOStats.hpp>
 #include <hdf/HDFWriteBuffer.hpp>
+#include <hdf/HDFWriteOptions.hpp>
 #include <pbdata/DNASequence.hpp>
 #include <pbdata/FASTQSequence.hpp>
 
@@ -45,6 +47,7 @@ public:
     hsize_t *dimSize;
     int maxDims;
     DSLength arrayLength;
+    HDFWriteOptions writeOptions;
 
     /*
      * Constructor meant to be used for data that will be written.
@@ -58,10 +61,28 @@ public:
 
     void SetBufferSize(int _bufferSize);
 
+    /*
+     * Set chunking, filters and the write buffer size of datasets
+     * created by this array.  Call this before Initialize or Create.
+     */
+    void SetWriteOptions(const HDFWriteOptions &options);
+
     void Write(const T *data, DSLength dataLength, bool append = true, DSLength writePos = 0);
 
+    /*
+     * Write the buffered data to the dataset.  With a write queue in
+     * writeOptions the data is written in the background, and Close()
+     * waits for it.
+     */
     void Flush(bool append = true, DSLength writePos = 0);
 
+    void WriteBuffer(const T *data, DSLength dataLength, bool append, DSLength writePos);
+
+    /*
+     * Wait for background writes, before calling HDF5 directly.
+     */
+    void WaitForWrites();
+
     void TypedWrite(const char **data, const H5::DataSpace &memorySpace,
                     const H5::DataSpace &extendedSpace);
 
@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <utility>
 
 #include <hdf/BufferedHDFArray.hpp>
 #include <pbdata/utils.hpp>
@@ -32,6 +33,7 @@ BufferedHDFArray<T>::~BufferedHDFArray()
     //
     // Clean up the write buffer.
     //
+    WaitForWrites();
     if (dimSize != NULL) {
         delete[] dimSize;
         dimSize = NULL;
@@ -45,6 +47,16 @@ void BufferedHDFArray<T>::SetBufferSize(int _bufferSize)
     this->InitializeBuffer(_bufferSize);
 }
 
+template <typename T>
+void BufferedHDFArray<T>::SetWriteOptions(const HDFWriteOptions &options)
+{
+    writeOptions = options;
+    if (static_cast<DSLength>(options.bufferSize) != this->bufferSize) {
+        assert(this->WriteBufferEmpty());
+        this->InitializeBuffer(options.bufferSize);
+    }
+}
+
 template <typename T>
 void BufferedHDFArray<T>::Write(const T *data, DSLength dataLength, bool append, DSLength writePos)
 {
@@ -99,6 +111,40 @@ void BufferedHDFArray<T>::Flush(bool append, DSLength writePos)
         fileDataSpaceInitialized = true;
     }
 
+    if (writeOptions.writeQueue) {
+        //
+        // Hand the full buffer to the write queue, and fill the buffer
+        // of its previous write of this dataset meanwhile.
+        //
+        HDFWriteQueue &writeQueue = *writeOptions.writeQueue;
+        writeQueue.WaitFor(this->pendingWrite);
+        if (this->spareBuffer == NULL) {
+            this->spareBuffer = ProtectedNew<T>(this->bufferSize);
+        }
+        std::swap(this->writeBuffer, this->spareBuffer);
+        const T *data = this->spareBuffer;
+        const DSLength dataLength = this->bufferIndex;
+        this->pendingWrite = writeQueue.Submit([this, data, dataLength, append, writePos]() {
+            WriteBuffer(data, dataLength, append, writePos);
+        });
+    } else {
+        try {
+            WriteBuffer(this->writeBuffer, this->bufferIndex, append, writePos);
+        } catch (const H5::DataSetIException &e) {
+            std::cout << "ERROR! Could not write HDF5 data." << std::endl;
+            e.printErrorStack();
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // Clear the buffer.
+    this->ResetWriteBuffer();
+}
+
+template <typename T>
+void BufferedHDFArray<T>::WriteBuffer(const T *data, DSLength dataLength, bool append,
+                                      DSLength writePos)
+{
     H5::DataSpace fileSpace;
     fileSpace = dataset.getSpace();
 
@@ -109,15 +155,18 @@ void BufferedHDFArray<T>::Flush(bool append, DSLength writePos)
     fileArraySize[0] = fileSpace.getSimpleExtentNpoints();
     if (append) {
         blockStart = fileSpace.getSimpleExtentNpoints();
-        fileArraySize[0] += this->bufferIndex;
+        fileArraySize[0] += dataLength;
         //
         // Make room in the file for the array.
         //
+        HDFIOTimer timer(dataset, HDFIOStats::Extend, dataLength * sizeof(T));
         dataset.extend(fileArraySize);
     } else {
         blockStart = writePos;
-        if (blockStart + this->bufferIndex > fileArraySize[0]) {
-            fileArraySize[0] = blockStart + this->bufferIndex;
+        if (blockStart + dataLength > fileArraySize[0]) {
+            HDFIOTimer timer(dataset, HDFIOStats::Extend,
+                             (blockStart + dataLength - fileArraySize[0]) * sizeof(T));
+            fileArraySize[0] = blockStart + dataLength;
             dataset.extend(fileArraySize);
         }
     }
@@ -129,7 +178,7 @@ void BufferedHDFArray<T>::Flush(bool append, DSLength writePos)
     //
     hsize_t dataSize[1];
     hsize_t offset[1];
-    dataSize[0] = this->bufferIndex;
+    dataSize[0] = dataLength;
     offset[0] = blockStart;
     extendedSpace.selectHyperslab(H5S_SELECT_SET, dataSize, offset);
     H5::DataSpace memorySpace(1, dataSize);
@@ -141,19 +190,19 @@ void BufferedHDFArray<T>::Flush(bool append, DSLength writePos)
     // memorySpace addresses the entire array in linear format
     // fileSpace addresses the last dataLength blocks of dataset.
     //
-    try {
-        TypedWrite(this->writeBuffer, memorySpace, extendedSpace);
-    } catch (const H5::DataSetIException &e) {
-        std::cout << "ERROR! Could not write HDF5 data." << std::endl;
-        e.printErrorStack();
-        std::exit(EXIT_FAILURE);
+    {
+        HDFIOTimer timer(dataset, HDFIOStats::Write, dataLength * sizeof(T));
+        TypedWrite(data, memorySpace, extendedSpace);
     }
     memorySpace.close();
     extendedSpace.close();
     fileSpace.close();
+}
 
-    // Clear the buffer.
-    this->ResetWriteBuffer();
+template <typename T>
+void BufferedHDFArray<T>::WaitForWrites()
+{
+    if (writeOptions.writeQueue) writeOptions.writeQueue->Wait();
 }
 
 template <typename T>
@@ -209,9 +258,11 @@ void BufferedHDFArray<T>::Create(H5::Group *_container, std::string _datasetName
      * docuemntation was written for people who enjoy learning how to
      * use an API by reading comments in source code.
      */
-    hsize_t chunk_dims[1] = {16384};
-    cparms.setChunk(1, chunk_dims);
-    TypedCreate(fileSpace, cparms);
+    writeOptions.SetCreateProperties(cparms, 1, NULL, sizeof(T));
+    {
+        HDFIOTimer timer(*container, datasetName, HDFIOStats::Create);
+        TypedCreate(fileSpace, cparms);
+    }
 
     //
     // Since TypedCreate created an assigned a dataset, this array is
@@ -353,6 +404,7 @@ int BufferedHDFArray<T>::Resize(const DSLength newArrayLength)
         hsize_t fileArraySize[1];
         fileArraySize[0] = newArrayLength;
         arrayLength = newArrayLength;
+        HDFIOTimer timer(dataset, HDFIOStats::Extend, 0);
         dataset.extend(fileArraySize);
         fileSpace.close();
     } catch (H5::DataSetIException &e) {
@@ -365,6 +417,7 @@ int BufferedHDFArray<T>::Resize(const DSLength newArrayLength)
 template <typename T>
 void BufferedHDFArray<T>::Close()
 {
+    WaitForWrites();
     if (dimSize != NULL) {
         delete[] dimSize;
         dimSize = NULL;
@@ -375,6 +428,7 @@ void BufferedHDFArray<T>::Close()
 template <typename T>
 DSLength BufferedHDFArray<T>::size()
 {
+    WaitForWrites();
     dataspace = dataset.getSpace();
     hsize_t dimSizeArray[1];
     dataspace.getSimpleExtentDims(dimSizeArray);
@@ -428,7 +482,10 @@ void BufferedHDFArray<T>::Read(DSLength start, DSLength end, H5::DataType typeID
     sourceSpaceOffset[0] = start;
     H5::DataSpace destSpace(1, memSpaceSize);
     fullSourceSpace.selectHyperslab(H5S_SELECT_SET, memSpaceSize, sourceSpaceOffset);
-    dataset.read(dest, typeID, destSpace, fullSourceSpace);
+    {
+        HDFIOTimer timer(dataset, HDFIOStats::Read, (end - start) * sizeof(T));
+        dataset.read(dest, typeID, destSpace, fullSourceSpace);
+    }
     destSpace.close();
 }
 
@@ -444,7 +501,10 @@ void BufferedHDFArray<T>::ReadCharArray(DSLength start, DSLength end, std::strin
     fullSourceSpace.selectHyperslab(H5S_SELECT_SET, memSpaceSize, sourceSpaceOffset);
     std::vector<char *> tmpStringArray;
     tmpStringArray.resize(end - start);
-    dataset.read(&tmpStringArray[0], strType, destSpace, fullSourceSpace);
+    {
+        HDFIOTimer timer(dataset, HDFIOStats::Read, (end - start) * sizeof(char *));
+        dataset.read(&tmpStringArray[0], strType, destSpace, fullSourceSpace);
+    }
     for (size_t i = 0; i < tmpStringArray.size(); i++) {
         dest[i] = tmpStringArray[i];
     }
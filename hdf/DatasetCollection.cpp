@@ -1,5 +1,9 @@
 #include <hdf/DatasetCollection.hpp>
 
+#include <pbdata/utils/MemoryUtils.hpp>
+
+DatasetCollection::DatasetCollection() : peakBufferBytes(0) {}
+
 void DatasetCollection::MakeFieldRequired(std::string &fieldName)
 {
     includedFields[fieldName] = true;
@@ -64,3 +68,42 @@ bool DatasetCollection::ContainsField(std::string fieldName)
     }
     return false;
 }
+
+int DatasetCollection::IncludeOnlyFields(const std::vector<std::string> &fieldList)
+{
+    for (const std::string &fieldName : fieldList) {
+        if (not ContainsField(fieldName)) {
+            return 0;
+        }
+    }
+    InitializeAllFields(false);
+    for (const std::string &fieldName : fieldList) {
+        includedFields[fieldName] = true;
+    }
+    return 1;
+}
+
+std::vector<std::string> DatasetCollection::GetIncludedFieldNames()
+{
+    std::vector<std::string> names;
+    for (const std::string &fieldName : fieldNames) {
+        if (FieldIsIncluded(fieldName)) names.push_back(fieldName);
+    }
+    return names;
+}
+
+void DatasetCollection::RecordBufferBytes(DSLength bytes)
+{
+    if (bytes > peakBufferBytes) peakBufferBytes = bytes;
+}
+
+void DatasetCollection::PrintMemoryReport(std::ostream &out)
+{
+    out << "Included fields:";
+    for (const std::string &fieldName : GetIncludedFieldNames()) {
+        out << " " << fieldName;
+    }
+    out << std::endl
+        << "Peak buffered bytes: " << peakBufferBytes << std::endl
+        << "Peak resident memory: " << GetPeakResidentMemory() << std::endl;
+}
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include <pbdata/Types.h>
 #include <hdf/HDFData.hpp>
 #include <hdf/HDFGroup.hpp>
 
@@ -15,6 +16,11 @@ public:
     std::vector<std::string> fieldNames;
     std::map<std::string, bool> includedFields;
     std::map<std::string, bool> requiredFields;
+    // Largest number of bytes the reader held in buffers of included
+    // fields at once, see RecordBufferBytes.
+    DSLength peakBufferBytes;
+
+    DatasetCollection();
 
     void MakeFieldRequired(std::string &fieldName);
 
@@ -32,6 +38,25 @@ public:
 
     bool ContainsField(std::string fieldName);
 
+    //
+    // Read exactly the fields in fieldList, e.g. {"Basecall",
+    // "QualityValue"} for a job that only needs bases and QVs; other
+    // datasets are never read.  Returns 0 and leaves the included fields
+    // unchanged if a field is not in fieldNames.
+    //
+    int IncludeOnlyFields(const std::vector<std::string> &fieldList);
+
+    std::vector<std::string> GetIncludedFieldNames();
+
+    // Keep track of the peak of bytes buffered for included fields.
+    void RecordBufferBytes(DSLength bytes);
+
+    //
+    // Print the included fields, the peak of bytes buffered by this
+    // reader and the peak resident memory of the process.
+    //
+    void PrintMemoryReport(std::ostream &out);
+
     template <typename T_Dataset>
     bool InitializeDataset(HDFGroup &group, T_Dataset &dataset, std::string datasetName);
 };
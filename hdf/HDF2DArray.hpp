@@ -7,6 +7,18 @@ template <typename T>
 class HDF2DArray : public BufferedHDF2DArray<T>
 {
 public:
+    /*
+     * Rows are written straight from the caller's data, so they are never
+     * buffered or queued for a background thread.
+     */
+    void SetWriteOptions(const HDFWriteOptions& options)
+    {
+        HDFWriteOptions syncOptions = options;
+        syncOptions.bufferSize = 0;
+        syncOptions.writeQueue.reset();
+        BufferedHDF2DArray<T>::SetWriteOptions(syncOptions);
+    }
+
     void WriteRow(const T* data, int dataLength, int destRow = -1)
     {
         this->writeBuffer = (T*)data;
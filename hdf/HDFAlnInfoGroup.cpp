@@ -1,5 +1,9 @@
 #include <hdf/HDFAlnInfoGroup.hpp>
 
+#include <algorithm>
+
+HDFAlnInfoGroup::HDFAlnInfoGroup() : writeBufferSize(0), pendingRowsStart(0) {}
+
 int HDFAlnInfoGroup::InitializeNumPasses()
 {
     numPasses.Initialize(alnInfoGroup, "NumPasses");
@@ -85,21 +89,54 @@ void HDFAlnInfoGroup::Read(AlnInfo &alnInfo)
 
     UInt nAlignments = alnIndexArray.GetNRows();
     alnInfo.alignments.resize(nAlignments);
-    UInt alignmentIndex;
-    UInt alignmentRow[NCols];
-    for (alignmentIndex = 0; alignmentIndex < nAlignments; alignmentIndex++) {
-        // Input the values.
-        alnIndexArray.Read(alignmentIndex, alignmentIndex + 1, alignmentRow);
-        alnInfo.alignments[alignmentIndex].StoreAlignmentIndex(alignmentRow, NCols);
+    // Read rows in blocks rather than one HDF5 call per alignment.
+    const UInt blockRows = 65536;
+    const UInt nCols = alnIndexArray.GetNCols();
+    std::vector<UInt> alignmentRows;
+    for (UInt blockStart = 0; blockStart < nAlignments; blockStart += blockRows) {
+        UInt blockEnd = std::min(nAlignments, blockStart + blockRows);
+        // Pad so that NCols values can be stored from the last row.
+        alignmentRows.resize((blockEnd - blockStart) * nCols + NCols);
+        alnIndexArray.Read(blockStart, blockEnd, &alignmentRows[0]);
+        for (UInt alignmentIndex = blockStart; alignmentIndex < blockEnd; alignmentIndex++) {
+            alnInfo.alignments[alignmentIndex].StoreAlignmentIndex(
+                &alignmentRows[(alignmentIndex - blockStart) * nCols], NCols);
+        }
     }
 }
 
 int HDFAlnInfoGroup::GetNAlignments() { return alnIndexArray.GetNRows(); }
 
+void HDFAlnInfoGroup::SetWriteBufferSize(int bufferSize)
+{
+    Flush();
+    writeBufferSize = bufferSize;
+}
+
 unsigned int HDFAlnInfoGroup::WriteAlnIndex(std::vector<unsigned int> &aln)
 {
-    alnIndexArray.WriteRow(&aln[0], aln.size());
-    return alnIndexArray.GetNRows();
+    if (writeBufferSize <= 0) {
+        alnIndexArray.WriteRow(&aln[0], aln.size());
+        return alnIndexArray.GetNRows();
+    }
+    if (pendingRows.empty()) {
+        // Query the dataset once per batch rather than once per row.
+        pendingRowsStart = alnIndexArray.GetNRows();
+    }
+    pendingRows.insert(pendingRows.end(), aln.begin(), aln.end());
+    unsigned int nRows = pendingRowsStart + pendingRows.size() / NCols;
+    if (pendingRows.size() >= static_cast<size_t>(writeBufferSize)) {
+        Flush();
+    }
+    return nRows;
+}
+
+void HDFAlnInfoGroup::Flush()
+{
+    if (pendingRows.empty()) return;
+    // All rows are written with one extension of the dataset.
+    alnIndexArray.WriteRow(&pendingRows[0], pendingRows.size());
+    pendingRows.clear();
 }
 
 void HDFAlnInfoGroup::ReadCmpAlignment(UInt alignmentIndex, CmpAlignment &cmpAlignment)
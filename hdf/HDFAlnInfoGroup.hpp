@@ -23,6 +23,8 @@ public:
     HDFAtom<std::vector<std::string> > columnNames;
     HDFAtom<int> frameRate;
 
+    HDFAlnInfoGroup();
+
     int Initialize(HDFGroup &rootGroup);
 
     int InitializeNumPasses();
@@ -40,9 +42,23 @@ public:
 
     int GetNAlignments();
 
+    // Buffer up to bufferSize values (NCols per alignment) of AlnIndex
+    // before writing them, or write each row as it is added when 0.
+    void SetWriteBufferSize(int bufferSize);
+
+    // Append a row to AlnIndex, and return the number of rows.
     unsigned int WriteAlnIndex(std::vector<unsigned int> &aln);
 
+    // Write the buffered rows of AlnIndex.
+    void Flush();
+
     void ReadCmpAlignment(UInt alignmentIndex, CmpAlignment &cmpAlignment);
+
+private:
+    int writeBufferSize;
+    // Rows of AlnIndex on disk, valid while pendingRows is not empty.
+    unsigned int pendingRowsStart;
+    std::vector<unsigned int> pendingRows;
 };
 
 #endif
@@ -1,8 +1,10 @@
 #ifndef _BLASR_HDF_ARRAY_HPP_
 #define _BLASR_HDF_ARRAY_HPP_
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <vector>
 
 #include <H5Cpp.h>
 
@@ -34,17 +36,86 @@ template <typename T>
 class HDFArray : public BufferedHDFArray<T>
 {
 public:
-    HDFArray() : BufferedHDFArray<T>() {}
+    HDFArray() : BufferedHDFArray<T>(), readAheadSize(0), readAheadStart(0), readAheadEnd(0) {}
     HDFArray(H5::Group* _container, std::string _datasetName)
         : BufferedHDFArray<T>(_container, _datasetName)
+        , readAheadSize(0)
+        , readAheadStart(0)
+        , readAheadEnd(0)
     {
     }
 
+    /*
+     * Read blocks of readAheadSize elements with a single HDF5 call, and
+     * serve Read() from the last block while it covers the requested
+     * interval.  This turns many small sequential reads (one per read
+     * per field) into a few large ones.  A size of 0 disables it.
+     */
+    void SetReadAheadSize(DSLength size)
+    {
+        readAheadSize = size;
+        ClearReadAhead();
+    }
+
+    void ClearReadAhead()
+    {
+        readAheadStart = readAheadEnd = 0;
+        std::vector<T>().swap(readAheadBuffer);
+    }
+
+    DSLength GetReadAheadBytes() const { return readAheadBuffer.capacity() * sizeof(T); }
+
+    using BufferedHDFArray<T>::Read;
+
+    void Read(DSLength start, DSLength end, T* dest)
+    {
+        if (readAheadSize == 0 or end - start > readAheadSize or start >= this->arrayLength) {
+            // Long reads, and reads at or past the end of the dataset,
+            // go straight to HDF5.
+            BufferedHDFArray<T>::Read(start, end, dest);
+            return;
+        }
+        if (start < readAheadStart or end > readAheadEnd) {
+            readAheadStart = start;
+            readAheadEnd = std::min(start + readAheadSize, this->arrayLength);
+            readAheadBuffer.resize(readAheadEnd - readAheadStart);
+            if (readAheadEnd > readAheadStart) {
+                BufferedHDFArray<T>::Read(readAheadStart, readAheadEnd, &readAheadBuffer[0]);
+            }
+            if (end > readAheadEnd) {
+                // Past the end of the dataset, let HDF5 report it.
+                BufferedHDFArray<T>::Read(start, end, dest);
+                return;
+            }
+        }
+        std::copy(readAheadBuffer.begin() + (start - readAheadStart),
+                  readAheadBuffer.begin() + (end - readAheadStart), dest);
+    }
+
+    /*
+     * Writes of HDFArray go straight from the caller's data, so they are
+     * never buffered or queued for a background thread.
+     */
+    void SetWriteOptions(const HDFWriteOptions& options)
+    {
+        HDFWriteOptions syncOptions = options;
+        syncOptions.bufferSize = 0;
+        syncOptions.writeQueue.reset();
+        BufferedHDFArray<T>::SetWriteOptions(syncOptions);
+    }
+
+    void Close()
+    {
+        ClearReadAhead();
+        BufferedHDFArray<T>::Close();
+    }
+
     /*
      *  An unbuffered write is simply a write immediately followed by a flush.
      */
     void WriteToPos(const T* data, int dataLength, UInt writePos)
     {
+        ClearReadAhead();
         this->writeBuffer = (T*)data;
         this->bufferIndex = dataLength;
         this->bufferSize = dataLength;
@@ -61,6 +132,7 @@ public:
 
     void Write(const T* data, int dataLength)
     {
+        ClearReadAhead();
         this->writeBuffer = (T*)data;
         this->bufferIndex = dataLength;
         this->bufferSize = dataLength;
@@ -73,6 +145,12 @@ public:
     }
 
     ~HDFArray() {}
+
+private:
+    DSLength readAheadSize;
+    // Elements [readAheadStart, readAheadEnd) of the dataset.
+    DSLength readAheadStart, readAheadEnd;
+    std::vector<T> readAheadBuffer;
 };
 
 class HDFStringArray : public HDFArray<std::string>
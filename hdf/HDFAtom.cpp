@@ -31,6 +31,7 @@ void HDFAtom<std::vector<int> >::Write(const std::vector<int> vect)
     hsize_t length = vect.size();
     H5::DataType baseType = H5::PredType::NATIVE_INT;
     H5::ArrayType arrayDataType(baseType, 1, &length);
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(arrayDataType, &((vect)[0]));
 }
 
@@ -39,48 +40,56 @@ void HDFAtom<std::string>::Write(std::string value)
 {
     //	H5::StrType strType(0, value.size());
     H5::StrType strType(0, H5T_VARIABLE);
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(strType, std::string(value.c_str()));
 }
 
 template <>
 void HDFAtom<uint64_t>::Write(uint64_t value)
 {
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(H5::PredType::STD_I64LE, &value);
 }
 
 template <>
 void HDFAtom<int>::Write(int value)
 {
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(H5::PredType::NATIVE_INT, &value);
 }
 
 template <>
 void HDFAtom<unsigned int>::Write(unsigned int value)
 {
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(H5::PredType::NATIVE_INT, &value);
 }
 
 template <>
 void HDFAtom<unsigned char>::Write(unsigned char value)
 {
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(H5::PredType::NATIVE_UINT8, &value);
 }
 
 template <>
 void HDFAtom<uint16_t>::Write(uint16_t value)
 {
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(H5::PredType::NATIVE_UINT16, &value);
 }
 
 template <>
 void HDFAtom<char>::Write(char value)
 {
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(H5::PredType::NATIVE_INT8, &value);
 }
 
 template <>
 void HDFAtom<float>::Write(float value)
 {
+    HDFIOTimer timer(attribute, HDFIOStats::Write);
     attribute.write(H5::PredType::NATIVE_FLOAT, &value);
 }
 
@@ -92,6 +101,7 @@ void HDFAtom<std::string>::Read(std::string &value)
 	 * variable length std::string.  To decide which, query the
 	 * isVariableStr() option.
 	 */
+    HDFIOTimer timer(attribute, HDFIOStats::Read);
     H5::StrType stringType = attribute.getStrType();
     bool stringIsVariableLength = stringType.isVariableStr();
     if (stringIsVariableLength)
@@ -110,6 +120,7 @@ template <>
 void HDFAtom<int>::Read(int &value)
 {
     H5::DataType intType(H5::PredType::NATIVE_INT);
+    HDFIOTimer timer(attribute, HDFIOStats::Read);
     attribute.read(intType, &value);
 }
 
@@ -117,6 +128,7 @@ template <>
 void HDFAtom<uint16_t>::Read(uint16_t &value)
 {
     H5::DataType intType(H5::PredType::NATIVE_UINT16);
+    HDFIOTimer timer(attribute, HDFIOStats::Read);
     attribute.read(intType, &value);
 }
 
@@ -124,6 +136,7 @@ template <>
 void HDFAtom<uint64_t>::Read(uint64_t &value)
 {
     H5::DataType intType(H5::PredType::STD_I64LE);
+    HDFIOTimer timer(attribute, HDFIOStats::Read);
     attribute.read(intType, &value);
 }
 
@@ -131,6 +144,7 @@ template <>
 void HDFAtom<unsigned int>::Read(unsigned int &value)
 {
     H5::DataType uintType(H5::PredType::NATIVE_UINT);
+    HDFIOTimer timer(attribute, HDFIOStats::Read);
     attribute.read(uintType, &value);
 }
 
@@ -138,6 +152,7 @@ template <>
 void HDFAtom<float>::Read(float &value)
 {
     H5::DataType type(H5::PredType::NATIVE_FLOAT);
+    HDFIOTimer timer(attribute, HDFIOStats::Read);
     attribute.read(type, &value);
 }
 
@@ -161,6 +176,7 @@ void HDFAtom<std::vector<std::string> >::Read(std::vector<std::string> &values)
     std::vector<char *> ptrsToHDFControlledMemory;
     ptrsToHDFControlledMemory.resize(nPoints);
     // Copy the pointers.
+    HDFIOTimer timer(attribute, HDFIOStats::Read);
     attribute.read(attrType, &ptrsToHDFControlledMemory[0]);
     // Copy the std::strings into memory the main program has control over.
     unsigned int i;
@@ -11,6 +11,7 @@
 #include <hdf/HDFConfig.hpp>
 #include <hdf/HDFData.hpp>
 #include <hdf/HDFGroup.hpp>
+#include <hdf/HDFIOStats.hpp>
 
 template <typename T>
 class HDFAtom : public HDFData
@@ -83,6 +84,7 @@ public:
         H5::StrType strType(0, value.size());
         attribute = object.createAttribute(name.c_str(), strType, H5::DataSpace(0, NULL));
         isInitialized = true;
+        HDFIOTimer timer(attribute, HDFIOStats::Write);
         attribute.write(strType, value.c_str());
     }
 
@@ -92,6 +94,7 @@ public:
         H5::ArrayType arrayDataType(H5::PredType::NATIVE_INT, 1, &length);
         attribute = object.createAttribute(name.c_str(), H5::PredType::NATIVE_INT,
                                            H5::DataSpace(1, &length));
+        HDFIOTimer timer(attribute, HDFIOStats::Write);
         attribute.write(H5::PredType::NATIVE_INT, &((vect)[0]));
     }
 
@@ -101,7 +104,13 @@ public:
         H5::StrType strType(0, H5T_VARIABLE);
         H5::ArrayType arrayDataType(strType, 1, &length);
         attribute = object.createAttribute(name.c_str(), strType, H5::DataSpace(1, &length));
-        attribute.write(strType, &((vect)[0]));
+        // Variable length strings are written from an array of char pointers.
+        std::vector<const char *> strings(vect.size());
+        for (size_t i = 0; i < vect.size(); i++) {
+            strings[i] = vect[i].c_str();
+        }
+        HDFIOTimer timer(attribute, HDFIOStats::Write);
+        attribute.write(strType, &strings[0]);
     }
 
     void TypedCreate(H5::H5Object &object, const std::string &atomName, H5::DataSpace &dataSpace)
@@ -68,6 +68,8 @@ public:
     DSLength curBasePos;
     UInt curRead;
     DSLength nBases;
+    // GetNext stops before this read, see SetReadRange.
+    UInt endRead;
 
     bool hasRegionTable;
 
@@ -135,6 +137,25 @@ public:
         return GetNext(read);
     }
 
+    //
+    // Only read reads [rangeBegin, rangeEnd), e.g. a range from
+    // GetShardReadRange(), starting at the first base of rangeBegin.
+    // To read shards concurrently, open one reader per thread. Note that
+    // HDF5 calls from different threads are only safe when the library is
+    // built thread-safe; otherwise callers must serialize them.
+    //
+    void SetReadRange(UInt rangeBegin, UInt rangeEnd)
+    {
+        if (preparedForRandomAccess == false) {
+            PrepareForRandomAccess();
+        }
+        assert(rangeBegin <= rangeEnd and rangeEnd <= nReads);
+        curRead = rangeBegin;
+        curBasePos = (rangeBegin < nReads) ? eventOffset[rangeBegin] : nBases;
+        zmwReader.curZMW = rangeBegin;
+        endRead = rangeEnd;
+    }
+
     std::string GetRunCode() { return scanDataReader.GetRunCode(); }
 
     T_HDFBasReader()
@@ -142,6 +163,7 @@ public:
         curRead = 0;
         curBasePos = 0;
         nBases = 0;
+        endRead = 0;
         preparedForRandomAccess = false;
         readBasesFromCCS = false;
         baseCallsGroupName = "BaseCalls";
@@ -530,6 +552,7 @@ public:
         // number indices to keep track of reads, etc..
         //
         nReads = zmwReader.numEventArray.arrayLength;
+        endRead = nReads;
 
         if (scanDataReader.platformId == Astro) {
             if (InitializeAstro() == 0) {
@@ -592,7 +615,8 @@ public:
 
     int GetNext(FASTASequence &seq)
     {
-        if (curRead == nReads) {
+        if (curRead >= endRead) {
+            ReleaseReadBuffers();
             return 0;
         }
 
@@ -611,7 +635,8 @@ public:
     int GetNext(FASTQSequence &seq)
     {
         try {
-            if (curRead == nReads) {
+            if (curRead >= endRead) {
+                ReleaseReadBuffers();
                 return 0;
             }
             DNALength seqLength = GetNextWithoutPosAdvance(seq);
@@ -659,7 +684,8 @@ public:
     int GetNextBases(SMRTSequence &seq, bool readQVs)
     {
         try {
-            if (curRead == nReads) {
+            if (curRead >= endRead) {
+                ReleaseReadBuffers();
                 return 0;
             }
 
@@ -716,7 +742,8 @@ public:
         //
         try {
             // must check before looking at HQRegionSNR/ReadScore!!
-            if (curRead == nReads) {
+            if (curRead >= endRead) {
+                ReleaseReadBuffers();
                 return 0;
             }
 
@@ -765,6 +792,85 @@ public:
         return retVal;
     }
 
+    //
+    // Read each field in blocks that cover about nZmws ZMWs, with one
+    // HDF5 call per field per block instead of one per field per read.
+    // Must be called after Initialize(); 0 turns block reads off.
+    // Memory used is about nZmws times the average read length for each
+    // per-base field read.
+    //
+    void SetReadBlockSize(UInt nZmws)
+    {
+        DSLength zmwBlockSize = nZmws;
+        DSLength baseBlockSize = 0;
+        if (nZmws > 0 and nReads > 0) {
+            baseBlockSize = std::max(static_cast<DSLength>(1), nBases / nReads * nZmws);
+        }
+        // Per-base fields.
+        baseArray.SetReadAheadSize(baseBlockSize);
+        qualArray.SetReadAheadSize(baseBlockSize);
+        deletionQVArray.SetReadAheadSize(baseBlockSize);
+        deletionTagArray.SetReadAheadSize(baseBlockSize);
+        insertionQVArray.SetReadAheadSize(baseBlockSize);
+        substitutionTagArray.SetReadAheadSize(baseBlockSize);
+        substitutionQVArray.SetReadAheadSize(baseBlockSize);
+        mergeQVArray.SetReadAheadSize(baseBlockSize);
+        basWidthInFramesArray.SetReadAheadSize(baseBlockSize);
+        preBaseFramesArray.SetReadAheadSize(baseBlockSize);
+        pulseIndexArray.SetReadAheadSize(baseBlockSize);
+        // Per-ZMW fields.
+        zmwReader.numEventArray.SetReadAheadSize(zmwBlockSize);
+        zmwReader.holeNumberArray.SetReadAheadSize(zmwBlockSize);
+        zmwReader.holeStatusArray.SetReadAheadSize(zmwBlockSize);
+        simulatedCoordinateArray.SetReadAheadSize(zmwBlockSize);
+        simulatedSequenceIndexArray.SetReadAheadSize(zmwBlockSize);
+        readScoreArray.SetReadAheadSize(zmwBlockSize);
+    }
+
+    //
+    // Bytes held in read-ahead blocks, see SetReadBlockSize.
+    //
+    DSLength GetReadBufferBytes()
+    {
+        return baseArray.GetReadAheadBytes() + qualArray.GetReadAheadBytes() +
+               deletionQVArray.GetReadAheadBytes() + deletionTagArray.GetReadAheadBytes() +
+               insertionQVArray.GetReadAheadBytes() + substitutionTagArray.GetReadAheadBytes() +
+               substitutionQVArray.GetReadAheadBytes() + mergeQVArray.GetReadAheadBytes() +
+               basWidthInFramesArray.GetReadAheadBytes() + preBaseFramesArray.GetReadAheadBytes() +
+               pulseIndexArray.GetReadAheadBytes() + zmwReader.numEventArray.GetReadAheadBytes() +
+               zmwReader.holeNumberArray.GetReadAheadBytes() +
+               zmwReader.holeStatusArray.GetReadAheadBytes() +
+               simulatedCoordinateArray.GetReadAheadBytes() +
+               simulatedSequenceIndexArray.GetReadAheadBytes() + readScoreArray.GetReadAheadBytes();
+    }
+
+    //
+    // Free read-ahead blocks after recording their size in
+    // peakBufferBytes.  GetNext calls this when it reaches the end of the
+    // read range, so a reader that is done holds no per-read buffers.
+    //
+    void ReleaseReadBuffers()
+    {
+        RecordBufferBytes(GetReadBufferBytes());
+        baseArray.ClearReadAhead();
+        qualArray.ClearReadAhead();
+        deletionQVArray.ClearReadAhead();
+        deletionTagArray.ClearReadAhead();
+        insertionQVArray.ClearReadAhead();
+        substitutionTagArray.ClearReadAhead();
+        substitutionQVArray.ClearReadAhead();
+        mergeQVArray.ClearReadAhead();
+        basWidthInFramesArray.ClearReadAhead();
+        preBaseFramesArray.ClearReadAhead();
+        pulseIndexArray.ClearReadAhead();
+        zmwReader.numEventArray.ClearReadAhead();
+        zmwReader.holeNumberArray.ClearReadAhead();
+        zmwReader.holeStatusArray.ClearReadAhead();
+        simulatedCoordinateArray.ClearReadAhead();
+        simulatedSequenceIndexArray.ClearReadAhead();
+        readScoreArray.ClearReadAhead();
+    }
+
     void GetAllPulseIndex(std::vector<int> &pulseIndex)
     {
         CheckMemoryAllocation(pulseIndexArray.arrayLength, maxAllocNElements, "PulseIndex");
@@ -806,10 +912,10 @@ public:
     UInt Advance(UInt nSeq)
     {
         // cannot advance past the end of this file
-        if (curRead + nSeq >= nReads) {
+        if (curRead + nSeq >= endRead) {
             return 0;
         }
-        for (UInt i = curRead; i < curRead + nSeq && i < nReads; i++) {
+        for (UInt i = curRead; i < curRead + nSeq && i < endRead; i++) {
             DNALength seqLength;
             zmwReader.numEventArray.Read(i, i + 1, &seqLength);
             curBasePos += seqLength;
@@ -972,7 +1078,7 @@ public:
 
     void Close()
     {
-
+        ReleaseReadBuffers();
         baseCallsGroup.Close();
         zmwXCoordArray.Close();
         zmwYCoordArray.Close();
@@ -288,6 +288,7 @@ public:
 
     int WriteQualities(FASTQSequence &seq)
     {
+        seq.LoadQVs(FASTQTracks);
         qualArray.Write(seq.qual.data, seq.length);
 
         if (includedFields["DeletionQV"] and seq.deletionQV.Empty() == false) {
@@ -329,6 +330,7 @@ public:
         WriteBases(seq);
         WriteQualities(seq);
 
+        seq.LoadQVs(PreBaseFramesTrack | PulseWidthTrack);
         if (includedFields["PreBaseFrames"] and seq.preBaseFrames != NULL) {
             preBaseFramesArray.Write(seq.preBaseFrames, seq.length);
         }
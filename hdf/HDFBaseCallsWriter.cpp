@@ -31,8 +31,9 @@ std::vector<PacBio::BAM::BaseFeature> HDFBaseCallsWriter::WritableQVs(
 HDFBaseCallsWriter::HDFBaseCallsWriter(const std::string& filename, HDFGroup& parentGroup,
                                        const std::map<char, size_t>& baseMap,
                                        const std::string& basecallerVersion,
-                                       const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite)
-    : HDFWriterBase(filename)
+                                       const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
+                                       const HDFWriteOptions& writeOptions)
+    : HDFWriterBase(filename, writeOptions)
     , parentGroup_(parentGroup)
     , qvsToWrite_({})
     , basecallerVersion_(basecallerVersion)
@@ -49,6 +50,7 @@ HDFBaseCallsWriter::HDFBaseCallsWriter(const std::string& filename, HDFGroup& pa
     }
 
     // Initialize the 'basecall' group.
+    basecallArray_.SetWriteOptions(writeOptions_);
     basecallArray_.Initialize(basecallsGroup_, PacBio::GroupNames::basecall);
 
     qvsToWrite_ = HDFBaseCallsWriter::WritableQVs(qvsToWrite);
@@ -60,10 +62,11 @@ HDFBaseCallsWriter::HDFBaseCallsWriter(const std::string& filename, HDFGroup& pa
     }
 
     // Create a zmwWriter.
-    zmwWriter_.reset(new HDFZMWWriter(filename, basecallsGroup_));
+    zmwWriter_.reset(new HDFZMWWriter(filename, basecallsGroup_, writeOptions_));
 
     // Create a zmwMetricsWriter.
-    zmwMetricsWriter_.reset(new HDFZMWMetricsWriter(filename, basecallsGroup_, baseMap));
+    zmwMetricsWriter_.reset(
+        new HDFZMWMetricsWriter(filename, basecallsGroup_, baseMap, writeOptions_));
 }
 
 std::vector<std::string> HDFBaseCallsWriter::Errors(void) const
@@ -91,6 +94,15 @@ bool HDFBaseCallsWriter::InitializeQVGroups(void)
 {
     int ret = 1;
 
+    for (BufferedHDFArray<unsigned char>* array :
+         {&deletionQVArray_, &deletionTagArray_, &insertionQVArray_, &mergeQVArray_,
+          &substitutionQVArray_, &substitutionTagArray_}) {
+        array->SetWriteOptions(writeOptions_);
+    }
+    for (BufferedHDFArray<HalfWord>* array : {&ipdArray_, &pulseWidthArray_, &pulseIndexArray_}) {
+        array->SetWriteOptions(writeOptions_);
+    }
+
     // normal datasets
     if (_HasQV(PacBio::BAM::BaseFeature::DELETION_QV))
         ret *= deletionQVArray_.Initialize(basecallsGroup_, PacBio::GroupNames::deletionqv);
@@ -179,6 +191,7 @@ bool HDFBaseCallsWriter::_WriteQualityValue(const SMRTSequence & read) {
 bool HDFBaseCallsWriter::_WriteDeletionQV(const SMRTSequence& read)
 {
     if (HasDeletionQV()) {
+        read.LoadQVs(DeletionQV);
         if (read.deletionQV.Empty()) {
             AddErrorMessage(std::string(PacBio::GroupNames::deletionqv) + " absent in read " +
                             read.GetTitle());
@@ -194,6 +207,7 @@ bool HDFBaseCallsWriter::_WriteDeletionQV(const SMRTSequence& read)
 bool HDFBaseCallsWriter::_WriteDeletionTag(const SMRTSequence& read)
 {
     if (HasDeletionTag()) {
+        read.LoadQVs(DeletionTag);
         if (read.deletionTag == nullptr) {
             AddErrorMessage(std::string(PacBio::GroupNames::deletiontag) + " absent in read " +
                             read.GetTitle());
@@ -209,6 +223,7 @@ bool HDFBaseCallsWriter::_WriteDeletionTag(const SMRTSequence& read)
 bool HDFBaseCallsWriter::_WriteInsertionQV(const SMRTSequence& read)
 {
     if (HasInsertionQV()) {
+        read.LoadQVs(InsertionQV);
         if (read.insertionQV.Empty()) {
             AddErrorMessage(std::string(PacBio::GroupNames::insertionqv) + " absent in read " +
                             read.GetTitle());
@@ -224,6 +239,7 @@ bool HDFBaseCallsWriter::_WriteInsertionQV(const SMRTSequence& read)
 bool HDFBaseCallsWriter::_WriteSubstitutionTag(const SMRTSequence& read)
 {
     if (HasSubstitutionTag()) {
+        read.LoadQVs(SubstitutionTag);
         if (read.substitutionTag == nullptr) {
             AddErrorMessage(std::string(PacBio::GroupNames::substitutiontag) + " absent in read " +
                             read.GetTitle());
@@ -239,6 +255,7 @@ bool HDFBaseCallsWriter::_WriteSubstitutionTag(const SMRTSequence& read)
 bool HDFBaseCallsWriter::_WriteSubstitutionQV(const SMRTSequence& read)
 {
     if (HasSubstitutionQV()) {
+        read.LoadQVs(SubstitutionQV);
         if (read.substitutionQV.Empty()) {
             AddErrorMessage(std::string(PacBio::GroupNames::substitutionqv) + " absent in read " +
                             read.GetTitle());
@@ -254,6 +271,7 @@ bool HDFBaseCallsWriter::_WriteSubstitutionQV(const SMRTSequence& read)
 bool HDFBaseCallsWriter::_WriteMergeQV(const SMRTSequence& read)
 {
     if (HasMergeQV()) {
+        read.LoadQVs(MergeQV);
         if (read.mergeQV.Empty()) {
             AddErrorMessage(std::string(PacBio::GroupNames::mergeqv) + " absent in read " +
                             read.GetTitle());
@@ -269,6 +287,7 @@ bool HDFBaseCallsWriter::_WriteMergeQV(const SMRTSequence& read)
 bool HDFBaseCallsWriter::_WriteIPD(const SMRTSequence& read)
 {
     if (HasIPD()) {
+        read.LoadQVs(PreBaseFramesTrack);
         if (read.preBaseFrames == nullptr) {
             AddErrorMessage(std::string(PacBio::GroupNames::prebaseframes) + " absent in read " +
                             read.GetTitle());
@@ -284,6 +303,7 @@ bool HDFBaseCallsWriter::_WriteIPD(const SMRTSequence& read)
 bool HDFBaseCallsWriter::_WritePulseWidth(const SMRTSequence& read)
 {
     if (HasPulseWidth()) {
+        read.LoadQVs(PulseWidthTrack);
         if (read.widthInFrames == nullptr) {
             AddErrorMessage(std::string(PacBio::GroupNames::widthinframes) + " absent in read " +
                             read.GetTitle());
@@ -358,6 +378,7 @@ void HDFBaseCallsWriter::Flush(void)
 void HDFBaseCallsWriter::Close(void)
 {
     this->Flush();
+    WaitForWrites();
 
     try {
         _WriteAttributes();
@@ -30,7 +30,8 @@ public:
 public:
     HDFBaseCallsWriter(const std::string& filename, HDFGroup& parentGroup,
                        const std::map<char, size_t>& baseMap, const std::string& basecallerVersion,
-                       const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite = {});
+                       const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite = {},
+                       const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     ~HDFBaseCallsWriter(void);
 
@@ -7,8 +7,9 @@
 HDFBaxWriter::HDFBaxWriter(const std::string& filename, const std::string& basecallerVersion,
                            const std::map<char, size_t>& baseMap,
                            const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
-                           const H5::FileAccPropList& fileAccPropList)
-    : HDFWriterBase(filename)
+                           const H5::FileAccPropList& fileAccPropList,
+                           const HDFWriteOptions& writeOptions)
+    : HDFWriterBase(filename, writeOptions)
     , fileaccproplist_(fileAccPropList)
     , basecallsWriter_(nullptr)
     , regionsWriter_(nullptr)
@@ -24,25 +25,28 @@ HDFBaxWriter::HDFBaxWriter(const std::string& filename, const std::string& basec
         AddErrorMessage("Base caller version must be specified.");
     }
     // Create a BaseCaller writer.
-    basecallsWriter_.reset(
-        new HDFBaseCallsWriter(filename_, pulseDataGroup_, baseMap, basecallerVersion, qvsToWrite));
+    basecallsWriter_.reset(new HDFBaseCallsWriter(filename_, pulseDataGroup_, baseMap,
+                                                  basecallerVersion, qvsToWrite, writeOptions_));
 }
 
 HDFBaxWriter::HDFBaxWriter(const std::string& filename, const std::string& basecallerVersion,
                            const std::map<char, size_t>& baseMap,
                            const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
                            const std::vector<std::string>& regionTypes,
-                           const H5::FileAccPropList& fileAccPropList)
-    : HDFBaxWriter(filename, basecallerVersion, baseMap, qvsToWrite, fileAccPropList)
+                           const H5::FileAccPropList& fileAccPropList,
+                           const HDFWriteOptions& writeOptions)
+    : HDFBaxWriter(filename, basecallerVersion, baseMap, qvsToWrite, fileAccPropList, writeOptions)
 {
     // Create a Regions writer.
-    regionsWriter_.reset(new HDFRegionsWriter(filename_, pulseDataGroup_, regionTypes));
+    regionsWriter_.reset(
+        new HDFRegionsWriter(filename_, pulseDataGroup_, regionTypes, writeOptions_));
 }
 
 HDFBaxWriter::~HDFBaxWriter(void) { this->Close(); }
 
 void HDFBaxWriter::Flush(void)
 {
+    if (not basecallsWriter_) return;
     basecallsWriter_->Flush();
     if (HasRegions()) regionsWriter_->Flush();
 }
@@ -51,8 +55,10 @@ std::vector<std::string> HDFBaxWriter::Errors(void)
 {
     std::vector<std::string> errors = errors_;
 
-    for (auto error : basecallsWriter_->Errors())
-        errors.emplace_back(error);
+    if (basecallsWriter_) {
+        for (auto error : basecallsWriter_->Errors())
+            errors.emplace_back(error);
+    }
 
     if (HasRegions()) {
         for (auto error : regionsWriter_->Errors())
@@ -64,8 +70,15 @@ std::vector<std::string> HDFBaxWriter::Errors(void)
 
 void HDFBaxWriter::Close(void)
 {
+    if (basecallsWriter_) {
+        this->Flush();
+        WaitForWrites();
+        // Keep errors of writers destroyed below.
+        errors_ = this->Errors();
+    }
     if (basecallsWriter_) basecallsWriter_.reset();
     if (HasRegions() and regionsWriter_) regionsWriter_.reset();
+    WaitForWrites();
     outfile_.Close();
 }
 
@@ -30,10 +30,12 @@ public:
     /// \param[in] basecallerVersion meta data string
     /// \param[in] qvsToWrite Quality values to include in output h5 file.
     /// \param[in] fileAccPropList H5 file access property list
+    /// \param[in] writeOptions chunking and compression of datasets
     HDFBaxWriter(const std::string& filename, const std::string& basecallerVersion,
                  const std::map<char, size_t>& baseMap,
                  const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
-                 const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT);
+                 const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT,
+                 const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     /// \brief Sets output h5 file name, scan data, base caller version
     ///        QVs to write, regions types and h5 file access property list.
@@ -43,7 +45,8 @@ public:
                  const std::map<char, size_t>& baseMap,
                  const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
                  const std::vector<std::string>& regionTypes,
-                 const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT);
+                 const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT,
+                 const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     ~HDFBaxWriter(void);
 
@@ -68,6 +71,11 @@ public:
     /// \returns all errors from all writers.
     std::vector<std::string> Errors(void);
 
+    /// \brief Flushes buffered data, waits for writes queued on
+    ///        WriteOptions().writeQueue, and closes the file. Failed
+    ///        writes are reported by Errors(). Called by the destructor.
+    void Close(void);
+
     /// \}
 
 private:
@@ -86,8 +94,6 @@ private:
 private:
     /// \name Private Methods.
     /// \{
-    /// \brief Closes HDFBaxWriter.
-    void Close(void);
     /// \}
 };
 
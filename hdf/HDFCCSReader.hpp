@@ -1,6 +1,8 @@
 #ifndef _BLASR_HDF_CCS_READER_HPP_
 #define _BLASR_HDF_CCS_READER_HPP_
 
+#include <numeric>
+
 #include <hdf/HDFBasReader.hpp>
 
 template <typename T_Sequence>
@@ -16,7 +18,7 @@ public:
 
     HDFZMWReader zmwReader;
     T_HDFBasReader<SMRTSequence> ccsBasReader;
-    int curPassPos;
+    DSLength curPassPos;
 
     HDFCCSReader() : T_HDFBasReader<T_Sequence>()
     {
@@ -71,6 +73,21 @@ public:
         return fileContainsCCS;
     }
 
+    //
+    // Only read ccs reads of zmws [rangeBegin, rangeEnd), moving the
+    // unrolled, ccs and pass cursors to the start of rangeBegin.
+    //
+    void SetReadRange(UInt rangeBegin, UInt rangeEnd)
+    {
+        T_HDFBasReader<T_Sequence>::SetReadRange(rangeBegin, rangeEnd);
+        ccsBasReader.SetReadRange(rangeBegin, rangeEnd);
+        std::vector<UInt> numPasses(rangeBegin);
+        if (rangeBegin > 0) {
+            numPassesArray.Read(0, rangeBegin, &numPasses[0]);
+        }
+        curPassPos = std::accumulate(numPasses.begin(), numPasses.end(), static_cast<DSLength>(0));
+    }
+
     int Advance(int nSteps)
     {
         (void)(nSteps);
@@ -203,7 +220,7 @@ public:
 
         ccsSequence.Free();
         int retVal = 0;
-        if (this->curRead == ccsBasReader.nReads) {
+        if (this->curRead >= this->endRead) {
             return 0;
         }
         if (this->curBasePos == ccsBasReader.nBases) {
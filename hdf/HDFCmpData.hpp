@@ -23,7 +23,13 @@ public:
     std::map<std::string, int> nameToAlignmentGroupIndex;
     static const char *colNameIds[];
 
-    void Close() { hdfCmpFile.close(); }
+    virtual ~HDFCmpData() {}
+
+    virtual void Close()
+    {
+        hdfCmpFile.close();
+        HDFIOStats::Instance().Report();
+    }
 };
 
 const char *HDFCmpData::colNameIds[] = {"00", "01", "02", "03", "04", "05", "06", "07",
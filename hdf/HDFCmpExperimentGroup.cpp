@@ -9,6 +9,7 @@ bool HDFCmpExperimentGroup::Create(HDFGroup &parent, std::string experimentGroup
     if (experimentGroup.Initialize(parent.group, experimentGroupName) == 0) {
         return 0;
     }
+    alignmentArray.SetWriteOptions(writeOptions);
     alignmentArray.Create(experimentGroup, "AlnArray");
     return true;
 }
@@ -25,15 +26,8 @@ void HDFCmpExperimentGroup::AddAlignment(std::vector<unsigned char> &alignment,
         return;
     }
 
-    // Make a copy of alignment.
-    std::vector<unsigned char> paddedAlignment = alignment;
-    // Pad '0' to the end of the alignment.
-    paddedAlignment.push_back(0);
-
-    offsetBegin = alignmentArray.size();         // 0 based, inclusive
-    offsetEnd = offsetBegin + alignment.size();  // 0 based, exclusive
+    AddValues(alignmentArray, pendingQVs, alignment, &offsetBegin, &offsetEnd);
     // alignmentArray[offsetEnd] is not a part of the real alignment, it is the padded 0.
-    alignmentArray.Write(&paddedAlignment[0], paddedAlignment.size());
 }
 
 //template<typename T>
@@ -115,7 +109,7 @@ int HDFCmpExperimentGroup::Initialize(HDFGroup &refGroup, std::string experiment
     return 1;
 }
 
-HDFCmpExperimentGroup::HDFCmpExperimentGroup()
+HDFCmpExperimentGroup::HDFCmpExperimentGroup() : writeBufferSize(0)
 {
     fields["StartTimeOffset"] = &this->startTimeOffset;
     fields["QualityValue"] = &this->qualityValue;
@@ -152,8 +146,6 @@ void HDFCmpExperimentGroup::AddQVs(const std::vector<UChar> &qualityValues,
                                    const std::string &fieldName, unsigned int *offsetBegin,
                                    unsigned int *offsetEnd)
 {
-    std::vector<UChar> paddedQualityValues = qualityValues;
-    paddedQualityValues.push_back(0);
     HDFArray<UChar> *arrayPtr = NULL;
 
     // This seems to be how we do it
@@ -169,19 +161,17 @@ void HDFCmpExperimentGroup::AddQVs(const std::vector<UChar> &qualityValues,
         assert(false);
     }
 
-    if (!arrayPtr->isInitialized) arrayPtr->Initialize(experimentGroup, fieldName);
-    *offsetBegin = arrayPtr->size();
-    *offsetEnd = arrayPtr->size() + qualityValues.size();
-
-    arrayPtr->Write(&paddedQualityValues[0], paddedQualityValues.size());
+    if (!arrayPtr->isInitialized) {
+        arrayPtr->SetWriteOptions(writeOptions);
+        arrayPtr->Initialize(experimentGroup, fieldName);
+    }
+    AddValues(*arrayPtr, pendingQVs, qualityValues, offsetBegin, offsetEnd);
 }
 
 void HDFCmpExperimentGroup::AddTags(const std::vector<char> &qualityValues,
                                     const std::string &fieldName, unsigned int *offsetBegin,
                                     unsigned int *offsetEnd)
 {
-    std::vector<char> paddedQualityValues = qualityValues;
-    paddedQualityValues.push_back(0);
     HDFArray<char> *arrayPtr = NULL;
 
     if (fieldName == "DeletionTag") {
@@ -192,9 +182,57 @@ void HDFCmpExperimentGroup::AddTags(const std::vector<char> &qualityValues,
         assert(false);
     }
 
-    if (!arrayPtr->isInitialized) arrayPtr->Initialize(experimentGroup, fieldName);
-    *offsetBegin = arrayPtr->size();
-    *offsetEnd = arrayPtr->size() + qualityValues.size();
+    if (!arrayPtr->isInitialized) {
+        arrayPtr->SetWriteOptions(writeOptions);
+        arrayPtr->Initialize(experimentGroup, fieldName);
+    }
+    AddValues(*arrayPtr, pendingTags, qualityValues, offsetBegin, offsetEnd);
+}
+
+void HDFCmpExperimentGroup::Flush()
+{
+    for (auto &pending : pendingQVs) {
+        FlushValues(*pending.first, pending.second);
+    }
+    for (auto &pending : pendingTags) {
+        FlushValues(*pending.first, pending.second);
+    }
+}
 
-    arrayPtr->Write(&paddedQualityValues[0], paddedQualityValues.size());
+template <typename T>
+void HDFCmpExperimentGroup::AddValues(HDFArray<T> &array,
+                                      std::map<HDFArray<T> *, PendingValues<T> > &pendingArrays,
+                                      const std::vector<T> &values, unsigned int *offsetBegin,
+                                      unsigned int *offsetEnd)
+{
+    if (writeBufferSize <= 0) {
+        // Make a copy of values, and pad '0' to the end.
+        std::vector<T> paddedValues = values;
+        paddedValues.push_back(0);
+        *offsetBegin = array.size();                // 0 based, inclusive
+        *offsetEnd = *offsetBegin + values.size();  // 0 based, exclusive
+        array.Write(&paddedValues[0], paddedValues.size());
+        return;
+    }
+
+    PendingValues<T> &pending = pendingArrays[&array];
+    if (pending.values.empty()) {
+        // Query the dataset once per batch rather than once per value.
+        pending.datasetLength = array.size();
+    }
+    *offsetBegin = pending.datasetLength + pending.values.size();
+    *offsetEnd = *offsetBegin + values.size();
+    pending.values.insert(pending.values.end(), values.begin(), values.end());
+    pending.values.push_back(0);
+    if (pending.values.size() >= static_cast<size_t>(writeBufferSize)) {
+        FlushValues(array, pending);
+    }
+}
+
+template <typename T>
+void HDFCmpExperimentGroup::FlushValues(HDFArray<T> &array, PendingValues<T> &pending)
+{
+    if (pending.values.empty()) return;
+    array.Write(&pending.values[0], pending.values.size());
+    pending.values.clear();
 }
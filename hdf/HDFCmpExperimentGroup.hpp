@@ -10,6 +10,7 @@
 #include <hdf/HDFArray.hpp>
 #include <hdf/HDFCmpSupportedFields.hpp>
 #include <hdf/HDFGroup.hpp>
+#include <hdf/HDFWriteOptions.hpp>
 
 class HDFCmpExperimentGroup
 {
@@ -42,6 +43,13 @@ public:
     std::map<std::string, HDFData *> fields;
     HDFGroup experimentGroup;
     HDFArray<unsigned char> alignmentArray;
+    // Chunking and compression of datasets created in this group.
+    HDFWriteOptions writeOptions;
+    // When positive, added alignments, QVs and tags are kept in memory
+    // until about writeBufferSize values of a dataset are pending, and
+    // then written with a single extension of the dataset.  0 by
+    // default, which writes each alignment as it is added.
+    int writeBufferSize;
 
     bool Create(HDFGroup &parent, std::string experimentGroupName);
 
@@ -64,9 +72,33 @@ public:
 
     void Read();
 
+    // Write all pending alignments, QVs and tags.
+    void Flush();
+
     HDFCmpExperimentGroup();
 
     // Return reference alignment AlnArray size in KB.
     UInt GetAlnArraySize();
+
+private:
+    // Values added to a dataset but not yet written to it.
+    template <typename T>
+    struct PendingValues
+    {
+        // Length of the dataset on disk, valid while values is not empty.
+        DSLength datasetLength;
+        std::vector<T> values;
+    };
+
+    template <typename T>
+    void AddValues(HDFArray<T> &array, std::map<HDFArray<T> *, PendingValues<T> > &pendingArrays,
+                   const std::vector<T> &values, unsigned int *offsetBegin,
+                   unsigned int *offsetEnd);
+
+    template <typename T>
+    static void FlushValues(HDFArray<T> &array, PendingValues<T> &pending);
+
+    std::map<HDFArray<UChar> *, PendingValues<UChar> > pendingQVs;
+    std::map<HDFArray<char> *, PendingValues<char> > pendingTags;
 };
 #endif
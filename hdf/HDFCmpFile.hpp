@@ -1,6 +1,7 @@
 #ifndef _BLASR_HDF_CMP_FILE_HPP_
 #define _BLASR_HDF_CMP_FILE_HPP_
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <map>
@@ -24,6 +25,7 @@
 #include <hdf/HDFRefInfoGroup.hpp>
 #include <pbdata/SMRTSequence.hpp>
 #include <pbdata/alignment/CmpAlignment.hpp>  // not ../alignment!
+#include <pbdata/saf/AlnWindowIndex.hpp>
 #include <pbdata/saf/RefInfo.hpp>
 // alignment/datastructures/alignment  -- Yes, seriously.
 #include <alignment/datastructures/alignment/ByteAlignment.h>
@@ -54,6 +56,16 @@ public:
     HDFCmpSupportedFields supportedFields;
     HDFAtom<std::string> readTypeAtom;
     HDFFileLogGroup fileLogGroup;
+    HDFWriteOptions writeOptions;
+    // Values of each AlnArray, QV and AlnIndex dataset kept in memory
+    // before they are written, or 0 to write alignments as they are stored.
+    int writeBufferSize;
+    AlnWindowIndex windowIndex;
+
+    HDFCmpFile() : writeBufferSize(0) {}
+
+    // Alignments still buffered are written before the file is closed.
+    ~HDFCmpFile() { Flush(); }
 
     void AstroInitializeColumnNameMap()
     {
@@ -157,6 +169,54 @@ public:
         versionAtom.Write("2.0.0");
     }
 
+    //
+    // Set chunking and compression of the AlnArray and QV datasets of
+    // reference groups added after this call.  Alignments are written
+    // unbuffered, so the write buffer size of options is not used; see
+    // SetWriteBufferSize.
+    //
+    void SetWriteOptions(const HDFWriteOptions &options)
+    {
+        writeOptions = options;
+        writeOptions.bufferSize = 0;
+    }
+
+    //
+    // Keep up to bufferSize values of each AlnArray, QV and AlnIndex
+    // dataset in memory and write them in one extension of the dataset.
+    // Flush, Close or the destructor writes what remains.  0 (the
+    // default) writes each alignment as it is stored.
+    //
+    void SetWriteBufferSize(int bufferSize)
+    {
+        Flush();
+        writeBufferSize = bufferSize;
+        alnInfoGroup.SetWriteBufferSize(bufferSize);
+        for (HDFCmpRefAlignmentGroup *refAlignGroup : refAlignGroups) {
+            refAlignGroup->writeBufferSize = bufferSize;
+            for (HDFCmpExperimentGroup *readGroup : refAlignGroup->readGroups) {
+                readGroup->writeBufferSize = bufferSize;
+            }
+        }
+    }
+
+    // Write the alignments, QVs and AlnIndex rows buffered so far.
+    void Flush()
+    {
+        for (HDFCmpRefAlignmentGroup *refAlignGroup : refAlignGroups) {
+            for (HDFCmpExperimentGroup *readGroup : refAlignGroup->readGroups) {
+                readGroup->Flush();
+            }
+        }
+        alnInfoGroup.Flush();
+    }
+
+    void Close()
+    {
+        Flush();
+        HDFCmpData::Close();
+    }
+
     void SetReadType(std::string readType) { readTypeAtom.Write(readType.c_str()); }
 
     void GenerateNextRefGroupName(std::string &name)
@@ -190,6 +250,8 @@ public:
             std::cout << "ERROR, unable to allocate memory for cmp.h5 file." << std::endl;
             std::exit(EXIT_FAILURE);
         }
+        newGroup->writeOptions = writeOptions;
+        newGroup->writeBufferSize = writeBufferSize;
         newGroup->Create(rootGroup.rootGroup, refGroupName);
         refAlignGroups.push_back(newGroup);
         unsigned int id = refAlignGroups.size();
@@ -358,6 +420,7 @@ public:
 
         alnGroupGroup.Read(cmpFile.alnGroup);
         alnInfoGroup.Read(cmpFile.alnInfo);
+        windowIndex.Clear();
         refGroupGroup.Read(cmpFile.refGroup);
         movieInfoGroup.Read(cmpFile.movieInfo);
         refInfoGroup.Read(cmpFile.refInfo);
@@ -447,75 +510,90 @@ public:
         /*
          * Now that the alignment indices are all read in, read the base-by-base alignments.
          */
+        std::vector<UInt> alignmentIndices(cmpFile.alnInfo.alignments.size());
+        for (size_t i = 0; i < alignmentIndices.size(); i++) {
+            alignmentIndices[i] = static_cast<UInt>(i);
+        }
+        ReadAlignmentArrays(cmpFile, alignmentIndices);
+    }
 
-        unsigned int alignmentIndex;
-
-        for (alignmentIndex = 0; alignmentIndex < cmpFile.alnInfo.alignments.size();
-             alignmentIndex++) {
-            unsigned int alnGroupId = cmpFile.alnInfo.alignments[alignmentIndex].GetAlnGroupId();
-            unsigned int refGroupId = cmpFile.alnInfo.alignments[alignmentIndex].GetRefGroupId();
-            std::string refSeqName;
-
-            //
-            // Make sure the refGroupId specified in the alignment index exists in the alignment groups.
-            //
-            int refGroupArrayIndex;
-            if (refGroupIdToArrayIndex.find(refGroupId) == refGroupIdToArrayIndex.end()) {
-                std::cout << "ERROR! Alignment "
-                          << cmpFile.alnInfo.alignments[alignmentIndex].GetAlignmentId()
-                          << " has ref seq id " << refGroupId
-                          << " that does not exist in the HDF file." << std::endl;
-                assert(0);
-            } else {
-                refGroupArrayIndex = refGroupIdToArrayIndex[refGroupId];
-            }
-
-            //
-            // Point to the refGroup that this alignment is part of.
-            //
-            HDFCmpRefAlignmentGroup *refAlignGroup = refAlignGroups[refGroupArrayIndex];
-
-            //
-            // Now locate the read group that is part of this ref align group.
-            //
-            std::string readGroupName = alnGroupIdToReadGroupName[alnGroupId];
-
-            if (refAlignGroup->experimentNameToIndex.find(readGroupName) ==
-                refAlignGroup->experimentNameToIndex.end()) {
-                std::cout << "Internal ERROR! The read group name " << readGroupName
-                          << " is specified as part of "
-                          << " the path in alignment "
-                          << cmpFile.alnInfo.alignments[alignmentIndex].GetAlignmentId()
-                          << " though it does not exist in the ref align group specified for this "
-                             "alignment."
-                          << std::endl;
-                assert(0);
-            }
-
-            int experimentIndex;
-            experimentIndex = refAlignGroup->experimentNameToIndex[readGroupName];
-
-            unsigned int alignmentLength =
-                cmpFile.alnInfo.alignments[alignmentIndex].GetOffsetEnd() -
-                cmpFile.alnInfo.alignments[alignmentIndex].GetOffsetBegin();
-
-            std::vector<unsigned char> alignmentArray;
-            std::vector<UChar> fieldArray;
+    //
+    // Read the base-by-base alignments and included fields of only the
+    // alignments of refGroupId that overlap [tStart, tEnd) of the
+    // reference.  Read(cmpFile, false) must be called first.  The
+    // indices in cmpFile.alnInfo.alignments of the alignments read are
+    // returned in alignmentIndices, ordered by tStart.
+    //
+    void ReadWindow(CmpFile &cmpFile, unsigned int refGroupId, UInt tStart, UInt tEnd,
+                    std::vector<UInt> &alignmentIndices)
+    {
+        if (not windowIndex.IsBuilt()) {
+            windowIndex.Build(cmpFile.alnInfo);
+        }
+        alignmentIndices.clear();
+        windowIndex.Find(refGroupId, tStart, tEnd, alignmentIndices);
+        ReadAlignmentArrays(cmpFile, alignmentIndices);
+    }
 
-            if (alignmentArray.size() < alignmentLength) {
-                alignmentArray.resize(alignmentLength);
+    //
+    // Read the base-by-base alignments and included fields of the given
+    // alignments into cmpFile.alnInfo.  Alignments stored close together
+    // in the same read group are read with one HDF5 call per dataset.
+    //
+    void ReadAlignmentArrays(CmpFile &cmpFile, const std::vector<UInt> &alignmentIndices)
+    {
+        // Do not read more than this many unused bytes to join two reads.
+        const UInt maxCoalescedGap = 4096;
+        // Nor more than this many bytes in one read.
+        const UInt maxCoalescedLength = 1 << 22;
+
+        std::vector<std::pair<HDFCmpExperimentGroup *, UInt> > reads;
+        reads.reserve(alignmentIndices.size());
+        for (UInt alignmentIndex : alignmentIndices) {
+            reads.emplace_back(LookupExperimentGroup(cmpFile.alnInfo.alignments[alignmentIndex]),
+                               alignmentIndex);
+        }
+        std::sort(reads.begin(), reads.end(),
+                  [&cmpFile](const std::pair<HDFCmpExperimentGroup *, UInt> &a,
+                             const std::pair<HDFCmpExperimentGroup *, UInt> &b) {
+                      if (a.first != b.first) return a.first < b.first;
+                      return cmpFile.alnInfo.alignments[a.second].GetOffsetBegin() <
+                             cmpFile.alnInfo.alignments[b.second].GetOffsetBegin();
+                  });
+
+        std::vector<unsigned char> alignmentArray;
+        std::vector<UChar> fieldArray;
+        size_t first = 0;
+        while (first < reads.size()) {
+            HDFCmpExperimentGroup *expGroup = reads[first].first;
+            UInt readBegin = cmpFile.alnInfo.alignments[reads[first].second].GetOffsetBegin();
+            UInt readEnd = cmpFile.alnInfo.alignments[reads[first].second].GetOffsetEnd();
+            size_t last = first + 1;
+            while (last < reads.size() and reads[last].first == expGroup) {
+                CmpAlignment &alignment = cmpFile.alnInfo.alignments[reads[last].second];
+                if (alignment.GetOffsetBegin() > readEnd + maxCoalescedGap or
+                    std::max(readEnd, alignment.GetOffsetEnd()) - readBegin > maxCoalescedLength) {
+                    break;
+                }
+                readEnd = std::max(readEnd, alignment.GetOffsetEnd());
+                last++;
             }
 
             /*
-             * Read in the base by base alignment.
+             * Read in the base by base alignments.
              */
-
-            refAlignGroup->readGroups[experimentIndex]->alignmentArray.Read(
-                cmpFile.alnInfo.alignments[alignmentIndex].GetOffsetBegin(),
-                cmpFile.alnInfo.alignments[alignmentIndex].GetOffsetEnd(), &alignmentArray[0]);
-
-            cmpFile.alnInfo.alignments[alignmentIndex].StoreAlignmentArray(&alignmentArray[0],
-                                                                           alignmentLength);
+            if (alignmentArray.size() < readEnd - readBegin + 1) {
+                alignmentArray.resize(readEnd - readBegin + 1);
+            }
+            if (readEnd > readBegin) {
+                expGroup->alignmentArray.Read(readBegin, readEnd, &alignmentArray[0]);
+            }
+            for (size_t r = first; r < last; r++) {
+                CmpAlignment &alignment = cmpFile.alnInfo.alignments[reads[r].second];
+                alignment.StoreAlignmentArray(
+                    &alignmentArray[alignment.GetOffsetBegin() - readBegin],
+                    alignment.GetOffsetEnd() - alignment.GetOffsetBegin());
+            }
 
             /*
              * Read in all additional fields such as quality values, etc..
@@ -524,20 +602,68 @@ public:
             fieldEnd = includedFields.end();
 
             for (fieldIt = includedFields.begin(); fieldIt != fieldEnd; ++fieldIt) {
-                if (fieldArray.size() < alignmentLength) {
-                    fieldArray.resize(alignmentLength);
+                if (fieldArray.size() < readEnd - readBegin + 1) {
+                    fieldArray.resize(readEnd - readBegin + 1);
+                }
+                HDFArray<UChar> *fieldArrayPtr =
+                    dynamic_cast<HDFArray<UChar> *>(expGroup->fields[*fieldIt]);
+                if (readEnd > readBegin) {
+                    fieldArrayPtr->Read(readBegin, readEnd, &fieldArray[0]);
+                }
+                for (size_t r = first; r < last; r++) {
+                    CmpAlignment &alignment = cmpFile.alnInfo.alignments[reads[r].second];
+                    alignment.StoreField(*fieldIt,
+                                         &fieldArray[alignment.GetOffsetBegin() - readBegin],
+                                         alignment.GetOffsetEnd() - alignment.GetOffsetBegin());
                 }
-                HDFArray<UChar> *fieldArrayPtr = dynamic_cast<HDFArray<UChar> *>(
-                    refAlignGroup->readGroups[experimentIndex]->fields[*fieldIt]);
+            }
+            first = last;
+        }
+    }
 
-                int ob = cmpFile.alnInfo.alignments[alignmentIndex].GetOffsetBegin();
-                int oe = cmpFile.alnInfo.alignments[alignmentIndex].GetOffsetEnd();
-                fieldArrayPtr->Read(ob, oe, &fieldArray[0]);
+    //
+    // Find the read group that an alignment of cmpFile.alnInfo is stored in.
+    //
+    HDFCmpExperimentGroup *LookupExperimentGroup(CmpAlignment &alignment)
+    {
+        unsigned int alnGroupId = alignment.GetAlnGroupId();
+        unsigned int refGroupId = alignment.GetRefGroupId();
 
-                cmpFile.alnInfo.alignments[alignmentIndex].StoreField(*fieldIt, &fieldArray[0],
-                                                                      alignmentLength);
-            }
+        //
+        // Make sure the refGroupId specified in the alignment index exists in the alignment groups.
+        //
+        int refGroupArrayIndex;
+        if (refGroupIdToArrayIndex.find(refGroupId) == refGroupIdToArrayIndex.end()) {
+            std::cout << "ERROR! Alignment " << alignment.GetAlignmentId() << " has ref seq id "
+                      << refGroupId << " that does not exist in the HDF file." << std::endl;
+            assert(0);
+        } else {
+            refGroupArrayIndex = refGroupIdToArrayIndex[refGroupId];
         }
+
+        //
+        // Point to the refGroup that this alignment is part of.
+        //
+        HDFCmpRefAlignmentGroup *refAlignGroup = refAlignGroups[refGroupArrayIndex];
+
+        //
+        // Now locate the read group that is part of this ref align group.
+        //
+        std::string readGroupName = alnGroupIdToReadGroupName[alnGroupId];
+
+        if (refAlignGroup->experimentNameToIndex.find(readGroupName) ==
+            refAlignGroup->experimentNameToIndex.end()) {
+            std::cout << "Internal ERROR! The read group name " << readGroupName
+                      << " is specified as part of "
+                      << " the path in alignment " << alignment.GetAlignmentId()
+                      << " though it does not exist in the ref align group specified for this "
+                         "alignment."
+                      << std::endl;
+            assert(0);
+        }
+
+        int experimentIndex = refAlignGroup->experimentNameToIndex[readGroupName];
+        return refAlignGroup->readGroups[experimentIndex];
     }
 
     void IncludeField(std::string fieldName)
@@ -859,6 +985,8 @@ public:
             std::cout << "ERROR, unable to allocate memory for cmp.h5 file." << std::endl;
             std::exit(EXIT_FAILURE);
         }
+        newGroup->writeOptions = writeOptions;
+        newGroup->writeBufferSize = writeBufferSize;
         newGroup->Create(rootGroup.rootGroup, refGroupName);
         refAlignGroups.push_back(newGroup);
 
@@ -9,6 +9,7 @@
 #include <hdf/HDFCmpExperimentGroup.hpp>
 #include <hdf/HDFData.hpp>
 #include <hdf/HDFGroup.hpp>
+#include <hdf/HDFWriteOptions.hpp>
 
 class HDFCmpRefAlignmentGroup
 {
@@ -18,6 +19,10 @@ public:
     std::vector<HDFCmpExperimentGroup*> readGroups;
     HDFAtom<std::string> annotationStringAtom;
     std::map<std::string, int> experimentNameToIndex;
+    // Chunking and compression of experiment groups created in this group.
+    HDFWriteOptions writeOptions;
+    // Write buffer size of experiment groups created in this group.
+    int writeBufferSize;
     // A RefAlignmentGroup may contain one or more
     // ExperimentGroups. The following shows a
     // RefAlignmentGroup containing two ExperimentGroups.
@@ -30,6 +35,8 @@ public:
     // /ref00001/rg8953-0
     // /ref00001/rg2453-1
 
+    HDFCmpRefAlignmentGroup() : writeBufferSize(0) {}
+
     int Initialize(H5::Group& group, std::string _refGroupName)
     {
         refGroupName = _refGroupName;
@@ -67,6 +74,8 @@ public:
         }
         readGroups.push_back(readGroupPtr);
         experimentNameToIndex[readGroupName] = newReadGroupIndex;
+        readGroupPtr->writeOptions = writeOptions;
+        readGroupPtr->writeBufferSize = writeBufferSize;
 
         //
         // Now add it to the cmp.h5 file.
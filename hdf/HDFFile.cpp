@@ -1,5 +1,7 @@
 #include <hdf/HDFFile.hpp>
 
+#include <hdf/HDFIOStats.hpp>
+
 using namespace H5;
 
 HDFFile::HDFFile() {}
@@ -43,4 +45,8 @@ void HDFFile::Open(std::string fileName, unsigned int flags, const FileAccPropLi
     }
 }
 
-void HDFFile::Close() { hdfFile.close(); }
+void HDFFile::Close()
+{
+    hdfFile.close();
+    HDFIOStats::Instance().Report();
+}
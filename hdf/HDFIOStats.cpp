@@ -0,0 +1,148 @@
+#include <hdf/HDFIOStats.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+std::string ObjectName(hid_t id)
+{
+    ssize_t length = H5Iget_name(id, NULL, 0);
+    if (length <= 0) return "";
+    std::vector<char> name(length + 1);
+    H5Iget_name(id, &name[0], name.size());
+    return std::string(&name[0], length);
+}
+
+void WriteJSONString(std::ostream &out, const std::string &value)
+{
+    out << '"';
+    for (char c : value) {
+        if (c == '"' or c == '\\') out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+}  // namespace
+
+HDFIOStats::HDFIOStats() : enabled_(false) {}
+
+HDFIOStats &HDFIOStats::Instance()
+{
+    static HDFIOStats stats;
+    return stats;
+}
+
+void HDFIOStats::Enable(const std::string &jsonFileName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    jsonFileName_ = jsonFileName;
+    enabled_ = true;
+}
+
+void HDFIOStats::Disable() { enabled_ = false; }
+
+void HDFIOStats::Record(const std::string &name, Operation operation, uint64_t bytes,
+                        double seconds)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Counter &counter = counters_[name][operation];
+    counter.calls++;
+    counter.bytes += bytes;
+    counter.seconds += seconds;
+}
+
+HDFIOStats::Counter HDFIOStats::Get(const std::string &name, Operation operation)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = counters_.find(name);
+    if (it == counters_.end()) return Counter();
+    return it->second[operation];
+}
+
+void HDFIOStats::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    counters_.clear();
+}
+
+const char *HDFIOStats::OperationName(Operation operation)
+{
+    static const char *names[] = {"read", "write", "extend", "create"};
+    return names[operation];
+}
+
+void HDFIOStats::WriteJSON(std::ostream &out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    out << "{\"datasets\": {";
+    bool firstDataset = true;
+    for (auto &dataset : counters_) {
+        out << (firstDataset ? "\n  " : ",\n  ");
+        firstDataset = false;
+        WriteJSONString(out, dataset.first);
+        out << ": {";
+        bool firstOperation = true;
+        for (int op = 0; op < NOperations; op++) {
+            const Counter &counter = dataset.second[op];
+            if (counter.calls == 0) continue;
+            out << (firstOperation ? "" : ", ") << '"' << OperationName(Operation(op))
+                << "\": {\"calls\": " << counter.calls << ", \"bytes\": " << counter.bytes
+                << ", \"seconds\": " << counter.seconds << "}";
+            firstOperation = false;
+        }
+        out << "}";
+    }
+    out << "\n}}" << std::endl;
+}
+
+void HDFIOStats::Report()
+{
+    std::string jsonFileName;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (not enabled_ or jsonFileName_.empty()) return;
+        jsonFileName = jsonFileName_;
+    }
+    std::ofstream out(jsonFileName.c_str());
+    if (not out) {
+        std::cout << "ERROR, could not write HDF5 I/O statistics to " << jsonFileName << std::endl;
+        return;
+    }
+    WriteJSON(out);
+}
+
+HDFIOTimer::HDFIOTimer(const H5::DataSet &dataset, HDFIOStats::Operation operation, uint64_t bytes)
+    : enabled_(HDFIOStats::Instance().IsEnabled()), operation_(operation), bytes_(bytes)
+{
+    if (not enabled_) return;
+    name_ = ObjectName(dataset.getId());
+    start_ = std::chrono::steady_clock::now();
+}
+
+HDFIOTimer::HDFIOTimer(const H5::Group &container, const std::string &datasetName,
+                       HDFIOStats::Operation operation)
+    : enabled_(HDFIOStats::Instance().IsEnabled()), operation_(operation), bytes_(0)
+{
+    if (not enabled_) return;
+    name_ = ObjectName(container.getId());
+    if (name_.empty() or name_.back() != '/') name_ += "/";
+    name_ += datasetName;
+    start_ = std::chrono::steady_clock::now();
+}
+
+HDFIOTimer::HDFIOTimer(const H5::Attribute &attribute, HDFIOStats::Operation operation)
+    : enabled_(HDFIOStats::Instance().IsEnabled()), operation_(operation), bytes_(0)
+{
+    if (not enabled_) return;
+    name_ = ObjectName(attribute.getId()) + "@" + attribute.getName();
+    bytes_ = attribute.getStorageSize();
+    start_ = std::chrono::steady_clock::now();
+}
+
+HDFIOTimer::~HDFIOTimer()
+{
+    if (not enabled_) return;
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+    HDFIOStats::Instance().Record(name_, operation_, bytes_, elapsed.count());
+}
@@ -0,0 +1,109 @@
+#ifndef _BLASR_HDF_IO_STATS_HPP_
+#define _BLASR_HDF_IO_STATS_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include <H5Cpp.h>
+
+/*
+ * Optional accounting of HDF5 I/O by dataset: the number of calls,
+ * bytes and wall time of reads, writes, extends and creates, so that
+ * chunking and buffering can be tuned per dataset.
+ *
+ * Accounting is off until Enable() is called; until then an
+ * instrumented call costs one branch.  Datasets are named by their path
+ * in the file, and attributes by the path of their object, '@' and the
+ * attribute name.  Counters are shared by all files and threads.
+ *
+ * When enabled with a file name, the counters so far are written to it
+ * as JSON each time an HDF5 file is closed:
+ *
+ *   {"datasets": {"/PulseData/BaseCalls/Basecall":
+ *       {"write": {"calls": 2, "bytes": 65536, "seconds": 0.0012}, ...}}}
+ */
+class HDFIOStats
+{
+public:
+    enum Operation
+    {
+        Read,
+        Write,
+        Extend,
+        Create,
+        NOperations
+    };
+
+    struct Counter
+    {
+        uint64_t calls;
+        uint64_t bytes;
+        double seconds;
+        Counter() : calls(0), bytes(0), seconds(0) {}
+    };
+
+    static HDFIOStats &Instance();
+
+    // Start accounting, and write JSON to jsonFileName at each Close()
+    // of an HDF5 file, unless it is empty.
+    void Enable(const std::string &jsonFileName = "");
+
+    void Disable();
+
+    bool IsEnabled() const { return enabled_; }
+
+    void Record(const std::string &name, Operation operation, uint64_t bytes, double seconds);
+
+    Counter Get(const std::string &name, Operation operation);
+
+    void Clear();
+
+    void WriteJSON(std::ostream &out);
+
+    // Write JSON to the file given to Enable(), if any.  Called when an
+    // HDF5 file is closed.
+    void Report();
+
+    static const char *OperationName(Operation operation);
+
+private:
+    HDFIOStats();
+
+    std::atomic<bool> enabled_;
+    std::string jsonFileName_;
+    std::mutex mutex_;
+    std::map<std::string, std::array<Counter, NOperations> > counters_;
+};
+
+/*
+ * Times the enclosing scope and records it in HDFIOStats, if enabled.
+ */
+class HDFIOTimer
+{
+public:
+    HDFIOTimer(const H5::DataSet &dataset, HDFIOStats::Operation operation, uint64_t bytes);
+
+    // Times the creation of datasetName in container.
+    HDFIOTimer(const H5::Group &container, const std::string &datasetName,
+               HDFIOStats::Operation operation);
+
+    // Bytes are the storage size of the attribute.
+    HDFIOTimer(const H5::Attribute &attribute, HDFIOStats::Operation operation);
+
+    ~HDFIOTimer();
+
+private:
+    bool enabled_;
+    std::string name_;
+    HDFIOStats::Operation operation_;
+    uint64_t bytes_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef _BLASR_HDF_PLS_READER_HPP_
 #define _BLASR_HDF_PLS_READER_HPP_
 
+#include <algorithm>
 #include <set>
 #include <sstream>
 #include <vector>
@@ -16,6 +17,7 @@
 #include <hdf/HDFZMWReader.hpp>
 #include <pbdata/FASTQSequence.hpp>
 #include <pbdata/VectorUtils.hpp>
+#include <pbdata/reads/PulseBlock.hpp>
 #include <pbdata/reads/PulseFile.hpp>
 
 using namespace H5;
@@ -117,6 +119,7 @@ public:
         if (!plsWidthInFramesArray.Initialize(pulseCallsGroup, "WidthInFrames")) return 0;
 
         curRead = 0;
+        curPos = 0;
         nReads = zmwReader.numEventArray.arrayLength;
         return 1;
     }
@@ -554,7 +557,151 @@ public:
         return 1;
     }
 
+    //
+    // Read the included pulse fields of the next maxReads reads into
+    // block, with one HDF5 call per field, instead of one per field per
+    // read as GetNextFlattenedToBase does.  Reads of the block are then
+    // flattened to bases with block.FlattenToBase and
+    // block.FlattenSignalToBase.
+    // Returns the number of reads in block, 0 after the last read.
+    //
+    DSLength GetNextBlock(PulseBlock &block, DSLength maxReads)
+    {
+        DSLength endRead = std::min(curRead + maxReads, static_cast<DSLength>(nReads));
+        ReadBlock(curRead, curPos, endRead, block);
+        curRead = endRead;
+        curPos += block.readOffsets.back();
+        zmwReader.curZMW = curRead;
+        return block.NumReads();
+    }
+
+    //
+    // Same as GetNextBlock, but with as many reads as fit in maxBytes of
+    // included pulse fields, and at least one read.  Streaming a file with
+    // a fixed budget bounds the memory of a block regardless of read
+    // lengths.
+    //
+    DSLength GetNextBlockBySize(PulseBlock &block, DSLength maxBytes)
+    {
+        if (preparedForRandomAccess == false) {
+            PrepareForRandomAccess();
+        }
+        if (curRead >= nReads) {
+            return GetNextBlock(block, 0);
+        }
+        DSLength maxPulses = maxBytes / std::max(GetBytesPerPulse(), static_cast<DSLength>(1));
+        DSLength limit = eventOffset[curRead] + maxPulses;
+        // Reads [curRead, endRead) end at eventOffset[endRead].
+        DSLength endRead =
+            std::upper_bound(eventOffset.begin() + curRead + 1, eventOffset.end(), limit) -
+            eventOffset.begin() - 1;
+        if (endRead == nReads - 1) {
+            DNALength lastLength = 0;
+            zmwReader.numEventArray.Read(endRead, endRead + 1, &lastLength);
+            if (eventOffset[endRead] + lastLength <= limit) endRead = nReads;
+        }
+        return GetNextBlock(block, std::max(endRead, curRead + 1) - curRead);
+    }
+
+    //
+    // Bytes per pulse of the included fields in a PulseBlock.
+    //
+    DSLength GetBytesPerPulse()
+    {
+        DSLength bytes = 0;
+        if (includedFields["StartFrame"]) bytes += sizeof(unsigned int);
+        if (includedFields["WidthInFrames"]) bytes += sizeof(uint16_t);
+        if (includedFields["ClassifierQV"]) bytes += sizeof(float);
+        if (includedFields["MeanSignal"])
+            bytes += sizeof(uint16_t) * (meanSignalNDims == 2 ? 4 : 1);
+        if (includedFields["MidSignal"]) bytes += sizeof(uint16_t) * (midSignalNDims == 2 ? 4 : 1);
+        if (includedFields["MaxSignal"]) bytes += sizeof(uint16_t) * (maxSignalNDims == 2 ? 4 : 1);
+        return bytes;
+    }
+
+    //
+    // Read the included pulse fields of reads [firstRead, endRead) into
+    // block.  Returns the number of reads in block.
+    //
+    DSLength GetBlockAt(DSLength firstRead, DSLength endRead, PulseBlock &block)
+    {
+        if (preparedForRandomAccess == false) {
+            PrepareForRandomAccess();
+        }
+        endRead = std::min(endRead, static_cast<DSLength>(nReads));
+        if (firstRead >= endRead) {
+            block.Clear();
+            block.firstRead = firstRead;
+            return 0;
+        }
+        ReadBlock(firstRead, eventOffset[firstRead], endRead, block);
+        return block.NumReads();
+    }
+
     void Close() {}
+
+private:
+    void ReadBlock(DSLength firstRead, DSLength firstPos, DSLength endRead, PulseBlock &block)
+    {
+        block.Clear();
+        block.firstRead = firstRead;
+        block.SetBaseMap(scanDataReader.BaseMap());
+        if (firstRead >= endRead) return;
+
+        try {
+            std::vector<DNALength> numEvent(endRead - firstRead);
+            zmwReader.numEventArray.Read(firstRead, endRead, &numEvent[0]);
+            block.readOffsets.resize(numEvent.size() + 1);
+            for (size_t i = 0; i < numEvent.size(); i++) {
+                block.readOffsets[i + 1] = block.readOffsets[i] + numEvent[i];
+            }
+            DSLength nPulses = block.readOffsets.back();
+            if (nPulses == 0) return;
+            DSLength endPos = firstPos + nPulses;
+
+            if (includedFields["StartFrame"]) {
+                block.startFrame.resize(nPulses);
+                startFrameArray.Read(firstPos, endPos, &block.startFrame[0]);
+            }
+            if (includedFields["WidthInFrames"]) {
+                block.widthInFrames.resize(nPulses);
+                plsWidthInFramesArray.Read(firstPos, endPos, &block.widthInFrames[0]);
+            }
+            if (includedFields["ClassifierQV"]) {
+                block.classifierQV.resize(nPulses);
+                classifierQVArray.Read(firstPos, endPos, &block.classifierQV[0]);
+            }
+            block.meanSignalNDims =
+                ReadSignalBlock("MeanSignal", meanSignalArray, meanSignalMatrix, meanSignalNDims,
+                                firstPos, endPos, block.meanSignal);
+            block.midSignalNDims =
+                ReadSignalBlock("MidSignal", midSignalArray, midSignalMatrix, midSignalNDims,
+                                firstPos, endPos, block.midSignal);
+            block.maxSignalNDims =
+                ReadSignalBlock("MaxSignal", maxSignalArray, maxSignalMatrix, maxSignalNDims,
+                                firstPos, endPos, block.maxSignal);
+        } catch (const DataSetIException &e) {
+            std::cout << "ERROR, could not read pulse metrics for reads " << firstRead << " to "
+                      << endRead << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        RecordBufferBytes(block.GetStorageSize());
+    }
+
+    int ReadSignalBlock(std::string fieldName, HDFArray<HalfWord> &signalArray,
+                        HDF2DArray<HalfWord> &signalMatrix, int nDims, DSLength firstPos,
+                        DSLength endPos, std::vector<HalfWord> &signal)
+    {
+        if (not includedFields[fieldName]) return 0;
+        if (nDims == 2) {
+            signal.resize((endPos - firstPos) * 4);
+            signalMatrix.Read(firstPos, endPos, &signal[0]);
+        } else {
+            signal.resize(endPos - firstPos);
+            signalArray.Read(firstPos, endPos, &signal[0]);
+        }
+        return nDims;
+    }
 };
 
 #endif
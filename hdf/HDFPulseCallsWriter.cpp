@@ -33,8 +33,9 @@ std::vector<PacBio::BAM::BaseFeature> HDFPulseCallsWriter::WritableQVs(
 HDFPulseCallsWriter::HDFPulseCallsWriter(const std::string& filename, HDFGroup& parentGroup,
                                          const std::map<char, size_t>& baseMap,
                                          const std::string& basecallerVersion,
-                                         const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite)
-    : HDFWriterBase(filename)
+                                         const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
+                                         const HDFWriteOptions& writeOptions)
+    : HDFWriterBase(filename, writeOptions)
     , parentGroup_(parentGroup)
     , baseMap_(baseMap)
     , qvsToWrite_({})  // Input qvsToWrite must be checked.
@@ -71,7 +72,7 @@ HDFPulseCallsWriter::HDFPulseCallsWriter(const std::string& filename, HDFGroup&
     }
 
     // Create a zmwWriter.
-    zmwWriter_.reset(new HDFZMWWriter(Filename(), pulsecallsGroup_, true, baseMap));
+    zmwWriter_.reset(new HDFZMWWriter(Filename(), pulsecallsGroup_, true, baseMap, writeOptions_));
 
     inverseGain_ = 1.0f;
 
@@ -227,6 +228,16 @@ HDFPulseCallsWriter::~HDFPulseCallsWriter(void) { this->Close(); }
 bool HDFPulseCallsWriter::InitializeQVGroups(void)
 {
     int ret = 1;
+    for (BufferedHDFArray<unsigned char>* array :
+         {&pulseCallArray_, &isPulseArray_, &labelQVArray_, &pulseMergeQVArray_, &altLabelArray_,
+          &altLabelQVArray_}) {
+        array->SetWriteOptions(writeOptions_);
+    }
+    pkmeanArray_.SetWriteOptions(writeOptions_);
+    pkmidArray_.SetWriteOptions(writeOptions_);
+    startFrameArray_.SetWriteOptions(writeOptions_);
+    pulseCallWidthArray_.SetWriteOptions(writeOptions_);
+
     if (_HasQV(PacBio::BAM::BaseFeature::PULSE_CALL))
         ret *= pulseCallArray_.Initialize(pulsecallsGroup_, PacBio::GroupNames::channel);
     ret *= isPulseArray_.Initialize(pulsecallsGroup_, PacBio::GroupNames::ispulse);
@@ -506,6 +517,7 @@ void HDFPulseCallsWriter::Flush(void)
 void HDFPulseCallsWriter::Close(void)
 {
     this->Flush();
+    WaitForWrites();
 
     // Write attributes to pulsecallsGroup
     try {
@@ -1,5 +1,10 @@
 #include <hdf/HDFPulseDataFile.hpp>
 
+#include <algorithm>
+#include <cassert>
+
+#include <hdf/HDFIOStats.hpp>
+
 DSLength HDFPulseDataFile::GetAllReadLengths(std::vector<DNALength> &readLengths)
 {
     nReads = static_cast<UInt>(zmwReader.numEventArray.arrayLength);
@@ -37,6 +42,16 @@ HDFPulseDataFile::HDFPulseDataFile()
 
 void HDFPulseDataFile::PrepareForRandomAccess()
 {
+    //
+    // Load all ZMW datasets so that reads are then located, by index
+    // or by hole number, without reading the file.
+    //
+    if (zmwReader.IsLoaded() or zmwReader.Load()) {
+        eventOffset.assign(zmwReader.eventOffsets.begin(), zmwReader.eventOffsets.end() - 1);
+        nReads = static_cast<UInt>(eventOffset.size());
+        preparedForRandomAccess = true;
+        return;
+    }
     std::vector<DNALength> offset_;
     GetAllReadLengths(offset_);
     // type of read length of a single read : DNALength
@@ -52,6 +67,44 @@ void HDFPulseDataFile::PrepareForRandomAccess()
     preparedForRandomAccess = true;
 }
 
+bool HDFPulseDataFile::LookupHoleNumber(UInt holeNumber, UInt &index)
+{
+    if (preparedForRandomAccess == false) {
+        PrepareForRandomAccess();
+    }
+    if (not zmwReader.IsLoaded() or not zmwReader.readHoleNumber) {
+        return false;
+    }
+    return zmwReader.LookupHoleNumber(holeNumber, index);
+}
+
+void HDFPulseDataFile::GetShardReadRange(UInt shardIndex, UInt numShards, UInt &beginRead,
+                                         UInt &endRead)
+{
+    assert(numShards > 0 and shardIndex < numShards);
+    if (preparedForRandomAccess == false) {
+        PrepareForRandomAccess();
+    }
+    DSLength nEvents = 0;
+    if (nReads > 0) {
+        DNALength lastLength;
+        zmwReader.numEventArray.Read(nReads - 1, nReads, &lastLength);
+        nEvents = eventOffset[nReads - 1] + lastLength;
+    }
+    // A shard boundary is the first read starting at or after an even
+    // split of all events, so that neighbouring shards agree on it.
+    auto boundary = [this, nEvents, numShards](UInt shard) -> UInt {
+        if (shard == 0) return 0;
+        if (shard == numShards) return nReads;
+        const DSLength split =
+            static_cast<DSLength>(static_cast<long double>(nEvents) * shard / numShards);
+        return static_cast<UInt>(std::lower_bound(eventOffset.begin(), eventOffset.end(), split) -
+                                 eventOffset.begin());
+    };
+    beginRead = boundary(shardIndex);
+    endRead = boundary(shardIndex + 1);
+}
+
 int HDFPulseDataFile::OpenHDFFile(std::string fileName, const H5::FileAccPropList &fileAccPropList)
 {
 
@@ -156,4 +209,5 @@ void HDFPulseDataFile::Close()
     if (closeFileOnExit) {
         hdfBasFile.close();
     }
+    HDFIOStats::Instance().Report();
 }
@@ -38,6 +38,21 @@ public:
 
     void PrepareForRandomAccess();
 
+    //
+    // Find the index of the read of holeNumber, e.g. for GetReadAt, in
+    // constant time.  Returns false if there is no such hole or the file
+    // has no ZMW/HoleNumber dataset.
+    //
+    bool LookupHoleNumber(UInt holeNumber, UInt &index);
+
+    //
+    // Split reads into numShards ranges of consecutive reads holding
+    // about the same number of events, using ZMW/NumEvent only, and get
+    // the shardIndex-th range [beginRead, endRead). Ranges of all shards
+    // are disjoint and cover all reads.
+    //
+    void GetShardReadRange(UInt shardIndex, UInt numShards, UInt &beginRead, UInt &endRead);
+
     int OpenHDFFile(std::string fileName,
                     const H5::FileAccPropList &fileAccPropList = H5::FileAccPropList::DEFAULT);
 
@@ -7,8 +7,9 @@
 HDFPulseWriter::HDFPulseWriter(const std::string& filename, const std::string& basecallerVersion,
                                const std::map<char, size_t>& baseMap,
                                const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
-                               const H5::FileAccPropList& fileAccPropList)
-    : HDFWriterBase(filename)
+                               const H5::FileAccPropList& fileAccPropList,
+                               const HDFWriteOptions& writeOptions)
+    : HDFWriterBase(filename, writeOptions)
     , fileaccproplist_(fileAccPropList)
     , basecallsWriter_(nullptr)
     , pulsecallsWriter_(nullptr)
@@ -25,29 +26,33 @@ HDFPulseWriter::HDFPulseWriter(const std::string& filename, const std::string& b
     }
 
     // Create a BaseCaller writer.
-    basecallsWriter_.reset(
-        new HDFBaseCallsWriter(filename_, pulseDataGroup_, baseMap, basecallerVersion, qvsToWrite));
+    basecallsWriter_.reset(new HDFBaseCallsWriter(filename_, pulseDataGroup_, baseMap,
+                                                  basecallerVersion, qvsToWrite, writeOptions_));
 
     // Create a PulseCalls writer
     pulsecallsWriter_.reset(new HDFPulseCallsWriter(filename_, pulseDataGroup_, baseMap,
-                                                    basecallerVersion, qvsToWrite));
+                                                    basecallerVersion, qvsToWrite, writeOptions_));
 }
 
 HDFPulseWriter::HDFPulseWriter(const std::string& filename, const std::string& basecallerVersion,
                                const std::map<char, size_t>& baseMap,
                                const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
                                const std::vector<std::string>& regionTypes,
-                               const H5::FileAccPropList& fileAccPropList)
-    : HDFPulseWriter(filename, basecallerVersion, baseMap, qvsToWrite, fileAccPropList)
+                               const H5::FileAccPropList& fileAccPropList,
+                               const HDFWriteOptions& writeOptions)
+    : HDFPulseWriter(filename, basecallerVersion, baseMap, qvsToWrite, fileAccPropList,
+                     writeOptions)
 {
     // Create a Regions writer.
-    regionsWriter_.reset(new HDFRegionsWriter(filename_, pulseDataGroup_, regionTypes));
+    regionsWriter_.reset(
+        new HDFRegionsWriter(filename_, pulseDataGroup_, regionTypes, writeOptions_));
 }
 
 HDFPulseWriter::~HDFPulseWriter(void) { this->Close(); }
 
 void HDFPulseWriter::Flush(void)
 {
+    if (not basecallsWriter_) return;
     basecallsWriter_->Flush();
     pulsecallsWriter_->Flush();
     if (HasRegions()) regionsWriter_->Flush();
@@ -57,11 +62,15 @@ std::vector<std::string> HDFPulseWriter::Errors(void)
 {
     std::vector<std::string> errors = errors_;
 
-    for (auto error : basecallsWriter_->Errors())
-        errors.emplace_back(error);
+    if (basecallsWriter_) {
+        for (auto error : basecallsWriter_->Errors())
+            errors.emplace_back(error);
+    }
 
-    for (auto error : pulsecallsWriter_->Errors())
-        errors.emplace_back(error);
+    if (pulsecallsWriter_) {
+        for (auto error : pulsecallsWriter_->Errors())
+            errors.emplace_back(error);
+    }
 
     if (HasRegions()) {
         for (auto error : regionsWriter_->Errors())
@@ -75,9 +84,16 @@ void HDFPulseWriter::SetInverseGain(float igain) { pulsecallsWriter_->SetInverse
 
 void HDFPulseWriter::Close(void)
 {
+    if (basecallsWriter_) {
+        this->Flush();
+        WaitForWrites();
+        // Keep errors of writers destroyed below.
+        errors_ = this->Errors();
+    }
     if (basecallsWriter_) basecallsWriter_.reset();
     if (pulsecallsWriter_) pulsecallsWriter_.reset();
     if (HasRegions() and regionsWriter_) regionsWriter_.reset();
+    WaitForWrites();
     outfile_.Close();
 }
 
@@ -35,13 +35,15 @@ public:
                    const std::map<char, size_t>& baseMap,
                    const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
                    const std::vector<std::string>& regionTypes,
-                   const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT);
+                   const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT,
+                   const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     /// \note No /PulseData/Regions
     HDFPulseWriter(const std::string& filename, const std::string& basecallerVersion,
                    const std::map<char, size_t>& baseMap,
                    const std::vector<PacBio::BAM::BaseFeature>& qvsToWrite,
-                   const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT);
+                   const H5::FileAccPropList& fileAccPropList = H5::FileAccPropList::DEFAULT,
+                   const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     ~HDFPulseWriter(void);
 
@@ -65,6 +67,11 @@ public:
     /// \returns all errors from all writers.
     std::vector<std::string> Errors(void);
 
+    /// \brief Flushes buffered data, waits for writes queued on
+    ///        WriteOptions().writeQueue, and closes the file. Failed
+    ///        writes are reported by Errors(). Called by the destructor.
+    void Close(void);
+
     /// Pass-through method for setting the inverse gain to PulseCallsWriter
     void SetInverseGain(float igain);
 
@@ -87,8 +94,6 @@ private:
     /// \name Private Methods.
     /// \{
 
-    /// \brief Closes HDFPulseWriter.
-    void Close(void);
     /// \}
 };
 
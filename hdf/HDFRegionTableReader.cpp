@@ -1,6 +1,8 @@
 #include <hdf/HDFRegionTableReader.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 int HDFRegionTableReader::Initialize(std::string &regionTableFileName,
                                      const H5::FileAccPropList &fileAccPropList)
@@ -92,6 +94,11 @@ void HDFRegionTableReader::Close()
 // `Regions` in order to traverse zmws in order.
 // (2) region table of a million zmws is approximately 5M.
 void HDFRegionTableReader::ReadTable(RegionTable &table)
+{
+    ReadTable(table, 0, std::numeric_limits<UInt>::max());
+}
+
+void HDFRegionTableReader::ReadTable(RegionTable &table, UInt minHole, UInt maxHole)
 {
     assert(IsInitialized() && "HDFRegionTable is not initialize!");
     table.Reset();
@@ -111,11 +118,9 @@ void HDFRegionTableReader::ReadTable(RegionTable &table)
 
         // Read region annotations
         std::vector<RegionAnnotation> ras;
-        ras.resize(nRows);
         assert(curRow == 0);
-        for (; curRow < nRows; curRow++) {
-            regions.Read(curRow, curRow + 1, ras[curRow].row);
-        }
+        ReadAnnotations(ras, minHole, maxHole);
+        curRow = nRows;
 
         // Reconstruct table
         table.ConstructTable(ras, types);
@@ -130,11 +135,10 @@ void HDFRegionTableReader::GetMinMaxHoleNumber(UInt &minHole, UInt &maxHole)
     assert(IsInitialized() && "HDFRegionTable is not initialize!");
     // Hole numbers may not be sorted ascendingly, so do not
     // return the first and last hole numbers as the min and max.
-    UInt saveCurRow = curRow;
-    curRow = 0;
+    std::vector<RegionAnnotation> annotations;
+    if (fileContainsRegionTable) ReadAnnotations(annotations);
     bool init = false;
-    RegionAnnotation annotation;
-    while (GetNext(annotation) == 1) {
+    for (const RegionAnnotation &annotation : annotations) {
         UInt curHole = annotation.GetHoleNumber();
         if (not init) {
             minHole = maxHole = curHole;
@@ -144,5 +148,33 @@ void HDFRegionTableReader::GetMinMaxHoleNumber(UInt &minHole, UInt &maxHole)
             maxHole = (maxHole < curHole) ? (curHole) : (maxHole);
         }
     }
-    curRow = saveCurRow;
+}
+
+void HDFRegionTableReader::ReadAnnotations(std::vector<RegionAnnotation> &annotations)
+{
+    ReadAnnotations(annotations, 0, std::numeric_limits<UInt>::max());
+}
+
+void HDFRegionTableReader::ReadAnnotations(std::vector<RegionAnnotation> &annotations, UInt minHole,
+                                           UInt maxHole)
+{
+    // Read blocks of rows rather than one HDF5 call per row, and only keep
+    // rows of the requested holes, so a shard never holds the whole table.
+    const int blockRows = 65536;
+    const bool allHoles = (minHole == 0 and maxHole == std::numeric_limits<UInt>::max());
+    annotations.clear();
+    if (allHoles) annotations.reserve(nRows);
+    std::vector<int> block;
+    for (int blockStart = 0; blockStart < nRows; blockStart += blockRows) {
+        int blockEnd = std::min(blockStart + blockRows, nRows);
+        block.resize((blockEnd - blockStart) * RegionAnnotation::NCOLS);
+        regions.Read(blockStart, blockEnd, &block[0]);
+        for (int i = blockStart; i < blockEnd; i++) {
+            auto rowBegin = block.begin() + (i - blockStart) * RegionAnnotation::NCOLS;
+            const UInt hole = static_cast<UInt>(rowBegin[RegionAnnotation::HOLENUMBERCOL]);
+            if (hole < minHole or hole > maxHole) continue;
+            annotations.emplace_back();
+            std::copy(rowBegin, rowBegin + RegionAnnotation::NCOLS, annotations.back().row);
+        }
+    }
 }
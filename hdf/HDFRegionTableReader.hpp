@@ -49,10 +49,20 @@ public:
 
     void ReadTable(RegionTable &table);
 
+    /// Read only region annotations of zmws with hole numbers in
+    /// [minHole, maxHole], e.g. the zmws of one shard of a bax.h5.
+    void ReadTable(RegionTable &table, UInt minHole, UInt maxHole);
+
     void Close();
 
 private:
     int GetNext(RegionAnnotation &annotation);
+
+    // Read all rows of the region table with a few large reads.
+    void ReadAnnotations(std::vector<RegionAnnotation> &annotations);
+
+    // Same as above, keeping only rows of holes in [minHole, maxHole].
+    void ReadAnnotations(std::vector<RegionAnnotation> &annotations, UInt minHole, UInt maxHole);
 };
 
 #endif
@@ -3,10 +3,15 @@
 #include <hdf/HDFRegionsWriter.hpp>
 
 HDFRegionsWriter::HDFRegionsWriter(const std::string &filename, HDFGroup &parentGroup,
-                                   const std::vector<std::string> &regionTypes)
-    : HDFWriterBase(filename), parentGroup_(parentGroup), regionTypes_(regionTypes), curRow_(0)
+                                   const std::vector<std::string> &regionTypes,
+                                   const HDFWriteOptions &writeOptions)
+    : HDFWriterBase(filename, writeOptions)
+    , parentGroup_(parentGroup)
+    , regionTypes_(regionTypes)
+    , curRow_(0)
 {
     // Initialize the 'regions' group.
+    regionsArray_.SetWriteOptions(writeOptions_);
     regionsArray_.Initialize(parentGroup_, PacBio::GroupNames::regions, RegionAnnotation::NCOLS);
 }
 
@@ -41,7 +46,7 @@ bool HDFRegionsWriter::WriteAttributes(void)
 
 bool HDFRegionsWriter::Write(const std::vector<RegionAnnotation> &annotations)
 {
-    for (auto annotation : annotations)
+    for (const RegionAnnotation &annotation : annotations)
         if (not Write(annotation)) return false;
     return true;
 }
@@ -65,5 +70,6 @@ void HDFRegionsWriter::Flush(void) { regionsArray_.Flush(); }
 void HDFRegionsWriter::Close(void)
 {
     Flush();
+    WaitForWrites();
     regionsArray_.Close();
 }
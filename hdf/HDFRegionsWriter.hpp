@@ -6,7 +6,7 @@
 #include <string>
 
 #include <pbdata/Enumerations.h>
-#include <hdf/HDF2DArray.hpp>
+#include <hdf/BufferedHDF2DArray.hpp>
 #include <hdf/HDFArray.hpp>
 #include <hdf/HDFAtom.hpp>
 #include <hdf/HDFFile.hpp>
@@ -22,9 +22,10 @@ public:
     /// \{
     /// \param[in] filename, hdf file name
     /// \param[in] parentGroup, parent hdf group in hirarchy
-    HDFRegionsWriter(const std::string &filename, HDFGroup &parentGroup,
-                     const std::vector<std::string> &regionTypes =
-                         PacBio::AttributeValues::Regions::regiontypes);
+    HDFRegionsWriter(
+        const std::string &filename, HDFGroup &parentGroup,
+        const std::vector<std::string> &regionTypes = PacBio::AttributeValues::Regions::regiontypes,
+        const HDFWriteOptions &writeOptions = HDFWriteOptions());
     ~HDFRegionsWriter(void);
     /// \}
 
@@ -36,7 +37,9 @@ private:
     /// A vector of std::string's of region types for RegionTypeIndex to look up. Order matters!
     std::vector<std::string> regionTypes_;
 
-    HDF2DArray<int> regionsArray_;  //< HDF2DArray for writing regions to hdf
+    /// Rows are copied into the array's buffer, so with a write queue
+    /// they are only written to hdf by the queue's thread.
+    BufferedHDF2DArray<int> regionsArray_;  //< BufferedHDF2DArray for writing regions to hdf
 
     int curRow_;  //< which row to write
 
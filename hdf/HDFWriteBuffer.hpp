@@ -2,6 +2,7 @@
 #define _BLASR_HDF_WRITE_BUFFER_HPP_
 
 #include <cstddef>
+#include <cstdint>
 
 #include <pbdata/utils.hpp>
 
@@ -12,12 +13,18 @@ public:
     T *writeBuffer;
     int bufferIndex;
     DSLength bufferSize;
+    // With asynchronous writes, the buffer being written while
+    // writeBuffer fills, and the write queue ticket of that write.
+    T *spareBuffer;
+    uint64_t pendingWrite;
 
     HDFWriteBuffer()
     {
         writeBuffer = NULL;
         bufferIndex = 0;
         bufferSize = 0;
+        spareBuffer = NULL;
+        pendingWrite = 0;
     }
 
     void InitializeBuffer(int pBufferSize)
@@ -37,6 +44,10 @@ public:
             delete[] writeBuffer;
             writeBuffer = NULL;
         }
+        if (spareBuffer) {
+            delete[] spareBuffer;
+            spareBuffer = NULL;
+        }
     }
 
     ~HDFWriteBuffer() { Free(); }
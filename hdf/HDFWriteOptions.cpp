@@ -0,0 +1,55 @@
+#include <hdf/HDFWriteOptions.hpp>
+
+#include <algorithm>
+#include <vector>
+
+const size_t HDFWriteOptions::TargetChunkBytes;
+
+HDFWriteOptions::HDFWriteOptions()
+    : chunkLength(16384), expectedLength(0), deflateLevel(0), shuffle(false), bufferSize(32768)
+{
+}
+
+HDFWriteOptions HDFWriteOptions::Compressed(int deflateLevel, hsize_t expectedLength)
+{
+    HDFWriteOptions options;
+    options.chunkLength = 0;
+    options.expectedLength = expectedLength;
+    options.deflateLevel = deflateLevel;
+    options.shuffle = true;
+    // Coalesce writes into about one chunk.
+    options.bufferSize = TargetChunkBytes;
+    return options;
+}
+
+hsize_t HDFWriteOptions::ChunkLength(size_t rowBytes) const
+{
+    if (chunkLength > 0) return chunkLength;
+    hsize_t maxRows = TargetChunkBytes / std::max<size_t>(rowBytes, 1);
+    if (expectedLength > 0) maxRows = std::min(maxRows, expectedLength);
+    return std::max<hsize_t>(maxRows, 1);
+}
+
+void HDFWriteOptions::SetCreateProperties(H5::DSetCreatPropList &cparms, int rank,
+                                          const hsize_t *rowDims, size_t elementBytes) const
+{
+    std::vector<hsize_t> chunkDims(rank);
+    size_t rowBytes = elementBytes;
+    for (int i = 1; i < rank; i++) {
+        chunkDims[i] = rowDims[i - 1];
+        rowBytes *= rowDims[i - 1];
+    }
+    chunkDims[0] = ChunkLength(rowBytes);
+    cparms.setChunk(rank, &chunkDims[0]);
+
+    //
+    // The filters are optional in HDF5 builds, so fall back to
+    // uncompressed output when they are missing.
+    //
+    if (shuffle and elementBytes > 1 and H5Zfilter_avail(H5Z_FILTER_SHUFFLE) > 0) {
+        cparms.setShuffle();
+    }
+    if (deflateLevel > 0 and H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+        cparms.setDeflate(std::min(deflateLevel, 9));
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef _BLASR_HDF_WRITE_OPTIONS_HPP_
+#define _BLASR_HDF_WRITE_OPTIONS_HPP_
+
+#include <cstddef>
+#include <memory>
+
+#include <H5Cpp.h>
+
+#include <hdf/HDFWriteQueue.hpp>
+
+/*
+ * Dataset creation and buffering options for writers.
+ *
+ * The defaults reproduce the historical layout: 16384 rows per chunk,
+ * no filters and a 32768 element write buffer.  Setting chunkLength to
+ * 0 derives the chunk length from the row size and expectedLength, so
+ * that chunks are about TargetChunkBytes and small datasets do not
+ * allocate mostly empty chunks.
+ *
+ * When writeQueue is set, full write buffers are written by the queue's
+ * thread while the next buffer fills, so each dataset holds at most two
+ * buffers.  Writers sharing a file must share one queue.
+ */
+class HDFWriteOptions
+{
+public:
+    // Chunks are kept below the default 1 MiB HDF5 chunk cache.
+    static const size_t TargetChunkBytes = 1 << 20;
+
+    // Rows per chunk, or 0 to derive it from expectedLength.
+    hsize_t chunkLength;
+    // Expected number of rows of each dataset, or 0 if unknown.
+    hsize_t expectedLength;
+    // gzip level from 1 to 9, or 0 to not compress.
+    int deflateLevel;
+    // Byte shuffle before compression, which helps multi-byte values.
+    bool shuffle;
+    // Number of elements buffered before a write to the dataset.
+    int bufferSize;
+    // Background writer, or null to write synchronously.
+    std::shared_ptr<HDFWriteQueue> writeQueue;
+
+    HDFWriteOptions();
+
+    // Options for compressed output with derived chunk sizes.
+    static HDFWriteOptions Compressed(int deflateLevel = 1, hsize_t expectedLength = 0);
+
+    // Number of rows per chunk for rows of rowBytes bytes.
+    hsize_t ChunkLength(size_t rowBytes) const;
+
+    // Set chunking and filters of a dataset with an unlimited first
+    // dimension, and rows of rowDims (rank - 1 dims) elements of
+    // elementBytes bytes.
+    void SetCreateProperties(H5::DSetCreatPropList &cparms, int rank, const hsize_t *rowDims,
+                             size_t elementBytes) const;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include <hdf/HDFWriteQueue.hpp>
+
+#include <H5Cpp.h>
+
+HDFWriteQueue::HDFWriteQueue() : numSubmitted_(0), numCompleted_(0), stop_(false)
+{
+    worker_ = std::thread(&HDFWriteQueue::RunJobs, this);
+}
+
+HDFWriteQueue::~HDFWriteQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    submitted_.notify_one();
+    if (worker_.joinable()) worker_.join();
+}
+
+uint64_t HDFWriteQueue::Submit(Job job)
+{
+    uint64_t ticket;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+        ticket = ++numSubmitted_;
+    }
+    submitted_.notify_one();
+    return ticket;
+}
+
+void HDFWriteQueue::WaitFor(uint64_t ticket)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    completed_.wait(lock, [this, ticket] { return numCompleted_ >= ticket; });
+}
+
+bool HDFWriteQueue::Wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    completed_.wait(lock, [this] { return numCompleted_ >= numSubmitted_; });
+    return error_.empty();
+}
+
+std::string HDFWriteQueue::Error() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_;
+}
+
+void HDFWriteQueue::RunJobs()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        submitted_.wait(lock, [this] { return stop_ or not jobs_.empty(); });
+        // Run everything submitted before stopping.
+        if (jobs_.empty()) return;
+        Job job = std::move(jobs_.front());
+        jobs_.pop_front();
+        const bool failed = not error_.empty();
+        lock.unlock();
+
+        std::string error;
+        if (not failed) {
+            try {
+                job();
+            } catch (const H5::Exception &e) {
+                error = e.getDetailMsg();
+                if (error.empty()) error = "HDF5 write failed in " + e.getFuncName();
+            } catch (const std::exception &e) {
+                error = e.what();
+            } catch (...) {
+                error = "Unknown error writing HDF5 data.";
+            }
+        }
+        // Release buffers held by the job before reporting completion.
+        job = nullptr;
+
+        lock.lock();
+        if (error_.empty() and not error.empty()) error_ = error;
+        numCompleted_++;
+        completed_.notify_all();
+    }
+}
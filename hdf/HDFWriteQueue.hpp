@@ -0,0 +1,64 @@
+#ifndef _BLASR_HDF_WRITE_QUEUE_HPP_
+#define _BLASR_HDF_WRITE_QUEUE_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+ * Runs dataset writes on a background thread, so that the thread
+ * producing base calls or alignments does not wait on HDF5.
+ *
+ * Writes are run one at a time in submission order.  The serial HDF5
+ * library is not thread-safe, so while writes are queued the producer
+ * must not call HDF5 itself; buffered arrays only copy into their
+ * write buffers between flushes, and Wait() is the barrier before any
+ * other HDF5 call (closing datasets, writing attributes).
+ *
+ * After a write fails, later writes are dropped, and Wait() returns
+ * false with the error in Error().
+ */
+class HDFWriteQueue
+{
+public:
+    typedef std::function<void()> Job;
+
+    HDFWriteQueue();
+
+    ~HDFWriteQueue();
+
+    // Queue a write.  Returns a ticket to pass to WaitFor().
+    uint64_t Submit(Job job);
+
+    // Wait until the write with this ticket has been run.
+    void WaitFor(uint64_t ticket);
+
+    // Wait until all queued writes have been run.
+    // Returns false if any write failed.
+    bool Wait();
+
+    // Message of the first failed write, or empty.
+    std::string Error() const;
+
+private:
+    void RunJobs();
+
+private:
+    mutable std::mutex mutex_;
+    std::condition_variable submitted_;
+    std::condition_variable completed_;
+    std::deque<Job> jobs_;
+    uint64_t numSubmitted_;
+    uint64_t numCompleted_;
+    bool stop_;
+    std::string error_;
+
+    std::thread worker_;
+};
+
+#endif
@@ -2,12 +2,15 @@
 
 #include <hdf/HDFWriterBase.hpp>
 
+#include <algorithm>
+
 HDFWriterBase::~HDFWriterBase(void) {}
 
 std::vector<std::string> HDFWriterBase::Errors(void) const { return errors_; }
 
 void HDFWriterBase::CopyObject(HDFFile &src, const char *path)
 {
+    WaitForWrites();
     H5Ocopy(src.hdfFile.getId(), path, outfile_.hdfFile.getId(), path, H5P_DEFAULT, H5P_DEFAULT);
 }
 
@@ -15,6 +18,7 @@ void HDFWriterBase::WriteScanData(const ScanData &scanData)
 {
     // sanity check chemistry meta data.
     SanityCheckChemistry(scanData.BindingKit(), scanData.SequencingKit());
+    WaitForWrites();
     HDFScanDataWriter writer(outfile_.rootGroup);
     writer.Write(scanData);
 }
@@ -32,6 +36,7 @@ bool HDFWriterBase::WriteOneZmw(const SMRTSequence &, const std::vector<RegionAn
 bool HDFWriterBase::AddChildGroup(HDFGroup &parentGroup, HDFGroup &childGroup,
                                   const std::string &childGroupName)
 {
+    WaitForWrites();
     parentGroup.AddGroup(childGroupName);
     if (childGroup.Initialize(parentGroup, childGroupName) == 0) {
         FAILED_TO_CREATE_GROUP_ERROR(childGroupName);
@@ -44,6 +49,7 @@ template <>
 bool HDFWriterBase::AddAttribute(HDFData &group, const std::string &attributeName,
                                  const std::vector<std::string> &attributeValues)
 {
+    WaitForWrites();
     try {
         HDFAtom<std::vector<std::string> > attributeAtom;
         attributeAtom.Create(group.dataset, std::string(attributeName), attributeValues);
@@ -59,6 +65,7 @@ template <>
 bool HDFWriterBase::AddAttribute(HDFGroup &group, const std::string &attributeName,
                                  const std::vector<std::string> &attributeValues)
 {
+    WaitForWrites();
     try {
         HDFAtom<std::vector<std::string> > attributeAtom;
         attributeAtom.Create(group.group, std::string(attributeName), attributeValues);
@@ -83,6 +90,18 @@ void HDFWriterBase::SanityCheckChemistry(const std::string &bindingKit,
 
 void HDFWriterBase::AddErrorMessage(const std::string &errmsg) { errors_.push_back(errmsg); }
 
+bool HDFWriterBase::WaitForWrites(void)
+{
+    if (writeOptions_.writeQueue == nullptr or writeOptions_.writeQueue->Wait()) return true;
+    // Writers sharing a queue each report the failure once.
+    const std::string errmsg =
+        "Failed to write " + filename_ + ": " + writeOptions_.writeQueue->Error();
+    if (std::find(errors_.begin(), errors_.end(), errmsg) == errors_.end()) {
+        AddErrorMessage(errmsg);
+    }
+    return false;
+}
+
 void HDFWriterBase::FAILED_TO_CREATE_GROUP_ERROR(const std::string &groupName)
 {
     std::stringstream ss;
@@ -14,13 +14,18 @@
 #include <hdf/HDFFile.hpp>
 #include <hdf/HDFGroup.hpp>
 #include <hdf/HDFScanDataWriter.hpp>
+#include <hdf/HDFWriteOptions.hpp>
 #include <pbdata/SMRTSequence.hpp>
 #include <pbdata/reads/RegionAnnotation.hpp>
 
 class HDFWriterBase
 {
 public:
-    HDFWriterBase(const std::string& filename) : filename_(filename) {}
+    HDFWriterBase(const std::string& filename,
+                  const HDFWriteOptions& writeOptions = HDFWriteOptions())
+        : filename_(filename), writeOptions_(writeOptions)
+    {
+    }
 
     virtual ~HDFWriterBase(void) = 0;
 
@@ -30,6 +35,9 @@ public:
 
     std::vector<std::string> Errors(void) const;
 
+    /// \returns Chunking, compression and buffering of created datasets.
+    const HDFWriteOptions& WriteOptions(void) const { return writeOptions_; }
+
     /// Copy the given group and write to the output
     /// \returns Object that was copied
     void CopyObject(HDFFile& src, const char* path);
@@ -45,6 +53,7 @@ public:
 protected:
     std::string filename_;
     std::vector<std::string> errors_;
+    HDFWriteOptions writeOptions_;
 
     bool AddChildGroup(HDFGroup& parentGroup, HDFGroup& childGroup,
                        const std::string& childGroupName);
@@ -69,6 +78,12 @@ protected:
 
     void AddErrorMessage(const std::string& errmsg);
 
+    /// \brief Waits for datasets queued on writeOptions_.writeQueue to be
+    ///        written. This is the barrier before calling HDF5 other than
+    ///        through buffered arrays, and before closing the writer.
+    /// \returns false, and adds an error message, if a write failed.
+    bool WaitForWrites(void);
+
     void FAILED_TO_CREATE_GROUP_ERROR(const std::string& groupName);
 
     void FAILED_TO_CREATE_ATTRIBUTE_ERROR(const std::string& attributeName);
@@ -84,6 +99,7 @@ template <typename T>
 bool HDFWriterBase::AddAttribute(HDFData& group, const std::string& attributeName,
                                  const T& attributeValue)
 {
+    WaitForWrites();
     try {
         HDFAtom<T> attributeAtom;
         attributeAtom.Create(group.dataset, std::string(attributeName));
@@ -100,6 +116,7 @@ template <typename T>
 bool HDFWriterBase::AddAttribute(HDFGroup& group, const std::string& attributeName,
                                  const T& attributeValue)
 {
+    WaitForWrites();
     try {
         HDFAtom<T> attributeAtom;
         attributeAtom.Create(group.group, std::string(attributeName));
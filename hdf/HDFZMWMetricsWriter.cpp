@@ -4,8 +4,12 @@
 #include <pbdata/reads/ScanData.hpp>
 
 HDFZMWMetricsWriter::HDFZMWMetricsWriter(const std::string& filename, HDFGroup& parentGroup,
-                                         const std::map<char, size_t>& baseMap)
-    : HDFWriterBase(filename), parentGroup_(parentGroup), baseMap_(baseMap), curRow_(0)
+                                         const std::map<char, size_t>& baseMap,
+                                         const HDFWriteOptions& writeOptions)
+    : HDFWriterBase(filename, writeOptions)
+    , parentGroup_(parentGroup)
+    , baseMap_(baseMap)
+    , curRow_(0)
 {
     if (not parentGroup.groupIsInitialized)
         PARENT_GROUP_NOT_INITIALIZED_ERROR(PacBio::GroupNames::zmwmetrics);
@@ -57,6 +61,7 @@ void HDFZMWMetricsWriter::Flush(void)
 
 void HDFZMWMetricsWriter::Close(void)
 {
+    WaitForWrites();
     hqRegionSNRArray_.Close();
     readScoreArray_.Close();
     productivityArray_.Close();
@@ -68,6 +73,10 @@ bool HDFZMWMetricsWriter::InitializeChildHDFGroups(void)
 {
     bool OK = true;
 
+    hqRegionSNRArray_.SetWriteOptions(writeOptions_);
+    readScoreArray_.SetWriteOptions(writeOptions_);
+    productivityArray_.SetWriteOptions(writeOptions_);
+
     if (hqRegionSNRArray_.Initialize(zmwMetricsGroup_, PacBio::GroupNames::hqregionsnr, SNRNCOLS) ==
         0) {
         FAILED_TO_CREATE_GROUP_ERROR(PacBio::GroupNames::hqregionsnr);
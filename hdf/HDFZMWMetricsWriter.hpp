@@ -43,7 +43,8 @@ public:
     /// \name Constructors and Destructors
     /// \{
     HDFZMWMetricsWriter(const std::string& filename, HDFGroup& parentGroup,
-                        const std::map<char, size_t>& baseMap);
+                        const std::map<char, size_t>& baseMap,
+                        const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     ~HDFZMWMetricsWriter(void);
     /// \}
@@ -1,6 +1,8 @@
 #include <pbdata/Types.h>
 #include <hdf/HDFZMWReader.hpp>
 
+#include <cassert>
+
 HDFZMWReader::HDFZMWReader()
 {
     closeFileOnExit = false;
@@ -10,6 +12,7 @@ HDFZMWReader::HDFZMWReader()
     readHoleStatus = false;
     nZMWEntries = curZMW = 0;
     parentGroupPtr = NULL;
+    loaded_ = false;
 }
 
 int HDFZMWReader::Initialize(HDFGroup *parentGroupP)
@@ -66,6 +69,8 @@ int HDFZMWReader::Initialize()
     nZMWEntries = numEventArray.arrayLength;
     readNumEvent = true;
     curZMW = 0;
+    // Contents loaded from another group are stale.
+    loaded_ = false;
     return 1;
 }
 
@@ -84,6 +89,17 @@ bool HDFZMWReader::GetNext(ZMWGroupEntry &groupEntry)
     if (curZMW == nZMWEntries) {
         return false;
     }
+    if (loaded_) {
+        if (readHoleNumber) groupEntry.holeNumber = holeNumbers[curZMW];
+        if (readHoleStatus) groupEntry.holeStatus = holeStatuses[curZMW];
+        if (readHoleXY) {
+            groupEntry.x = holeXY[2 * curZMW];
+            groupEntry.y = holeXY[2 * curZMW + 1];
+        }
+        groupEntry.numEvents = numEvents[curZMW];
+        curZMW++;
+        return true;
+    }
     if (readHoleNumber) {
         holeNumberArray.Read(curZMW, curZMW + 1, &groupEntry.holeNumber);
     }
@@ -123,6 +139,14 @@ void HDFZMWReader::Close()
         hdfPlsFile.close();
     }
     zmwGroup.Close();
+
+    loaded_ = false;
+    holeNumberIndex_.Clear();
+    std::vector<UInt>().swap(holeNumbers);
+    std::vector<unsigned char>().swap(holeStatuses);
+    std::vector<int16_t>().swap(holeXY);
+    std::vector<DNALength>().swap(numEvents);
+    std::vector<DSLength>().swap(eventOffsets);
 }
 
 bool HDFZMWReader::GetHoleNumberAt(UInt index, UInt &holeNumber)
@@ -130,8 +154,50 @@ bool HDFZMWReader::GetHoleNumberAt(UInt index, UInt &holeNumber)
     if (index >= nZMWEntries) {
         return false;
     }
+    if (loaded_) {
+        holeNumber = holeNumbers[index];
+        return true;
+    }
     holeNumberArray.Read(index, index + 1, &holeNumber);
     return true;
 }
 
+int HDFZMWReader::Load()
+{
+    if (readHoleNumber) {
+        holeNumberArray.ReadDataset(holeNumbers);
+        if (holeNumbers.size() != nZMWEntries) return 0;
+        holeNumberIndex_.Build(holeNumbers);
+    }
+    if (readHoleStatus) {
+        holeStatusArray.ReadDataset(holeStatuses);
+        if (holeStatuses.size() != nZMWEntries) return 0;
+    }
+    if (readHoleXY) {
+        if (xyArray.GetNRows() != nZMWEntries) return 0;
+        holeXY.resize(2 * nZMWEntries);
+        if (nZMWEntries > 0) xyArray.Read(0, nZMWEntries, &holeXY[0]);
+    }
+    numEventArray.ReadDataset(numEvents);
+    if (numEvents.size() != nZMWEntries) return 0;
+    eventOffsets.resize(nZMWEntries + 1);
+    eventOffsets[0] = 0;
+    for (UInt i = 0; i < nZMWEntries; i++) {
+        eventOffsets[i + 1] = eventOffsets[i] + numEvents[i];
+    }
+    loaded_ = true;
+    return 1;
+}
+
+bool HDFZMWReader::IsLoaded() const { return loaded_; }
+
+bool HDFZMWReader::LookupHoleNumber(UInt holeNumber, UInt &index) const
+{
+    assert(loaded_ and readHoleNumber);
+    size_t position;
+    if (not holeNumberIndex_.Find(holeNumber, position)) return false;
+    index = static_cast<UInt>(position);
+    return true;
+}
+
 HDFZMWReader::~HDFZMWReader() { Close(); }
@@ -2,12 +2,14 @@
 #define _BLASR_HDF_ZMW_READER_HPP_
 
 #include <cstdint>
+#include <vector>
 
 #include <H5Cpp.h>
 
 #include <hdf/HDF2DArray.hpp>
 #include <hdf/HDFArray.hpp>
 #include <hdf/HDFGroup.hpp>
+#include <pbdata/reads/HoleNumberIndex.hpp>
 #include <pbdata/reads/ZMWGroupEntry.hpp>
 
 class HDFZMWReader
@@ -27,6 +29,15 @@ public:
     bool closeFileOnExit;
     H5::H5File hdfPlsFile;
 
+    // Contents of the ZMW datasets, filled by Load().
+    std::vector<UInt> holeNumbers;
+    std::vector<unsigned char> holeStatuses;
+    std::vector<int16_t> holeXY;
+    std::vector<DNALength> numEvents;
+    // Offset of the first event of each zmw in the event datasets,
+    // e.g. BaseCalls/Basecall, and the total number of events last.
+    std::vector<DSLength> eventOffsets;
+
     HDFZMWReader();
 
     int Initialize(HDFGroup *parentGroupP);
@@ -42,7 +53,21 @@ public:
     // Return true if get hole number at ZMW/HoleNumber[index].
     bool GetHoleNumberAt(UInt index, UInt &holeNumber);
 
+    // Read the ZMW datasets with one read each and index hole numbers.
+    // GetNext and GetHoleNumberAt then no longer read the file.
+    int Load();
+
+    bool IsLoaded() const;
+
+    // Find the index of holeNumber in ZMW/HoleNumber in constant time.
+    // Requires Load().
+    bool LookupHoleNumber(UInt holeNumber, UInt &index) const;
+
     ~HDFZMWReader();
+
+private:
+    bool loaded_;
+    HoleNumberIndex holeNumberIndex_;
 };
 
 #endif
@@ -5,8 +5,9 @@
 #include <hdf/HDFZMWWriter.hpp>
 
 HDFZMWWriter::HDFZMWWriter(const std::string& filename, HDFGroup& parentGroup,
-                           const bool inPulseCalls, const std::map<char, size_t>& baseMap)
-    : HDFWriterBase(filename)
+                           const bool inPulseCalls, const std::map<char, size_t>& baseMap,
+                           const HDFWriteOptions& writeOptions)
+    : HDFWriterBase(filename, writeOptions)
     , parentGroup_(parentGroup)
     , baseMap_(baseMap)
     , inPulseCalls_(inPulseCalls)
@@ -24,8 +25,9 @@ HDFZMWWriter::HDFZMWWriter(const std::string& filename, HDFGroup& parentGroup,
     }
 }
 
-HDFZMWWriter::HDFZMWWriter(const std::string& filename, HDFGroup& parentGroup)
-    : HDFZMWWriter(filename, parentGroup, false, {})
+HDFZMWWriter::HDFZMWWriter(const std::string& filename, HDFGroup& parentGroup,
+                           const HDFWriteOptions& writeOptions)
+    : HDFZMWWriter(filename, parentGroup, false, {}, writeOptions)
 {
 }
 
@@ -158,6 +160,7 @@ void HDFZMWWriter::Flush(void)
 void HDFZMWWriter::Close(void)
 {
     this->Flush();
+    WaitForWrites();
 
     // Mandatory metrics
     numEventArray_.Close();
@@ -173,6 +176,12 @@ void HDFZMWWriter::Close(void)
 
 bool HDFZMWWriter::InitializeChildHDFGroups(void)
 {
+    numEventArray_.SetWriteOptions(writeOptions_);
+    holeNumberArray_.SetWriteOptions(writeOptions_);
+    holeStatusArray_.SetWriteOptions(writeOptions_);
+    holeXYArray_.SetWriteOptions(writeOptions_);
+    baseLineSigmaArray_.SetWriteOptions(writeOptions_);
+
     // Mandatory metrics
     if (numEventArray_.Initialize(zmwGroup_, PacBio::GroupNames::numevent) == 0) {
         FAILED_TO_CREATE_GROUP_ERROR(PacBio::GroupNames::numevent);
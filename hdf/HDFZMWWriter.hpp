@@ -24,14 +24,17 @@ class HDFZMWWriter : public HDFWriterBase
 public:
     /// \name Constructors and Destructors
     /// \{
-    HDFZMWWriter(const std::string& filename, HDFGroup& parentGroup);
+    HDFZMWWriter(const std::string& filename, HDFGroup& parentGroup,
+                 const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     /// \params[in] filename
     /// \params[in] parentGroup
     /// \params[in] inPulseCalls, true if this ZMW is within PulseCalls.
     /// \params[in] baseMap, base to channel index in H5.
+    /// \params[in] writeOptions, chunking and compression of ZMW datasets.
     HDFZMWWriter(const std::string& filename, HDFGroup& parentGroup, const bool inPulseCalls,
-                 const std::map<char, size_t>& baseMap);
+                 const std::map<char, size_t>& baseMap,
+                 const HDFWriteOptions& writeOptions = HDFWriteOptions());
 
     ~HDFZMWWriter(void);
     /// \}
@@ -3,6 +3,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <utility>
 
 DNALength DNASequence::size() { return length; }
 
@@ -19,6 +20,14 @@ void DNASequence::TakeOwnership(DNASequence &rhs)
     rhs.deleteOnExit = false;
 }
 
+void DNASequence::Swap(DNASequence &rhs)
+{
+    std::swap(length, rhs.length);
+    std::swap(seq, rhs.seq);
+    std::swap(bitsPerNuc, rhs.bitsPerNuc);
+    std::swap(deleteOnExit, rhs.deleteOnExit);
+}
+
 void DNASequence::Append(const DNASequence &rhs, DNALength appendPos)
 {
     assert(deleteOnExit);  // must have control over seq.
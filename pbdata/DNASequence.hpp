@@ -38,6 +38,9 @@ public:
 
     void TakeOwnership(DNASequence &rhs);
 
+    // Exchange sequences and their ownership with rhs, without copying.
+    void Swap(DNASequence &rhs);
+
     void Append(const DNASequence &rhs, DNALength appendPos = 0);
 
     DNASequence &Copy(const DNASequence &rhs, DNALength rhsPos = 0, DNALength rhsLength = 0);
@@ -1,6 +1,7 @@
 #include <pbdata/FASTASequence.hpp>
 
 #include <cstdlib>
+#include <utility>
 
 FASTASequence::FASTASequence() : DNASequence()
 {
@@ -52,6 +53,14 @@ void FASTASequence::ShallowCopy(const FASTASequence &rhs)
     deleteTitleOnExit = false;
 }
 
+void FASTASequence::Swap(FASTASequence &rhs)
+{
+    DNASequence::Swap(rhs);
+    std::swap(title, rhs.title);
+    std::swap(titleLength, rhs.titleLength);
+    std::swap(deleteTitleOnExit, rhs.deleteTitleOnExit);
+}
+
 std::string FASTASequence::GetTitle() const { return std::string(title); }
 
 // Delete title if this FASTASequence is under control or
@@ -39,6 +39,9 @@ public:
 
     void ShallowCopy(const FASTASequence &rhs);
 
+    // Exchange sequences, titles and their ownership with rhs.
+    void Swap(FASTASequence &rhs);
+
     std::string GetTitle() const;
 
     void DeleteTitle();
@@ -11,6 +11,7 @@
 #include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 //
@@ -33,6 +34,7 @@ void FASTQSequence::SetQVScale(QVScale qvScaleP)
 
 QualityValueVector<QualityValue> *FASTQSequence::GetQVPointerByIndex(int index)
 {
+    LoadQVs(index == I_QualityValue ? QualityValueTrack : 1 << (index - 1));
     if (index == 0) {
         return &qual;
     }
@@ -100,10 +102,12 @@ FASTQSequence::FASTQSequence() : FASTASequence()
     substitutionQVPrior = 0;
     preBaseDeletionQVPrior = 0;
     qvScale = PHRED;
+    deferredQVs_ = 0;
 }
 
 QualityValue FASTQSequence::GetDeletionQV(DNALength pos) const
 {
+    LoadQVs(DeletionQV);
     assert(pos < ((unsigned int)-1));
     assert(pos < length);
     if (deletionQV.Empty()) {
@@ -115,6 +119,7 @@ QualityValue FASTQSequence::GetDeletionQV(DNALength pos) const
 
 QualityValue FASTQSequence::GetMergeQV(DNALength pos) const
 {
+    LoadQVs(MergeQV);
     assert(pos < ((unsigned int)-1));
     assert(pos < length);
     if (mergeQV.Empty()) {
@@ -126,6 +131,7 @@ QualityValue FASTQSequence::GetMergeQV(DNALength pos) const
 
 Nucleotide FASTQSequence::GetSubstitutionTag(DNALength pos) const
 {
+    LoadQVs(SubstitutionTag);
     if (substitutionTag == NULL) {
         return 'N';
     }
@@ -136,6 +142,7 @@ Nucleotide FASTQSequence::GetSubstitutionTag(DNALength pos) const
 
 Nucleotide FASTQSequence::GetDeletionTag(DNALength pos) const
 {
+    LoadQVs(DeletionTag);
     if (deletionTag == NULL) {
         return 'N';
     }
@@ -146,6 +153,7 @@ Nucleotide FASTQSequence::GetDeletionTag(DNALength pos) const
 
 QualityValue FASTQSequence::GetInsertionQV(DNALength pos) const
 {
+    LoadQVs(InsertionQV);
     if (insertionQV.Empty()) {
         return insertionQVPrior;
     }
@@ -156,6 +164,7 @@ QualityValue FASTQSequence::GetInsertionQV(DNALength pos) const
 
 QualityValue FASTQSequence::GetSubstitutionQV(DNALength pos) const
 {
+    LoadQVs(SubstitutionQV);
     if (substitutionQV.Empty()) {
         return substitutionQVPrior;
     }
@@ -164,6 +173,10 @@ QualityValue FASTQSequence::GetSubstitutionQV(DNALength pos) const
     return substitutionQV[pos];
 }
 
+int FASTQSequence::DeferredQVs(void) const { return deferredQVs_; }
+
+void FASTQSequence::DecodeDeferredQVs(int qvMask) { deferredQVs_ &= ~qvMask; }
+
 QualityValue FASTQSequence::GetPreBaseDeletionQV(DNALength pos, Nucleotide nuc) const
 {
     if (preBaseDeletionQV.Empty()) {
@@ -179,10 +192,31 @@ void FASTQSequence::ShallowCopy(const FASTQSequence &rhs)
     CheckBeforeCopyOrReference(rhs, "FASTQSequence");
     FASTQSequence::Free();
 
+    rhs.LoadQVs(QualityValueTrack);
     qual.ShallowCopy(rhs.qual, 0, length);
     FASTASequence::ShallowCopy(rhs);
 }
 
+void FASTQSequence::Swap(FASTQSequence &rhs)
+{
+    FASTASequence::Swap(rhs);
+    // QualityValueVector copies are shallow.
+    std::swap(qual, rhs.qual);
+    std::swap(deletionQV, rhs.deletionQV);
+    std::swap(preBaseDeletionQV, rhs.preBaseDeletionQV);
+    std::swap(insertionQV, rhs.insertionQV);
+    std::swap(substitutionQV, rhs.substitutionQV);
+    std::swap(mergeQV, rhs.mergeQV);
+    std::swap(deletionTag, rhs.deletionTag);
+    std::swap(substitutionTag, rhs.substitutionTag);
+    std::swap(deletionQVPrior, rhs.deletionQVPrior);
+    std::swap(insertionQVPrior, rhs.insertionQVPrior);
+    std::swap(substitutionQVPrior, rhs.substitutionQVPrior);
+    std::swap(preBaseDeletionQVPrior, rhs.preBaseDeletionQVPrior);
+    std::swap(qvScale, rhs.qvScale);
+    std::swap(deferredQVs_, rhs.deferredQVs_);
+}
+
 void FASTQSequence::ReferenceSubstring(const FASTQSequence &rhs)
 {
     FASTQSequence::ReferenceSubstring(rhs, 0, rhs.length);
@@ -203,6 +237,8 @@ void FASTQSequence::ReferenceSubstring(const FASTQSequence &rhs, DNALength pos,
     FASTQSequence::Free();
 
     SetQVScale(rhs.qvScale);
+    // QVs are referenced, not copied, so rhs must decode them first.
+    rhs.LoadQVs(FASTQTracks);
     if (substrLength == 0) {
         substrLength = rhs.length - pos;
     }
@@ -252,6 +288,7 @@ void FASTQSequence::CopyQualityValues(const FASTQSequence &rhs)
     assert(deleteOnExit);
 
     SetQVScale(rhs.qvScale);
+    rhs.LoadQVs(FASTQTracks);
     qual.Copy(rhs.qual, rhs.length);
     deletionQV.Copy(rhs.deletionQV, rhs.length);
     insertionQV.Copy(rhs.insertionQV, rhs.length);
@@ -344,7 +381,11 @@ FASTQSequence &FASTQSequence::operator=(const FASTQSequence &rhs)
     return *this;
 }
 
-FASTQSequence::FASTQSequence(const FASTQSequence &rhs) { ((FASTQSequence *)this)->Copy(rhs); }
+FASTQSequence::FASTQSequence(const FASTQSequence &rhs)
+{
+    deferredQVs_ = 0;
+    ((FASTQSequence *)this)->Copy(rhs);
+}
 
 // Copy rhs to this, including seq, title and QVs.
 void FASTQSequence::Assign(FASTQSequence &rhs)
@@ -379,6 +420,7 @@ void FASTQSequence::PrintFastqQuality(std::ostream &out, int lineLength) const
 bool FASTQSequence::GetQVs(const QVIndex &qvIndex, std::vector<uint8_t> &qvs, bool reverse) const
 {
     qvs.clear();
+    LoadQVs(qvIndex == I_QualityValue ? QualityValueTrack : 1 << (qvIndex - 1));
     uint8_t *qualPtr = nullptr;
     int charOffset = charToQuality;
     if (qvIndex == I_QualityValue) {
@@ -495,6 +537,7 @@ void FASTQSequence::PrintAsciiQual(std::ostream &out, int lineLength) const
 void FASTQSequence::PrintQual(std::ostream &out, int lineLength) const
 {
     out << ">" << this->title << std::endl;
+    LoadQVs(QualityValueTrack);
     DNALength i;
     for (i = 0; i < length; i++) {
         out << (int)qual[i];
@@ -521,6 +564,7 @@ void FASTQSequence::MakeRC(FASTQSequence &rc)
     rc.Free();
     FASTASequence::MakeRC(rc);
     rc.SetQVScale(qvScale);
+    LoadQVs(FASTQTracks);
 
     if (not qual.Empty()) {
         // QVs are independent of one another. A FASTQSequence can have
@@ -616,6 +660,7 @@ void FASTQSequence::Free()
     //Reset deletionTag and substitionTag anyway
     deletionTag = NULL;
     substitutionTag = NULL;
+    deferredQVs_ = 0;
 
     // Free seq and title, reset deleteOnExit.
     // Don't call FASTASequence::Free before freeing QVs.
@@ -624,6 +669,7 @@ void FASTQSequence::Free()
 
 void FASTQSequence::LowerCaseMask(int qThreshold)
 {
+    LoadQVs(QualityValueTrack);
     if (qual.Empty() == true) return;
 
     for (DNALength i = 0; i < length; i++) {
@@ -637,6 +683,7 @@ float FASTQSequence::GetAverageQuality() const
 {
     DNALength p;
     float totalQ;
+    LoadQVs(QualityValueTrack);
     if (qual.Empty() == true) {
         return 0.0;
     }
@@ -692,6 +739,8 @@ void FASTQSequence::Copy(const PacBio::BAM::BamRecord &record)
 
 FASTQSequence &FASTQSequence::ReverseComplementSelf(void)
 {
+    // Copy(rc) drops deferred tracks, including those of subclasses.
+    LoadQVs(AllQVTracks);
     FASTQSequence rc;
     MakeRC(rc);
     FASTQSequence::Copy(rc);
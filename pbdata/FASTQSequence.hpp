@@ -27,6 +27,15 @@ enum QVIndex
     I_SubstitutionTag = 5,
     I_DeletionTag = 6
 };
+/// Tracks of a read in addition to QVList, for FASTQSequence::LoadQVs.
+enum QVTrack
+{
+    QualityValueTrack = 0x40,
+    PreBaseFramesTrack = 0x80,
+    PulseWidthTrack = 0x100,
+    FASTQTracks = 0x7f,  // QualityValueTrack and QVList
+    AllQVTracks = 0x1ff
+};
 
 class FASTQSequence : public FASTASequence
 {
@@ -69,8 +78,22 @@ public:
 
     QualityValue GetPreBaseDeletionQV(DNALength pos, Nucleotide nuc) const;
 
+    /// Decode the tracks in qvMask (QVList | QVTrack) whose decoding a
+    /// subclass deferred, see SMRTSequence::LazyCopy, so that their
+    /// fields such as insertionQV can be read. Each track is decoded on
+    /// its first load. The accessors, copies and printers of this class
+    /// load the tracks they read; other code must load them first.
+    /// Not thread-safe while tracks in qvMask are deferred.
+    inline void LoadQVs(int qvMask) const;
+
+    /// \returns tracks (QVList | QVTrack) whose decoding is deferred.
+    int DeferredQVs(void) const;
+
     void ShallowCopy(const FASTQSequence &rhs);
 
+    // Exchange sequences, titles, QVs and their ownership with rhs.
+    void Swap(FASTQSequence &rhs);
+
     void ReferenceSubstring(const FASTQSequence &rhs);
 
     void ReferenceSubstring(const FASTQSequence &rhs, DNALength pos);
@@ -157,8 +180,23 @@ public:
     /// Copy name, sequence, and QVs from BamRecord.
     void Copy(const PacBio::BAM::BamRecord &record);
 #endif
+
+protected:
+    // Tracks (QVList | QVTrack) not decoded yet, always 0 unless set by
+    // a subclass that defers decoding.
+    int deferredQVs_;
+
+    // Decode the deferred tracks in qvMask and clear them in deferredQVs_.
+    virtual void DecodeDeferredQVs(int qvMask);
 };
 
 inline FASTQSequence::~FASTQSequence() { FASTQSequence::Free(); }
 
+inline void FASTQSequence::LoadQVs(int qvMask) const
+{
+    if (deferredQVs_ & qvMask) {
+        const_cast<FASTQSequence *>(this)->DecodeDeferredQVs(deferredQVs_ & qvMask);
+    }
+}
+
 #endif  // _BLASR_FASTQ_SEQUENCE_HPP_
@@ -5,6 +5,7 @@
 #include <pbdata/utils/SMRTTitle.hpp>
 
 #include <cstdlib>
+#include <utility>
 
 SMRTSequence::SMRTSequence()
     : FASTQSequence()
@@ -147,6 +148,10 @@ void SMRTSequence::Copy(const SMRTSequence &rhs, DNALength rhsPos, DNALength rhs
     // Free this SMRTSequence before copying anything from rhs.
     SMRTSequence::Free();
 
+    // Deferred QVs are clipped from the whole bamRecord of rhs, so they
+    // are loaded in rhs rather than carried over to this copy.
+    rhs.LoadQVs(AllQVTracks);
+
     FASTQSequence subseq;
     // subseq.seq is referenced, while seq.title is not, we need to call
     // subseq.Free() to prevent memory leak.
@@ -211,6 +216,32 @@ SMRTSequence &SMRTSequence::operator=(const SMRTSequence &rhs)
     return *this;
 }
 
+void SMRTSequence::Swap(SMRTSequence &rhs)
+{
+    FASTQSequence::Swap(rhs);
+    std::swap(hqRegionSnr_, rhs.hqRegionSnr_);
+    std::swap(subreadStart_, rhs.subreadStart_);
+    std::swap(subreadEnd_, rhs.subreadEnd_);
+    std::swap(readGroupId_, rhs.readGroupId_);
+    std::swap(zmwData, rhs.zmwData);
+    std::swap(lowQualityPrefix, rhs.lowQualityPrefix);
+    std::swap(lowQualitySuffix, rhs.lowQualitySuffix);
+    std::swap(highQualityRegionScore, rhs.highQualityRegionScore);
+    std::swap(readScore, rhs.readScore);
+    std::swap(copiedFromBam, rhs.copiedFromBam);
+    std::swap(preBaseFrames, rhs.preBaseFrames);
+    std::swap(widthInFrames, rhs.widthInFrames);
+    std::swap(meanSignal, rhs.meanSignal);
+    std::swap(maxSignal, rhs.maxSignal);
+    std::swap(midSignal, rhs.midSignal);
+    std::swap(classifierQV, rhs.classifierQV);
+    std::swap(startFrame, rhs.startFrame);
+    std::swap(pulseIndex, rhs.pulseIndex);
+#ifdef USE_PBBAM
+    std::swap(bamRecord, rhs.bamRecord);
+#endif
+}
+
 void SMRTSequence::Free()
 {
     if (deleteOnExit == true) {
@@ -260,6 +291,20 @@ void SMRTSequence::Free()
     FASTQSequence::Free();
 }
 
+int SMRTSequence::GetStorageSize() const
+{
+    int total = FASTQSequence::GetStorageSize();
+    if (preBaseFrames) total += length * sizeof(HalfWord);
+    if (widthInFrames) total += length * sizeof(HalfWord);
+    if (meanSignal) total += length * sizeof(HalfWord);
+    if (maxSignal) total += length * sizeof(HalfWord);
+    if (midSignal) total += length * sizeof(HalfWord);
+    if (classifierQV) total += length * sizeof(float);
+    if (startFrame) total += length * sizeof(unsigned int);
+    if (pulseIndex) total += length * sizeof(int);
+    return total;
+}
+
 SMRTSequence &SMRTSequence::HoleNumber(UInt holeNumber)
 {
     zmwData.holeNumber = holeNumber;
@@ -394,6 +439,15 @@ void SMRTSequence::MadeFromSubreadsAsPolymerase(const std::vector<SMRTSequence>
 }
 
 #ifdef USE_PBBAM
+namespace {
+// Clip QVs decoded from a whole BamRecord to [pos, pos + length).
+std::string ClipQVs(const std::string &qvs, const DNALength pos, const DNALength length)
+{
+    if (qvs.size() < pos + length) return "";
+    return qvs.substr(pos, length);
+}
+}  // namespace
+
 bool SMRTSequence::IsValid(const PacBio::BAM::BamRecord &record)
 {
     DNALength expectedLength = 0;
@@ -461,14 +515,7 @@ void SMRTSequence::Copy(const PacBio::BAM::BamRecord &record, bool copyAllQVs)
     // Do NOT copy other SMRTQVs such as startFrame, meanSignal...
     (static_cast<FASTQSequence *>(this))->Copy(bamRecord);
 
-    // Set subread start, subread end in coordinate of zmw.
-    if (bamRecord.Type() != PacBio::BAM::RecordType::CCS) {
-        subreadStart_ = static_cast<int>(record.QueryStart());
-        subreadEnd_ = static_cast<int>(bamRecord.QueryEnd());
-    } else {
-        subreadStart_ = 0;
-        subreadEnd_ = static_cast<int>(bamRecord.Sequence().length());
-    }
+    CopyBamRecordInfo(record);
 
     // Shall we copy all pulse QVs including ipd and pw?
     if (copyAllQVs) {
@@ -485,6 +532,85 @@ void SMRTSequence::Copy(const PacBio::BAM::BamRecord &record, bool copyAllQVs)
             std::memcpy(widthInFrames, &qvs[0], qvs.size() * sizeof(HalfWord));
         }
     }
+}
+
+void SMRTSequence::LazyCopy(const PacBio::BAM::BamRecord &record, bool copyAllQVs)
+{
+    Free();
+
+    copiedFromBam = true;
+
+    this->MakeNativeOrientedBamRecord(record);  // bamRecord must always have native orientation
+
+    // Only copy title and sequence, defer QVs.
+    (static_cast<FASTASequence *>(this))->Copy(bamRecord);
+
+    CopyBamRecordInfo(record);
+
+    deferredQVs_ = FASTQTracks;
+    if (copyAllQVs) {
+        deferredQVs_ |= PreBaseFramesTrack | PulseWidthTrack;
+    }
+}
+
+void SMRTSequence::DecodeDeferredQVs(int qvMask)
+{
+    const int tracks = deferredQVs_ & qvMask;
+    if (tracks == 0) return;
+    deferredQVs_ &= ~tracks;
+
+    // QVs are deferred for the whole native-oriented bamRecord only.
+    assert(deleteOnExit);
+
+    if (tracks & QualityValueTrack) {
+        qual.Copy(ClipQVs(bamRecord.Qualities().Fastq(), 0, length));
+    }
+    if ((tracks & InsertionQV) and bamRecord.HasInsertionQV()) {
+        insertionQV.Copy(ClipQVs(bamRecord.InsertionQV().Fastq(), 0, length));
+    }
+    if ((tracks & DeletionQV) and bamRecord.HasDeletionQV()) {
+        deletionQV.Copy(ClipQVs(bamRecord.DeletionQV().Fastq(), 0, length));
+    }
+    if ((tracks & SubstitutionQV) and bamRecord.HasSubstitutionQV()) {
+        substitutionQV.Copy(ClipQVs(bamRecord.SubstitutionQV().Fastq(), 0, length));
+    }
+    if ((tracks & MergeQV) and bamRecord.HasMergeQV()) {
+        mergeQV.Copy(ClipQVs(bamRecord.MergeQV().Fastq(), 0, length));
+    }
+    if ((tracks & SubstitutionTag) and bamRecord.HasSubstitutionTag()) {
+        std::string qvs = ClipQVs(bamRecord.SubstitutionTag(), 0, length);
+        AllocateSubstitutionTagSpace(static_cast<DNALength>(qvs.size()));
+        std::memcpy(substitutionTag, qvs.c_str(), qvs.size() * sizeof(char));
+    }
+    if ((tracks & DeletionTag) and bamRecord.HasDeletionTag()) {
+        std::string qvs = ClipQVs(bamRecord.DeletionTag(), 0, length);
+        AllocateDeletionTagSpace(static_cast<DNALength>(qvs.size()));
+        std::memcpy(deletionTag, qvs.c_str(), qvs.size() * sizeof(char));
+    }
+    if ((tracks & PreBaseFramesTrack) and bamRecord.HasPreBaseFrames()) {
+        std::vector<uint16_t> qvs = bamRecord.PreBaseFrames().DataRaw();
+        assert(preBaseFrames == nullptr and length <= qvs.size());
+        preBaseFrames = ProtectedNew<HalfWord>(length);
+        std::memcpy(preBaseFrames, &qvs[0], length * sizeof(HalfWord));
+    }
+    if ((tracks & PulseWidthTrack) and bamRecord.HasPulseWidth()) {
+        std::vector<uint16_t> qvs = bamRecord.PulseWidth().DataRaw();
+        assert(widthInFrames == nullptr and length <= qvs.size());
+        widthInFrames = ProtectedNew<HalfWord>(length);
+        std::memcpy(widthInFrames, &qvs[0], length * sizeof(HalfWord));
+    }
+}
+
+void SMRTSequence::CopyBamRecordInfo(const PacBio::BAM::BamRecord &record)
+{
+    // Set subread start, subread end in coordinate of zmw.
+    if (bamRecord.Type() != PacBio::BAM::RecordType::CCS) {
+        subreadStart_ = static_cast<int>(record.QueryStart());
+        subreadEnd_ = static_cast<int>(bamRecord.QueryEnd());
+    } else {
+        subreadStart_ = 0;
+        subreadEnd_ = static_cast<int>(bamRecord.Sequence().length());
+    }
 
     // preBaseQVs are not included in BamRecord, and will not be copied.
     // Copy read group id from BamRecord.
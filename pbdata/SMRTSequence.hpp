@@ -6,6 +6,8 @@
 #include <cassert>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <pbdata/Enumerations.h>
 #include <pbdata/Types.h>
@@ -162,6 +164,8 @@ public:
     // Copy native orientated view of record to this->bamRecord
     void MakeNativeOrientedBamRecord(const PacBio::BAM::BamRecord &record);
 
+    /// Copy rhs[rhsPos, rhsPos + rhsLength) with its QVs. QVs deferred
+    /// by rhs are loaded in rhs first and are not deferred in this copy.
     void Copy(const SMRTSequence &rhs);
 
     void Copy(const SMRTSequence &rhs, DNALength rhsPos, DNALength rhsLength);
@@ -170,8 +174,15 @@ public:
 
     SMRTSequence &operator=(const SMRTSequence &rhs);
 
+    /// Exchange all fields of this read with rhs without copying bases,
+    /// QVs or pulse fields. QVs deferred by LazyCopy stay deferred.
+    void Swap(SMRTSequence &rhs);
+
     void Free();
 
+    // Bytes of bases, title, QVs and pulse fields of this read.
+    int GetStorageSize() const;
+
 #ifdef USE_PBBAM
 public:
     /// \returns if record is a valid bam record.
@@ -183,6 +194,26 @@ public:
     // If copyAllQVs is false, also copy all QVs.
     void Copy(const PacBio::BAM::BamRecord &record, bool copyAllQVs = false);
 
+    /// Same as Copy(record, copyAllQVs), except that only the title,
+    /// sequence and zmw information are decoded. QV tracks stay in
+    /// bamRecord, each until it is first loaded by LoadQVs, so reads of
+    /// which only bases are used never pay for decoding QVs.
+    /// \note Call LoadQVs() before reading QV fields such as insertionQV
+    ///       or preBaseFrames directly.
+    void LazyCopy(const PacBio::BAM::BamRecord &record, bool copyAllQVs = false);
+
+protected:
+    // Decode the tracks in qvMask from bamRecord. Only a read filled by
+    // LazyCopy (or swapped with one) defers QVs, so deferred tracks
+    // always cover the whole native-oriented bamRecord.
+    void DecodeDeferredQVs(int qvMask);
+
+private:
+    // Copy subread boundaries, read group id, zmw info, read score and
+    // HQ region SNRs from bamRecord, shared by Copy and LazyCopy.
+    void CopyBamRecordInfo(const PacBio::BAM::BamRecord &record);
+
+public:
     // Keep track of BamRecord from which this SMRTSequence is
     // originally copied. However, one should NOT assume
     // that this SMRTSequence has the same sequence, title, QVs as
@@ -96,6 +96,7 @@ void AfgBasWriter::WriteBases(SMRTSequence &seq)
 void AfgBasWriter::WriteQualities(SMRTSequence &seq)
 {
     afgOut << "qlt:" << std::endl;
+    seq.LoadQVs(QualityValueTrack);
     DNALength i;
     for (i = 0; i < seq.length; i++) {
         unsigned char quality = seq.qual.data ? seq.qual[i] : defaultQuality;
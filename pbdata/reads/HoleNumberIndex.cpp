@@ -0,0 +1,57 @@
+#include <pbdata/reads/HoleNumberIndex.hpp>
+
+#include <algorithm>
+#include <limits>
+
+const UInt HoleNumberIndex::NotFound = std::numeric_limits<UInt>::max();
+
+HoleNumberIndex::HoleNumberIndex() : minHoleNumber_(0), size_(0) {}
+
+void HoleNumberIndex::Build(const std::vector<UInt> &holeNumbers)
+{
+    Clear();
+    if (holeNumbers.empty()) return;
+    size_ = holeNumbers.size();
+
+    auto minMax = std::minmax_element(holeNumbers.begin(), holeNumbers.end());
+    minHoleNumber_ = *minMax.first;
+    size_t span = static_cast<size_t>(*minMax.second - minHoleNumber_) + 1;
+    if (span <= 4 * holeNumbers.size() + 1024) {
+        positions_.assign(span, NotFound);
+        for (size_t i = holeNumbers.size(); i > 0; i--) {
+            positions_[holeNumbers[i - 1] - minHoleNumber_] = static_cast<UInt>(i - 1);
+        }
+    } else {
+        sparsePositions_.reserve(holeNumbers.size());
+        for (size_t i = 0; i < holeNumbers.size(); i++) {
+            sparsePositions_.insert(std::make_pair(holeNumbers[i], i));
+        }
+    }
+}
+
+void HoleNumberIndex::Clear()
+{
+    minHoleNumber_ = 0;
+    size_ = 0;
+    std::vector<UInt>().swap(positions_);
+    sparsePositions_.clear();
+}
+
+size_t HoleNumberIndex::size() const { return size_; }
+
+bool HoleNumberIndex::Find(UInt holeNumber, size_t &position) const
+{
+    if (not positions_.empty()) {
+        if (holeNumber < minHoleNumber_ or holeNumber - minHoleNumber_ >= positions_.size()) {
+            return false;
+        }
+        UInt dense = positions_[holeNumber - minHoleNumber_];
+        if (dense == NotFound) return false;
+        position = dense;
+        return true;
+    }
+    auto it = sparsePositions_.find(holeNumber);
+    if (it == sparsePositions_.end()) return false;
+    position = it->second;
+    return true;
+}
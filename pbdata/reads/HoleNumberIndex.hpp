@@ -0,0 +1,43 @@
+#ifndef _BLASR_HOLE_NUMBER_INDEX_HPP_
+#define _BLASR_HOLE_NUMBER_INDEX_HPP_
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <pbdata/Types.h>
+
+//
+// Map from zmw hole number to its position in a table, e.g. ZMW/HoleNumber
+// or the zmws of a region table, in constant time.  Hole numbers of a
+// movie are close to a contiguous range, so positions are kept in a
+// vector indexed by holeNumber - minimum hole number, unless the hole
+// numbers are too sparse, in which case a hash table is used.
+//
+class HoleNumberIndex
+{
+public:
+    HoleNumberIndex();
+
+    // Index holeNumbers[i] -> i.  If a hole number is repeated, the first
+    // position is kept.
+    void Build(const std::vector<UInt> &holeNumbers);
+
+    void Clear();
+
+    size_t size() const;
+
+    // Return true and set position if holeNumber is indexed.
+    bool Find(UInt holeNumber, size_t &position) const;
+
+private:
+    static const UInt NotFound;
+
+    UInt minHoleNumber_;
+    size_t size_;
+    // Dense positions, NotFound for missing hole numbers.
+    std::vector<UInt> positions_;
+    std::unordered_map<UInt, size_t> sparsePositions_;
+};
+
+#endif
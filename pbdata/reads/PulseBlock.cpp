@@ -0,0 +1,73 @@
+#include <pbdata/reads/PulseBlock.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+PulseBlock::PulseBlock()
+{
+    firstRead = 0;
+    meanSignalNDims = midSignalNDims = maxSignalNDims = 0;
+    std::fill(channel_, channel_ + 256, 0);
+    Clear();
+}
+
+void PulseBlock::Clear()
+{
+    readOffsets.assign(1, 0);
+    startFrame.clear();
+    widthInFrames.clear();
+    classifierQV.clear();
+    meanSignal.clear();
+    midSignal.clear();
+    maxSignal.clear();
+}
+
+void PulseBlock::Free()
+{
+    std::vector<DSLength>().swap(readOffsets);
+    std::vector<unsigned int>().swap(startFrame);
+    std::vector<uint16_t>().swap(widthInFrames);
+    std::vector<float>().swap(classifierQV);
+    std::vector<uint16_t>().swap(meanSignal);
+    std::vector<uint16_t>().swap(midSignal);
+    std::vector<uint16_t>().swap(maxSignal);
+    Clear();
+}
+
+DSLength PulseBlock::GetStorageSize() const
+{
+    return readOffsets.capacity() * sizeof(DSLength) +
+           startFrame.capacity() * sizeof(unsigned int) +
+           widthInFrames.capacity() * sizeof(uint16_t) + classifierQV.capacity() * sizeof(float) +
+           (meanSignal.capacity() + midSignal.capacity() + maxSignal.capacity()) * sizeof(uint16_t);
+}
+
+DSLength PulseBlock::NumReads() const { return readOffsets.size() - 1; }
+
+DNALength PulseBlock::NumPulses(DSLength i) const
+{
+    assert(i < NumReads());
+    return static_cast<DNALength>(readOffsets[i + 1] - readOffsets[i]);
+}
+
+void PulseBlock::SetBaseMap(const std::map<char, size_t> &baseMap)
+{
+    std::fill(channel_, channel_ + 256, 0);
+    for (const auto &base : baseMap) {
+        channel_[static_cast<unsigned char>(base.first)] = static_cast<uint8_t>(base.second);
+    }
+}
+
+void PulseBlock::FlattenSignalToBase(const std::vector<uint16_t> &signal, int nDims, DSLength i,
+                                     const int *basToPlsIndex, const Nucleotide *seq,
+                                     DNALength length, uint16_t *dest) const
+{
+    if (nDims == 2) {
+        const uint16_t *pulses = ReadPulses(signal, i, 4);
+        for (DNALength b = 0; b < length; b++) {
+            dest[b] = pulses[basToPlsIndex[b] * 4 + channel_[seq[b]]];
+        }
+    } else {
+        FlattenToBase(signal, i, basToPlsIndex, length, dest);
+    }
+}
@@ -0,0 +1,96 @@
+#ifndef _BLASR_PULSE_BLOCK_HPP_
+#define _BLASR_PULSE_BLOCK_HPP_
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <pbdata/Types.h>
+#include <pbdata/DNASequence.hpp>
+
+//
+// Pulse fields of a block of consecutive reads of a pulse file.  Each
+// field is one column of pulse-indexed values for the whole block, and
+// the pulses of a read are a contiguous span of every column.  Columns
+// keep their capacity when the next block is loaded into them, so
+// reading and flattening reads does not allocate per read.
+//
+class PulseBlock
+{
+public:
+    // Index of the first read of the block in the pulse file.
+    DSLength firstRead;
+    // Offset of the first pulse of each read of the block in the
+    // columns, followed by the number of pulses in the block.
+    std::vector<DSLength> readOffsets;
+
+    std::vector<unsigned int> startFrame;
+    std::vector<uint16_t> widthInFrames;
+    std::vector<float> classifierQV;
+    // A signal has 1 value per pulse, or 4 (one per channel) if its
+    // NDims is 2.  NDims is 0 if the signal is not loaded.
+    int meanSignalNDims, midSignalNDims, maxSignalNDims;
+    std::vector<uint16_t> meanSignal;
+    std::vector<uint16_t> midSignal;
+    std::vector<uint16_t> maxSignal;
+
+    PulseBlock();
+
+    // Remove all reads, keeping allocated memory.
+    void Clear();
+
+    // Remove all reads and release allocated memory, e.g. once the
+    // consumer of the last block is done with it.
+    void Free();
+
+    // Bytes allocated for the columns of this block.
+    DSLength GetStorageSize() const;
+
+    DSLength NumReads() const;
+
+    // Number of pulses of the i-th read of the block.
+    DNALength NumPulses(DSLength i) const;
+
+    // Pulses of the i-th read of the block in column, which holds
+    // nValues values per pulse.
+    template <typename T>
+    const T *ReadPulses(const std::vector<T> &column, DSLength i, int nValues = 1) const;
+
+    // Set the channel of each base in 2D signals, from a base map such as
+    // ScanData::baseMap.  Bases not in the map use channel 0.
+    void SetBaseMap(const std::map<char, size_t> &baseMap);
+
+    // Copy values of pulses called as bases of the i-th read, that is
+    //   dest[b] = ReadPulses(column, i)[basToPlsIndex[b]] for b < length,
+    // where basToPlsIndex maps bases to pulses from the start of the read.
+    template <typename T>
+    void FlattenToBase(const std::vector<T> &column, DSLength i, const int *basToPlsIndex,
+                       DNALength length, T *dest) const;
+
+    // Same as FlattenToBase for a signal of nDims dimensions.  Values of
+    // 2D signals are taken from the channel of the called base in seq.
+    void FlattenSignalToBase(const std::vector<uint16_t> &signal, int nDims, DSLength i,
+                             const int *basToPlsIndex, const Nucleotide *seq, DNALength length,
+                             uint16_t *dest) const;
+
+private:
+    uint8_t channel_[256];
+};
+
+template <typename T>
+const T *PulseBlock::ReadPulses(const std::vector<T> &column, DSLength i, int nValues) const
+{
+    return column.data() + readOffsets[i] * nValues;
+}
+
+template <typename T>
+void PulseBlock::FlattenToBase(const std::vector<T> &column, DSLength i, const int *basToPlsIndex,
+                               DNALength length, T *dest) const
+{
+    const T *pulses = ReadPulses(column, i);
+    for (DNALength b = 0; b < length; b++) {
+        dest[b] = pulses[basToPlsIndex[b]];
+    }
+}
+
+#endif
@@ -9,7 +9,8 @@
 
 RegionTable& RegionTable::Reset()
 {
-    map_.clear();
+    zmws_.clear();
+    index_.Clear();
     columnNames.clear();
     regionTypes.clear();
     regionDescriptions.clear();
@@ -36,25 +37,28 @@ RegionTable& RegionTable::ConstructTable(std::vector<RegionAnnotation>& table,
     // Must sort region annotations by HoleNumber, RegionTypeIndex, Start, End, and Score
     std::sort(table.begin(), table.end(), compare_region_annotation_by_type);
 
-    // Construct map_<holeNumber, RegionAnnotations>
+    // Construct zmws_, one RegionAnnotations per hole number, and index them.
+    zmws_.clear();
+    std::vector<UInt> holeNumbers;
     if (table.size() > 0) {
         UInt pre_hn = table[0].GetHoleNumber();
         auto itBegin = table.begin();
         for (auto it = table.begin(); it != table.end(); it++) {
             // Discrepency between data type of Regions/HoleNumber and ZMW/HoleNumber
             if (it->GetHoleNumber() > static_cast<int>(pre_hn)) {
-                map_.insert(std::pair<UInt, RegionAnnotations>(
-                    pre_hn, RegionAnnotations(pre_hn, std::vector<RegionAnnotation>(itBegin, it),
-                                              regionTypeEnums)));
+                zmws_.push_back(RegionAnnotations(
+                    pre_hn, std::vector<RegionAnnotation>(itBegin, it), regionTypeEnums));
+                holeNumbers.push_back(pre_hn);
                 pre_hn = it->GetHoleNumber();
                 itBegin = it;
             }
         }
 
-        map_.insert(std::pair<UInt, RegionAnnotations>(
-            pre_hn, RegionAnnotations(pre_hn, std::vector<RegionAnnotation>(itBegin, table.end()),
-                                      regionTypeEnums)));
+        zmws_.push_back(RegionAnnotations(
+            pre_hn, std::vector<RegionAnnotation>(itBegin, table.end()), regionTypeEnums));
+        holeNumbers.push_back(pre_hn);
     }
+    index_.Build(holeNumbers);
     return *this;
 }
 
@@ -96,12 +100,18 @@ RegionTable& RegionTable::RegionSources(const std::vector<std::string>& in)
 
 bool RegionTable::HasHoleNumber(const UInt holeNumber) const
 {
-    return (map_.find(holeNumber) != map_.end());
+    size_t position;
+    return index_.Find(holeNumber, position);
 }
 
-RegionAnnotations RegionTable::operator[](const UInt holeNumber) const
+const RegionAnnotations& RegionTable::operator[](const UInt holeNumber) const
 {
     // Must check whether a zmw exists or not first.
-    assert(HasHoleNumber(holeNumber) && "Could not find zmw in region table.");
-    return map_.find(holeNumber)->second;
+    size_t position = 0;
+    bool found = index_.Find(holeNumber, position);
+    assert(found && "Could not find zmw in region table.");
+    (void)(found);
+    return zmws_[position];
 }
+
+size_t RegionTable::NumZMWs(void) const { return zmws_.size(); }
@@ -14,6 +14,7 @@
 #include <pbdata/Enumerations.h>
 #include <pbdata/PacBioDefs.h>
 #include <pbdata/Types.h>
+#include <pbdata/reads/HoleNumberIndex.hpp>
 #include <pbdata/reads/RegionAnnotation.hpp>
 #include <pbdata/reads/RegionAnnotations.hpp>
 
@@ -23,8 +24,10 @@ private:
     /// RegionTable reading from h5 file 'Regions' dataset.
     /// \name member variables
     /// \{
-    /// Map zmw hole number to zmw RegionAnnotations.
-    std::map<UInt, RegionAnnotations> map_;
+    /// RegionAnnotations of zmws, by hole number.
+    std::vector<RegionAnnotations> zmws_;
+    /// Map zmw hole number to its RegionAnnotations in zmws_.
+    HoleNumberIndex index_;
     /// \}
 
     /// \name Region table attributes.
@@ -72,7 +75,7 @@ public:
     /// \returns region sources.
     std::vector<std::string> RegionSources(void) const;
 
-    /// Construct map_ (holeNumber --> RegionAnnotations) from table.
+    /// Construct zmws_ and index_ (holeNumber --> RegionAnnotations) from table.
     /// \params[in] region table containing region annotations of all zmws
     /// \params[in] ordered region type strings, which maps region types
     ///             to region type indice.
@@ -99,12 +102,16 @@ public:
     /// \name Assessor functions to zmw region annotations.
     /// \{
     /// \returns Whether or not this region table has regions of a zmw.
+    /// Lookups by hole number take constant time.
     bool HasHoleNumber(const UInt holeNumber) const;
 
     /// Get zmw region annotaions given its hole number.
     /// Note that HasHoleNumber must be called first.
     /// \returns RegionAnnotations of a zmw.
-    RegionAnnotations operator[](const UInt holeNumber) const;
+    const RegionAnnotations& operator[](const UInt holeNumber) const;
+
+    /// \returns number of zmws with region annotations.
+    size_t NumZMWs(void) const;
     /// \}
 };
 
@@ -0,0 +1,57 @@
+#include <pbdata/saf/AlnWindowIndex.hpp>
+
+#include <algorithm>
+
+AlnWindowIndex::AlnWindowIndex() : isBuilt_(false) {}
+
+void AlnWindowIndex::Build(AlnInfo &alnInfo)
+{
+    Clear();
+    for (size_t i = 0; i < alnInfo.alignments.size(); i++) {
+        CmpAlignment &alignment = alnInfo.alignments[i];
+        Entry entry;
+        entry.tStart = alignment.GetRefStart();
+        entry.tEnd = alignment.GetRefEnd();
+        entry.maxTEnd = 0;
+        entry.alignmentIndex = static_cast<UInt>(i);
+        refGroups_[alignment.GetRefGroupId()].push_back(entry);
+    }
+
+    for (auto &refGroup : refGroups_) {
+        std::vector<Entry> &entries = refGroup.second;
+        // Alignments of a sorted cmp.h5 are already in order.
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const Entry &a, const Entry &b) { return a.tStart < b.tStart; });
+        UInt maxTEnd = 0;
+        for (Entry &entry : entries) {
+            maxTEnd = std::max(maxTEnd, entry.tEnd);
+            entry.maxTEnd = maxTEnd;
+        }
+    }
+    isBuilt_ = true;
+}
+
+void AlnWindowIndex::Clear()
+{
+    refGroups_.clear();
+    isBuilt_ = false;
+}
+
+bool AlnWindowIndex::IsBuilt() const { return isBuilt_; }
+
+void AlnWindowIndex::Find(UInt refGroupId, UInt tStart, UInt tEnd,
+                          std::vector<UInt> &alignmentIndices) const
+{
+    auto refGroup = refGroups_.find(refGroupId);
+    if (refGroup == refGroups_.end() or tStart >= tEnd) return;
+    const std::vector<Entry> &entries = refGroup->second;
+
+    // Entries before first and from last on cannot overlap the window.
+    auto first = std::partition_point(entries.begin(), entries.end(),
+                                      [tStart](const Entry &e) { return e.maxTEnd <= tStart; });
+    auto last = std::partition_point(first, entries.end(),
+                                     [tEnd](const Entry &e) { return e.tStart < tEnd; });
+    for (auto it = first; it != last; ++it) {
+        if (it->tEnd > tStart) alignmentIndices.push_back(it->alignmentIndex);
+    }
+}
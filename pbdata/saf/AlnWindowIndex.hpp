@@ -0,0 +1,45 @@
+#ifndef _BLASR_ALN_WINDOW_INDEX_HPP_
+#define _BLASR_ALN_WINDOW_INDEX_HPP_
+
+#include <map>
+#include <vector>
+
+#include <pbdata/Types.h>
+#include <pbdata/saf/AlnInfo.hpp>
+
+//
+// Index of the alignments in /AlnInfo by reference window.  Alignments
+// of each reference group are sorted by tStart, along with the running
+// maximum of tEnd, so the alignments overlapping a window are found by
+// two binary searches and a scan of the candidates between them.
+//
+class AlnWindowIndex
+{
+public:
+    AlnWindowIndex();
+
+    // Index all alignments of alnInfo, which need not be sorted.
+    void Build(AlnInfo &alnInfo);
+
+    void Clear();
+
+    bool IsBuilt() const;
+
+    // Append to alignmentIndices the indices in alnInfo.alignments of
+    // alignments of refGroupId overlapping [tStart, tEnd), by tStart.
+    void Find(UInt refGroupId, UInt tStart, UInt tEnd, std::vector<UInt> &alignmentIndices) const;
+
+private:
+    struct Entry
+    {
+        UInt tStart;
+        UInt tEnd;
+        // Maximum tEnd of this and all previous entries.
+        UInt maxTEnd;
+        UInt alignmentIndex;
+    };
+    std::map<UInt, std::vector<Entry> > refGroups_;
+    bool isBuilt_;
+};
+
+#endif
@@ -0,0 +1,18 @@
+#include <pbdata/utils/MemoryUtils.hpp>
+
+#include <sys/resource.h>
+
+size_t GetPeakResidentMemory()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // Bytes on macOS.
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // Kilobytes on Linux.
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
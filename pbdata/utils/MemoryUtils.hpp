@@ -0,0 +1,9 @@
+#ifndef _BLASR_MEMORY_UTILS_HPP_
+#define _BLASR_MEMORY_UTILS_HPP_
+
+#include <cstddef>
+
+// Peak resident set size of this process in bytes, 0 if unknown.
+size_t GetPeakResidentMemory();
+
+#endif
@@ -0,0 +1,127 @@
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/alignment/GraphPaper.hpp>
+#include <alignment/algorithms/alignment/sdp/SDPFragment.hpp>
+
+namespace {
+Fragment MakeFragment(DNALength x, DNALength y, unsigned int length)
+{
+    Fragment f(x, y);
+    f.length = length;
+    return f;
+}
+}  // namespace
+
+TEST(GraphPaperTest, GetIndex)
+{
+    EXPECT_EQ(GetIndex(0, 0, 100, 50), 0);
+    EXPECT_EQ(GetIndex(1, 0, 100, 50), 0);
+    EXPECT_EQ(GetIndex(2, 0, 100, 50), 1);
+    EXPECT_EQ(GetIndex(99, 0, 100, 50), 49);
+    EXPECT_EQ(GetIndex(4000000000u, 0, 4000000001u, 50), 49);
+}
+
+TEST(GraphPaperTest, SparseKeepsThePathAndDropsRepeats)
+{
+    // An alignment along a slightly drifting diagonal, and a repeat
+    // that is off of it.
+    std::vector<Fragment> points;
+    for (DNALength x = 0; x < 200000; x += 20) {
+        points.push_back(MakeFragment(x, x + x / 50, 11));
+    }
+    size_t nPath = points.size();
+    for (DNALength x = 50000; x < 60000; x += 100) {
+        points.push_back(MakeFragment(x, x + 100000, 11));
+    }
+    std::vector<bool> onOptPath;
+    int nOpt = SparseGraphPaper(points, onOptPath);
+    ASSERT_EQ(onOptPath.size(), points.size());
+    EXPECT_EQ(nOpt, static_cast<int>(nPath));
+    for (size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(onOptPath[i], i < nPath);
+    }
+    RemoveOffOpt(points, onOptPath);
+    EXPECT_EQ(points.size(), nPath);
+}
+
+TEST(GraphPaperTest, SparseKeepsPointsNearTheBandAcrossGaps)
+{
+    // Two parts of the path with a gap with no points between them, and
+    // a point off the path beside the gap.
+    std::vector<Fragment> points;
+    for (DNALength x = 0; x < 10000; x += 10) {
+        points.push_back(MakeFragment(x, x, 11));
+        points.push_back(MakeFragment(x + 20000, x + 25000, 11));
+    }
+    points.push_back(MakeFragment(15000, 12000, 11));
+    points.push_back(MakeFragment(2000, 28000, 11));
+    std::vector<bool> onOptPath;
+    int nOpt = SparseGraphPaper(points, onOptPath);
+    EXPECT_EQ(nOpt, static_cast<int>(points.size()) - 1);
+    // The point in the gap is chained across it and kept; the one far
+    // from the path is not.
+    EXPECT_TRUE(onOptPath[points.size() - 2]);
+    EXPECT_FALSE(onOptPath[points.size() - 1]);
+}
+
+TEST(GraphPaperTest, SparseDropsPointsOffTheDiagonalOfAGap)
+{
+    // Points beside the ends of a gap, within the columns that the gap
+    // spans but far from the diagonal across it.  Neither can be chained
+    // with both parts of the path.
+    std::vector<Fragment> points;
+    for (DNALength x = 0; x < 10000; x += 10) {
+        points.push_back(MakeFragment(x, x, 11));
+        points.push_back(MakeFragment(x + 20000, x + 25000, 11));
+    }
+    size_t nPath = points.size();
+    points.push_back(MakeFragment(20600, 15000, 11));
+    points.push_back(MakeFragment(9400, 22000, 11));
+    std::vector<bool> onOptPath;
+    int nOpt = SparseGraphPaper(points, onOptPath);
+    EXPECT_EQ(nOpt, static_cast<int>(nPath));
+    EXPECT_FALSE(onOptPath[nPath]);
+    EXPECT_FALSE(onOptPath[nPath + 1]);
+}
+
+TEST(GraphPaperTest, SparseMatchesDenseOnPath)
+{
+    srand(1);
+    std::vector<Fragment> points;
+    for (int i = 0; i < 20000; i++) {
+        DNALength x = rand() % 100000;
+        if (i % 4 == 0) {
+            points.push_back(MakeFragment(x, rand() % 100000, 11));
+        } else {
+            points.push_back(MakeFragment(x, x + rand() % 20, 11));
+        }
+    }
+    std::vector<bool> sparse, dense;
+    SparseGraphPaper(points, sparse);
+    FlatMatrix2D<int> bins, scoreMat;
+    FlatMatrix2D<Arrow> pathMat;
+    GraphPaper(points, 50, 50, bins, scoreMat, pathMat, dense);
+    // Every point on the diagonal is kept by both, and the sparse filter
+    // keeps no more points than the dense one.
+    size_t nSparse = 0, nDense = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (i % 4 != 0) {
+            EXPECT_TRUE(sparse[i]);
+            EXPECT_TRUE(dense[i]);
+        }
+        nSparse += sparse[i];
+        nDense += dense[i];
+    }
+    EXPECT_LE(nSparse, nDense);
+}
+
+TEST(GraphPaperTest, SparseEmpty)
+{
+    std::vector<Fragment> points;
+    std::vector<bool> onOptPath;
+    EXPECT_EQ(SparseGraphPaper(points, onOptPath), 0);
+    EXPECT_TRUE(onOptPath.empty());
+}
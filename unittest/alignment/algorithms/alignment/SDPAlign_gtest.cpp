@@ -0,0 +1,69 @@
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/alignment/AlignmentUtils.hpp>
+#include <alignment/algorithms/alignment/DistanceMatrixScoreFunction.hpp>
+#include <alignment/algorithms/alignment/ScoreMatrices.hpp>
+#include <alignment/datastructures/alignment/Alignment.hpp>
+
+#include <pbdata/testsequences.h>
+#include <alignment/algorithms/alignment/SDPAlign.hpp>
+#include <alignment/utils/WorkerPool.hpp>
+
+namespace {
+// A read of the reference with about 5% substitutions, 4% insertions and
+// 3% deletions.
+std::string SimulateRead(const std::string &reference, unsigned int seed)
+{
+    const char bases[] = "ACGT";
+    std::string read;
+    for (size_t i = 0; i < reference.size(); i++) {
+        seed = seed * 1103515245 + 12345;
+        unsigned int r = (seed >> 16) % 100;
+        if (r < 5) {
+            read += bases[(seed >> 8) & 3];
+        } else if (r < 9) {
+            read += reference[i];
+            read += bases[(seed >> 4) & 3];
+        } else if (r >= 12) {
+            read += reference[i];
+        }
+    }
+    return read;
+}
+}  // namespace
+
+TEST(SDPAlignTest, RefineThreadsGiveTheSameAlignment)
+{
+    std::string referenceStr = RandomSequence(20000, 3);
+    std::string readStr = SimulateRead(referenceStr, 9);
+    DNASequence reference, read;
+    ToDNASequence(referenceStr, reference);
+    ToDNASequence(readStr, read);
+    DistanceMatrixScoreFunction<DNASequence, DNASequence> scoreFn(SMRTDistanceMatrix, 3, 3);
+
+    // Both small gaps, aligned by Smith-Waterman, and large gaps, aligned
+    // by recursive SDP, are refined.
+    for (DNALength noRecurseUnder : {10000u, 200u}) {
+        blasr::Alignment serial;
+        int serialScore = SDPAlign(read, reference, scoreFn, 11, 5, 5, 0.3, serial, Global, true,
+                                   true, noRecurseUnder, true, 100000);
+        ASSERT_GT(serial.blocks.size(), 1u);
+        for (unsigned int nThreads : {1u, 2u, 4u}) {
+            WorkerPool pool(nThreads);
+            blasr::Alignment parallel;
+            int parallelScore = SDPAlign(read, reference, scoreFn, 11, 5, 5, 0.3, parallel, Global,
+                                         true, true, noRecurseUnder, true, 100000, &pool);
+            EXPECT_EQ(parallelScore, serialScore);
+            ASSERT_EQ(parallel.blocks.size(), serial.blocks.size());
+            for (size_t b = 0; b < serial.blocks.size(); b++) {
+                EXPECT_EQ(parallel.blocks[b].qPos, serial.blocks[b].qPos);
+                EXPECT_EQ(parallel.blocks[b].tPos, serial.blocks[b].tPos);
+                EXPECT_EQ(parallel.blocks[b].length, serial.blocks[b].length);
+            }
+        }
+    }
+    reference.seq = NULL;
+    read.seq = NULL;
+}
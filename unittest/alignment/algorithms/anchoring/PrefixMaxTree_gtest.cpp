@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/anchoring/PrefixMaxTree.hpp>
+
+TEST(PrefixMaxTreeTest, PrefixMaximum)
+{
+    PrefixMaxTree tree;
+    tree.Reset(10);
+    double value;
+    VectorIndex index;
+    EXPECT_FALSE(tree.Query(10, value, index));
+    tree.Update(3, 5.0, 30);
+    tree.Update(7, 8.0, 70);
+    tree.Update(0, 1.0, 0);
+    EXPECT_FALSE(tree.Query(0, value, index));
+    ASSERT_TRUE(tree.Query(3, value, index));
+    EXPECT_EQ(index, 0u);
+    ASSERT_TRUE(tree.Query(4, value, index));
+    EXPECT_EQ(index, 30u);
+    ASSERT_TRUE(tree.Query(10, value, index));
+    EXPECT_EQ(value, 8.0);
+    EXPECT_EQ(index, 70u);
+}
+
+TEST(PrefixMaxTreeTest, TiesGoToTheGreaterIndex)
+{
+    PrefixMaxTree tree;
+    tree.Reset(4);
+    tree.Update(2, 5.0, 20);
+    tree.Update(0, 5.0, 10);
+    tree.Update(1, 5.0, 30);
+    double value;
+    VectorIndex index;
+    ASSERT_TRUE(tree.Query(1, value, index));
+    EXPECT_EQ(index, 10u);
+    ASSERT_TRUE(tree.Query(4, value, index));
+    EXPECT_EQ(value, 5.0);
+    EXPECT_EQ(index, 30u);
+
+    // Reset clears all values.
+    tree.Reset(4);
+    EXPECT_FALSE(tree.Query(4, value, index));
+}
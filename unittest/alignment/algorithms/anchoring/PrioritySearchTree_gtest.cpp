@@ -0,0 +1,81 @@
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/anchoring/BasicEndpoint.hpp>
+#include <alignment/algorithms/anchoring/GlobalChain.hpp>
+#include <alignment/algorithms/anchoring/PrioritySearchTree.hpp>
+#include <alignment/datastructures/anchoring/MatchPos.hpp>
+
+namespace {
+class TestPoint
+{
+public:
+    KeyType key;
+    int score;
+    TestPoint(KeyType _key, int _score) : key(_key), score(_score) {}
+    KeyType GetKey() { return key; }
+    int GetScore() { return score; }
+};
+}  // namespace
+
+TEST(PrioritySearchTreeTest, MatchesScan)
+{
+    srand(3);
+    PrioritySearchTree<TestPoint> pst;
+    for (int trial = 0; trial < 20; trial++) {
+        // Points in no particular order of key, with repeated keys.
+        std::vector<TestPoint> points;
+        int nPoints = 1 + rand() % 300;
+        for (int i = 0; i < nPoints; i++) {
+            points.push_back(TestPoint(rand() % 200, rand() % 1000));
+        }
+        pst.CreateTree(points);
+
+        int index;
+        EXPECT_EQ(pst.FindIndexOfMaxPoint(points, 1000, index), 0);
+        std::vector<bool> active(nPoints, false);
+        for (int i = 0; i < nPoints; i++) {
+            int activate = (i * 7) % nPoints;
+            if (not active[activate]) {
+                pst.Activate(points, activate);
+                active[activate] = true;
+            }
+            KeyType maxKey = rand() % 210;
+            int expected = -1;
+            for (int p = 0; p < nPoints; p++) {
+                if (active[p] and points[p].key < maxKey and
+                    (expected == -1 or points[p].score >= points[expected].score)) {
+                    expected = p;
+                }
+            }
+            int found = pst.FindIndexOfMaxPoint(points, maxKey, index);
+            ASSERT_EQ(found, expected != -1);
+            if (found) {
+                EXPECT_EQ(index, expected);
+            }
+        }
+
+        int pointIndex;
+        ASSERT_EQ(pst.FindPoint(points, points[0].key, pointIndex), 1);
+        EXPECT_EQ(points[pointIndex].key, points[0].key);
+        EXPECT_EQ(pst.FindPoint(points, 500, pointIndex), 0);
+    }
+}
+
+TEST(PrioritySearchTreeTest, GlobalChain)
+{
+    // A colinear chain with a better scoring decoy off the chain.
+    std::vector<ChainedMatchPos> fragments;
+    fragments.push_back(ChainedMatchPos(100, 0, 20, 1));
+    fragments.push_back(ChainedMatchPos(130, 30, 20, 1));
+    fragments.push_back(ChainedMatchPos(140, 200, 40, 1));
+    fragments.push_back(ChainedMatchPos(160, 60, 20, 1));
+    fragments.push_back(ChainedMatchPos(190, 90, 20, 1));
+    std::vector<VectorIndex> chain;
+    int chainLength =
+        GlobalChain<ChainedMatchPos, BasicEndpoint<ChainedMatchPos> >(fragments, chain);
+    ASSERT_EQ(chainLength, 4);
+    EXPECT_EQ(chain, std::vector<VectorIndex>({0, 1, 3, 4}));
+}
@@ -0,0 +1,282 @@
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/anchoring/FindMaxInterval.hpp>
+#include <alignment/algorithms/anchoring/SparseChain.hpp>
+#include <alignment/datastructures/anchoring/AnchorList.hpp>
+#include <alignment/datastructures/anchoring/MatchPos.hpp>
+
+namespace {
+// Contigs start every contigLength bases.
+class TestBoundary
+{
+public:
+    DNALength contigLength;
+    TestBoundary(DNALength _contigLength = 1000000) : contigLength(_contigLength) {}
+    DNALength operator()(DNALength pos) { return pos - pos % contigLength; }
+    DNALength Length(DNALength) { return contigLength; }
+    int GetIndex(DNALength pos) { return pos / contigLength; }
+    int GetStartPos(int index) { return index * contigLength; }
+};
+
+class TestPValue
+{
+public:
+    float ComputePValue(std::vector<ChainedMatchPos> &lis, int &nBases, int &nAnchors)
+    {
+        nBases = 0;
+        for (size_t i = 0; i < lis.size(); i++) {
+            nBases += lis[i].l;
+        }
+        nAnchors = lis.size();
+        return -nBases;
+    }
+};
+
+class TestWeight
+{
+public:
+    MatchWeight operator()(std::vector<ChainedMatchPos> &lis) { return lis.size(); }
+};
+
+// Anchors of length 20 every 50 bases of the read, on the diagonal
+// t = q + offset, with an insertion in the read every 500 bases.
+void AddChain(std::vector<ChainedMatchPos> &pos, DNALength offset, DNALength qLength)
+{
+    for (DNALength q = 0; q + 20 <= qLength; q += 50) {
+        pos.push_back(ChainedMatchPos(offset + q - q / 500, q, 20, 1));
+    }
+}
+
+// Best chain by trying every previous anchor.
+std::vector<VectorIndex> ExhaustiveBestChain(std::vector<ChainedMatchPos> &pos,
+                                             const SparseChainParameters &params)
+{
+    std::vector<VectorIndex> order;
+    for (VectorIndex i = 0; i < pos.size(); i++) {
+        order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&pos](VectorIndex a, VectorIndex b) {
+        return pos[a].t < pos[b].t or (pos[a].t == pos[b].t and pos[a].q < pos[b].q);
+    });
+    std::vector<double> score(pos.size());
+    std::vector<VectorIndex> prev(pos.size(), PrefixMaxTree::NoIndex);
+    VectorIndex best = order[0];
+    for (VectorIndex j : order) {
+        double bestScore = 0;
+        for (VectorIndex i : order) {
+            if (pos[i].t + pos[i].l > pos[j].t or pos[i].q + pos[i].l > pos[j].q or
+                pos[j].t - (pos[i].t + pos[i].l) > params.maxGap or
+                pos[j].q - (pos[i].q + pos[i].l) > params.maxGap) {
+                continue;
+            }
+            double s = score[i] - SparseChainGapCost(pos, i, j, params.gapCost);
+            if (s > bestScore) {
+                bestScore = s;
+                prev[j] = i;
+            }
+        }
+        score[j] = pos[j].l + bestScore;
+        if (score[j] > score[best]) {
+            best = j;
+        }
+    }
+    std::vector<VectorIndex> chain;
+    for (VectorIndex i = best; i != PrefixMaxTree::NoIndex; i = prev[i]) {
+        chain.insert(chain.begin(), i);
+    }
+    return chain;
+}
+
+double ChainScore(std::vector<ChainedMatchPos> &pos, const std::vector<VectorIndex> &chain,
+                  const SparseChainParameters &params)
+{
+    double score = 0;
+    for (size_t i = 0; i < chain.size(); i++) {
+        score += pos[chain[i]].l;
+        if (i > 0) {
+            score -= SparseChainGapCost(pos, chain[i - 1], chain[i], params.gapCost);
+        }
+    }
+    return score;
+}
+
+// A chain of about 40-80 anchors among nRandom random anchors.
+void AddChainAndRandomAnchors(std::vector<ChainedMatchPos> &pos, int nRandom)
+{
+    AddChain(pos, rand() % 10000, 2000 + rand() % 2000);
+    for (int i = 0; i < nRandom; i++) {
+        pos.push_back(ChainedMatchPos(rand() % 15000, rand() % 4000, 10 + rand() % 20, 1));
+    }
+}
+}  // namespace
+
+TEST(SparseChainTest, SeparatesChains)
+{
+    std::vector<ChainedMatchPos> pos;
+    AddChain(pos, 100000, 5000);
+    size_t nTrue = pos.size();
+    AddChain(pos, 300000, 1000);
+    // Scattered repeat anchors.
+    srand(1);
+    for (int i = 0; i < 200; i++) {
+        pos.push_back(ChainedMatchPos(rand() % 900000, rand() % 5000, 15, 10));
+    }
+
+    TestBoundary boundary;
+    SparseChainParameters params;
+    std::vector<std::vector<VectorIndex> > chains;
+    EXPECT_EQ(SparseChain(pos, boundary, params, chains), static_cast<int>(nTrue));
+    ASSERT_GE(chains.size(), 2u);
+    ASSERT_EQ(chains[0].size(), nTrue);
+    for (size_t i = 0; i < nTrue; i++) {
+        EXPECT_EQ(chains[0][i], i);
+    }
+    ASSERT_EQ(chains[1].size(), 20u);
+    EXPECT_EQ(chains[1][0], nTrue);
+
+    // Every anchor is in one chain.
+    size_t nChained = 0;
+    for (size_t c = 0; c < chains.size(); c++) {
+        nChained += chains[c].size();
+    }
+    EXPECT_EQ(nChained, pos.size());
+}
+
+TEST(SparseChainTest, DoesNotSpanContigs)
+{
+    std::vector<ChainedMatchPos> pos;
+    AddChain(pos, 999000, 2000);
+    TestBoundary boundary;
+    SparseChainParameters params;
+    std::vector<std::vector<VectorIndex> > chains;
+    SparseChain(pos, boundary, params, chains);
+    ASSERT_EQ(chains.size(), 2u);
+    for (size_t c = 0; c < chains.size(); c++) {
+        DNALength contig = boundary(pos[chains[c].front()].t);
+        EXPECT_EQ(boundary(pos[chains[c].back()].t), contig);
+    }
+}
+
+TEST(SparseChainTest, MatchesExhaustiveChaining)
+{
+    // Default parameters.
+    srand(2);
+    for (int trial = 0; trial < 20; trial++) {
+        std::vector<ChainedMatchPos> pos;
+        AddChainAndRandomAnchors(pos, 400);
+        TestBoundary boundary;
+        SparseChainParameters params;
+        std::vector<std::vector<VectorIndex> > chains;
+        SparseChain(pos, boundary, params, chains);
+        ASSERT_FALSE(chains.empty());
+        EXPECT_EQ(chains[0], ExhaustiveBestChain(pos, params));
+    }
+}
+
+TEST(SparseChainTest, NearlyMatchesExhaustiveChaining)
+{
+    // With dense anchors and a short maxGap, the best previous anchor may
+    // be missed, but not by much.
+    srand(11);
+    for (int trial = 0; trial < 20; trial++) {
+        std::vector<ChainedMatchPos> pos;
+        AddChainAndRandomAnchors(pos, 1000);
+        TestBoundary boundary;
+        SparseChainParameters params;
+        params.maxGap = 1000;
+        std::vector<std::vector<VectorIndex> > chains;
+        SparseChain(pos, boundary, params, chains);
+        ASSERT_FALSE(chains.empty());
+        EXPECT_GE(ChainScore(pos, chains[0], params),
+                  0.99 * ChainScore(pos, ExhaustiveBestChain(pos, params), params));
+    }
+
+    // With every preceding anchor looked back at, chaining is exact.
+    srand(4);
+    for (int trial = 0; trial < 5; trial++) {
+        std::vector<ChainedMatchPos> pos;
+        AddChainAndRandomAnchors(pos, 1000);
+        TestBoundary boundary;
+        SparseChainParameters params;
+        params.maxGap = 1000;
+        params.maxLookback = pos.size();
+        std::vector<std::vector<VectorIndex> > chains;
+        SparseChain(pos, boundary, params, chains);
+        ASSERT_FALSE(chains.empty());
+        EXPECT_EQ(chains[0], ExhaustiveBestChain(pos, params));
+    }
+}
+
+TEST(SparseChainTest, FindMaxIncreasingInterval)
+{
+    std::vector<ChainedMatchPos> pos;
+    AddChain(pos, 100000, 5000);
+    AddChain(pos, 300000, 1000);
+    std::sort(pos.begin(), pos.end(),
+              [](const ChainedMatchPos &a, const ChainedMatchPos &b) { return a.t < b.t; });
+
+    TestBoundary boundary;
+    TestPValue pValue;
+    TestWeight weight;
+    IntervalSearchParameters params;
+    params.sparseChain = true;
+    params.maxPValue = -100;
+    WeightedIntervalSet intervals(10);
+    ClusterList clusterList;
+    VarianceAccumulator<float> accumPValue, accumWeight, accumNumAnchorBases;
+    DNASequence reference, read;
+    int maxChain = FindMaxIncreasingInterval(
+        0, pos, 6000, 10, boundary, pValue, weight, intervals, reference, read, params,
+        (std::vector<BasicEndpoint<ChainedMatchPos> > *)NULL, clusterList, accumPValue, accumWeight,
+        accumNumAnchorBases);
+    EXPECT_EQ(maxChain, 100);
+    ASSERT_EQ(intervals.size(), 2u);
+    EXPECT_EQ(intervals.begin()->start, 100000u);
+    EXPECT_EQ(intervals.begin()->qStart, 0u);
+    EXPECT_EQ(intervals.begin()->nAnchors, 100);
+}
+
+TEST(SparseChainTest, ChainsAnAnchorList)
+{
+    std::vector<ChainedMatchPos> pos;
+    AddChain(pos, 300000, 1000);
+    AddChain(pos, 100000, 5000);
+    srand(6);
+    for (int i = 0; i < 200; i++) {
+        pos.push_back(ChainedMatchPos(rand() % 900000, rand() % 5000, 15, 10));
+    }
+    // Anchors need not be sorted.
+    AnchorList anchors;
+    anchors.StoreMatchPosList(pos);
+
+    TestBoundary boundary;
+    TestPValue pValue;
+    TestWeight weight;
+    IntervalSearchParameters params;
+    params.maxPValue = -100;
+    WeightedIntervalSet intervals(10), anchorListIntervals(10);
+    ClusterList clusterList;
+    VarianceAccumulator<float> accumPValue, accumWeight;
+    DNASequence reference, read;
+    int maxChain = SparseChainFindMaxIncreasingInterval(0, pos, 6000, 10, boundary, pValue, weight,
+                                                        intervals, reference, read, params,
+                                                        clusterList, accumPValue, accumWeight);
+    EXPECT_EQ(SparseChainFindMaxIncreasingInterval(0, anchors, 6000, 10, boundary, pValue, weight,
+                                                   anchorListIntervals, reference, read, params,
+                                                   clusterList, accumPValue, accumWeight),
+              maxChain);
+    EXPECT_EQ(maxChain, 100);
+    ASSERT_EQ(anchorListIntervals.size(), intervals.size());
+    WeightedIntervalSet::iterator it = intervals.begin();
+    WeightedIntervalSet::iterator anchorListIt = anchorListIntervals.begin();
+    for (; it != intervals.end(); ++it, ++anchorListIt) {
+        EXPECT_EQ(anchorListIt->start, it->start);
+        EXPECT_EQ(anchorListIt->end, it->end);
+        EXPECT_EQ(anchorListIt->qStart, it->qStart);
+        EXPECT_EQ(anchorListIt->nAnchors, it->nAnchors);
+    }
+}
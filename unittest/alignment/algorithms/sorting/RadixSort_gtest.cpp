@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/alignment/sdp/FragmentSort.hpp>
+#include <alignment/algorithms/alignment/sdp/SDPFragment.hpp>
+#include <alignment/algorithms/sorting/RadixSort.hpp>
+
+namespace {
+std::vector<uint64_t> RandomKeys(size_t n, unsigned int seed)
+{
+    srand(seed);
+    std::vector<uint64_t> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        // Coordinates in the high word, few distinct values in the low.
+        keys[i] = (static_cast<uint64_t>(rand()) << 32) | (rand() % 500);
+    }
+    return keys;
+}
+}  // namespace
+
+TEST(RadixSortTest, Sort)
+{
+    RadixSort sorter;
+    for (size_t n : {0, 1, 100, 5000, 100000}) {
+        std::vector<uint64_t> keys = RandomKeys(n, n), expected = keys;
+        std::sort(expected.begin(), expected.end());
+        sorter.Sort(keys);
+        EXPECT_EQ(keys, expected);
+    }
+}
+
+TEST(RadixSortTest, SortWithOrderIsStable)
+{
+    RadixSort sorter;
+    for (size_t n : {100, 5000}) {
+        std::vector<uint64_t> keys = RandomKeys(n, 3);
+        for (size_t i = 0; i < n; i++) {
+            keys[i] &= 0xffff00000000ULL;
+        }
+        std::vector<uint64_t> original = keys;
+        std::vector<uint32_t> order;
+        sorter.SortWithOrder(keys, order);
+        ASSERT_EQ(order.size(), n);
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(keys[i], original[order[i]]);
+            if (i > 0) {
+                EXPECT_LE(keys[i - 1], keys[i]);
+                if (keys[i - 1] == keys[i]) {
+                    EXPECT_LT(order[i - 1], order[i]);
+                }
+            }
+        }
+    }
+}
+
+TEST(RadixSortTest, Fragments)
+{
+    srand(7);
+    std::vector<Fragment> fragments;
+    for (int i = 0; i < 3000; i++) {
+        Fragment f(rand() % 50, rand() % 50);
+        f.length = 8 + rand() % 3;
+        fragments.push_back(f);
+    }
+    std::vector<Fragment> expected = fragments;
+    std::stable_sort(expected.begin(), expected.end(), LexicographicFragmentSortByY<Fragment>());
+    std::vector<Fragment> sorted = fragments;
+    std::vector<uint32_t> order;
+    SortFragmentsByYX(sorted, order);
+    for (size_t i = 0; i < sorted.size(); i++) {
+        EXPECT_EQ(sorted[i].x, expected[i].x);
+        EXPECT_EQ(sorted[i].y, expected[i].y);
+        EXPECT_EQ(sorted[i].length, expected[i].length);
+        EXPECT_EQ(sorted[i].x, fragments[order[i]].x);
+    }
+
+    std::stable_sort(expected.begin(), expected.end(), LexicographicFragmentSort<Fragment>());
+    SortFragmentsByXY(sorted);
+    for (size_t i = 0; i < sorted.size(); i++) {
+        EXPECT_EQ(sorted[i].x, expected[i].x);
+        EXPECT_EQ(sorted[i].y, expected[i].y);
+        EXPECT_EQ(sorted[i].length, expected[i].length);
+    }
+}
+
+TEST(RadixSortTest, ReleaseLargeBuffers)
+{
+    std::vector<uint64_t> small(100), large(RadixSort::MaxKeptBufferBytes / sizeof(uint64_t) + 1);
+    ReleaseLargeBuffer(small);
+    ReleaseLargeBuffer(large);
+    EXPECT_EQ(small.size(), 100);
+    EXPECT_EQ(large.capacity(), 0);
+
+    // A sorter still sorts after its buffers are freed.
+    RadixSort sorter;
+    std::vector<uint64_t> keys = RandomKeys(1000000, 5), expected = keys;
+    std::sort(expected.begin(), expected.end());
+    std::vector<uint32_t> order;
+    sorter.SortWithOrder(keys, order);
+    sorter.ReleaseLargeBuffers();
+    keys = RandomKeys(1000000, 5);
+    sorter.SortWithOrder(keys, order);
+    EXPECT_EQ(keys, expected);
+}
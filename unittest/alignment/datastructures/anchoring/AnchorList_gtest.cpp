@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/alignment/AlignmentUtils.hpp>
+#include <alignment/datastructures/alignment/Alignment.hpp>
+
+#include <pbdata/testsequences.h>
+#include <alignment/algorithms/anchoring/MapBySuffixArray.hpp>
+#include <alignment/datastructures/anchoring/AnchorList.hpp>
+#include <alignment/datastructures/anchoring/MatchPos.hpp>
+#include <alignment/suffixarray/SuffixArrayTypes.hpp>
+#include <pbdata/DNASequence.hpp>
+
+TEST(AnchorListTest, SortByTargetAndQuery)
+{
+    srand(5);
+    std::vector<ChainedMatchPos> matchPosList;
+    for (int i = 0; i < 5000; i++) {
+        // Few distinct q, and t over the full range, so there are ties
+        // and bytes that are the same in every key.
+        matchPosList.push_back(ChainedMatchPos((rand() % 100) * 50000000u, rand() % 300, i, i % 7));
+    }
+    AnchorList anchors;
+    anchors.StoreMatchPosList(matchPosList);
+    ASSERT_EQ(anchors.size(), matchPosList.size());
+    anchors.SortByTargetAndQuery();
+
+    std::stable_sort(matchPosList.begin(), matchPosList.end(), CompareMatchPos<ChainedMatchPos>());
+    std::vector<ChainedMatchPos> sorted;
+    anchors.GetMatchPosList(sorted);
+    ASSERT_EQ(sorted.size(), matchPosList.size());
+    for (size_t i = 0; i < sorted.size(); i++) {
+        EXPECT_EQ(sorted[i].t, matchPosList[i].t);
+        EXPECT_EQ(sorted[i].q, matchPosList[i].q);
+        // Ties keep their order.
+        EXPECT_EQ(sorted[i].l, matchPosList[i].l);
+        EXPECT_EQ(sorted[i].m, matchPosList[i].m);
+    }
+}
+
+TEST(AnchorListTest, SortSortedAndEmpty)
+{
+    AnchorList anchors;
+    anchors.SortByTargetAndQuery();
+    EXPECT_TRUE(anchors.empty());
+
+    anchors.push_back(7, 1, 20, 1);
+    anchors.push_back(7, 1, 30, 2);
+    anchors.push_back(7, 1, 40, 3);
+    anchors.SortByTargetAndQuery();
+    EXPECT_EQ(anchors.l, std::vector<DNALength>({20, 30, 40}));
+
+    anchors.push_back(3, 9, 50, 4);
+    anchors.SortByTargetAndQuery();
+    EXPECT_EQ(anchors.t, std::vector<DNALength>({3, 7, 7, 7}));
+    EXPECT_EQ(anchors.l, std::vector<DNALength>({50, 20, 30, 40}));
+    EXPECT_EQ(anchors.m, std::vector<int>({4, 1, 2, 3}));
+    anchors.clear();
+    EXPECT_EQ(anchors.size(), 0u);
+}
+
+TEST(AnchorListTest, MapReadToGenomeMatchesMatchPosList)
+{
+    // A genome with a repeated unit, so some anchors have multiplicity
+    // above one.
+    std::string unit = RandomSequence(300, 21);
+    std::string genome = RandomSequence(4000, 23) + unit + RandomSequence(2000, 25) + unit +
+                         RandomSequence(4000, 27);
+    DNASequence reference;
+    ToDNASequence(genome, reference);
+    DNASuffixArray sa;
+    std::vector<int> alphabet;
+    sa.InitAsciiCharDNAAlphabet(alphabet);
+    sa.LarssonBuildSuffixArray(reference.seq, reference.length, alphabet);
+
+    std::string readStr = genome.substr(3500, 3000);
+    TestRead read(readStr);
+
+    AnchorParameters params;
+    params.useLookupTable = false;
+    params.minMatchLength = 12;
+    std::vector<ChainedMatchPos> matchPosList;
+    AnchorList anchors;
+    int nMatchPos = MapReadToGenome(reference, sa, read, 12, matchPosList, params);
+    int nAnchors = MapReadToGenome(reference, sa, read, 12, anchors, params);
+
+    EXPECT_EQ(nAnchors, nMatchPos);
+    ASSERT_GT(matchPosList.size(), 0u);
+    ASSERT_EQ(anchors.size(), matchPosList.size());
+    for (size_t i = 0; i < matchPosList.size(); i++) {
+        EXPECT_EQ(anchors.t[i], matchPosList[i].t);
+        EXPECT_EQ(anchors.q[i], matchPosList[i].q);
+        EXPECT_EQ(anchors.l[i], matchPosList[i].l);
+        EXPECT_EQ(anchors.m[i], matchPosList[i].m);
+    }
+    EXPECT_GT(*std::max_element(anchors.m.begin(), anchors.m.end()), 1);
+    reference.seq = NULL;
+    read.seq = NULL;
+}
@@ -0,0 +1,98 @@
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/datastructures/anchoring/WeightedInterval.hpp>
+
+namespace {
+// The multiset the set used to be, as a reference.
+class ReferenceSet : public std::multiset<WeightedInterval, CompareWeightedIntervalByPValue>
+{
+public:
+    size_t maxSize;
+    ReferenceSet(size_t maxSizeP) : maxSize(maxSizeP) {}
+    void Insert(WeightedInterval intv)
+    {
+        bool isContained = false;
+        iterator it = begin();
+        while (it != end() and isContained == false) {
+            if (intv.qStart >= it->qStart and intv.qEnd <= it->qEnd and intv.start >= it->start and
+                intv.end <= it->end and intv.readIndex == it->readIndex and
+                intv.pValue >= it->pValue) {
+                isContained = true;
+            } else if (it->start >= intv.start and it->end <= intv.end and
+                       it->qStart >= intv.qStart and it->qEnd <= intv.qEnd and
+                       it->readIndex == intv.readIndex and it->pValue >= intv.pValue) {
+                it = erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (size() >= maxSize and maxSize > 0 and std::prev(end())->pValue < intv.pValue) {
+            return;
+        }
+        if (isContained == false) {
+            if (size() == 0 or size() < maxSize or std::prev(end())->pValue > intv.pValue) {
+                if (maxSize != 0 and size() >= maxSize) {
+                    erase(std::prev(end()));
+                }
+                std::multiset<WeightedInterval, CompareWeightedIntervalByPValue>::insert(intv);
+            }
+        }
+    }
+};
+}  // namespace
+
+TEST(WeightedIntervalSetTest, MatchesMultiset)
+{
+    srand(11);
+    for (size_t maxSize : {0, 1, 3, 10}) {
+        WeightedIntervalSet intervals(maxSize);
+        ReferenceSet reference(maxSize);
+        for (int i = 0; i < 2000; i++) {
+            int start = rand() % 1000, q = rand() % 100;
+            // Few distinct p-values, so there are ties.
+            WeightedInterval intv(10, start, start + rand() % 200, rand() % 2, -(rand() % 20), q,
+                                  q + rand() % 50);
+            intv.matches.resize(rand() % 5);
+            intervals.insert(intv);
+            reference.Insert(intv);
+            ASSERT_EQ(intervals.size(), reference.size());
+            WeightedIntervalSet::iterator it = intervals.begin();
+            for (ReferenceSet::iterator ref = reference.begin(); ref != reference.end();
+                 ++ref, ++it) {
+                EXPECT_EQ(it->pValue, ref->pValue);
+                EXPECT_EQ(it->start, ref->start);
+                EXPECT_EQ(it->end, ref->end);
+                EXPECT_EQ(it->qStart, ref->qStart);
+                EXPECT_EQ(it->matches.size(), ref->matches.size());
+            }
+        }
+    }
+}
+
+TEST(WeightedIntervalSetTest, EraseAndClear)
+{
+    WeightedIntervalSet intervals(10);
+    for (int i = 0; i < 5; i++) {
+        WeightedInterval intv(10, i * 1000, i * 1000 + 100, 0, -i, 0, 100);
+        EXPECT_TRUE(intervals.insert(intv));
+        EXPECT_FALSE(intv.isOverlapping);
+    }
+    ASSERT_EQ(intervals.size(), 5u);
+    EXPECT_EQ(intervals.begin()->pValue, -4);
+    EXPECT_EQ(intervals.rbegin()->pValue, 0);
+
+    // A worse interval inside another is not added.
+    WeightedInterval contained(10, 1010, 1090, 0, 0, 10, 90);
+    EXPECT_FALSE(intervals.insert(contained));
+    EXPECT_TRUE(contained.isOverlapping);
+
+    intervals.erase(intervals.begin() + 2, intervals.end());
+    EXPECT_EQ(intervals.size(), 2u);
+    intervals.clear();
+    EXPECT_TRUE(intervals.empty());
+}
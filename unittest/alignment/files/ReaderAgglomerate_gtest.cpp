@@ -226,3 +226,108 @@ TEST_F(ReaderAgglomerateTest, ReadByZmwFromXmlNoFilter)
 
     reader->Close();
 }
+
+TEST_F(ReaderAgglomerateTest, ReadFromXmlWithBamDecodeThreads)
+{
+    std::string fn(xmlFile1);
+
+    std::vector<std::string> expected;
+    reader->SetReadFileName(fn);
+    EXPECT_EQ(reader->Initialize(), 1);
+    SMRTSequence seq;
+    while (reader->GetNext(seq)) {
+        expected.push_back(seq.GetTitle() + seq.ToString(0) + seq.ReadGroupId());
+    }
+    reader->Close();
+
+    // Parallel decoding must honor the filter and preserve file order.
+    std::vector<std::string> observed;
+    ReaderAgglomerate parallelReader;
+    parallelReader.SetReadFileName(fn);
+    parallelReader.SetBamDecodeThreads(4);
+    EXPECT_EQ(parallelReader.Initialize(), 1);
+    while (parallelReader.GetNext(seq)) {
+        observed.push_back(seq.GetTitle() + seq.ToString(0) + seq.ReadGroupId());
+    }
+    parallelReader.Close();
+
+    EXPECT_EQ(observed.size(), 150u);
+    EXPECT_EQ(observed, expected);
+}
+
+TEST_F(ReaderAgglomerateTest, ReadFromBamWithLazyQVs)
+{
+    std::string fn(bamFile1);
+    reader->SetReadFileName(fn);
+    EXPECT_EQ(reader->Initialize(), 1);
+
+    ReaderAgglomerate lazyReader;
+    lazyReader.SetReadFileName(fn);
+    lazyReader.SetLazyBamQVs(true);
+    EXPECT_EQ(lazyReader.Initialize(), 1);
+
+    SMRTSequence seq, lazySeq;
+    const std::vector<std::string> qvNames({"InsertionQV", "DeletionQV", "SubstitutionQV",
+                                            "MergeQV", "SubstitutionTag", "DeletionTag"});
+    while (reader->GetNext(seq)) {
+        EXPECT_EQ(lazyReader.GetNext(lazySeq), 1);
+        EXPECT_EQ(lazySeq.ToString(0), seq.ToString(0));
+        EXPECT_EQ(lazySeq.ReadGroupId(), seq.ReadGroupId());
+        EXPECT_TRUE(lazySeq.insertionQV.Empty());
+        EXPECT_EQ(lazySeq.DeferredQVs(), FASTQTracks);
+
+        // QV accessors, also those of FASTQSequence, decode each
+        // deferred track on its first access.
+        const FASTQSequence& lazyFastq = lazySeq;
+        if (seq.length > 0) {
+            EXPECT_EQ(lazyFastq.GetInsertionQV(0), seq.GetInsertionQV(0));
+            EXPECT_EQ(lazySeq.DeferredQVs(), FASTQTracks & ~InsertionQV);
+        }
+        for (DNALength i = 0; i < seq.length; i++) {
+            EXPECT_EQ(lazyFastq.GetInsertionQV(i), seq.GetInsertionQV(i));
+            EXPECT_EQ(lazySeq.GetDeletionQV(i), seq.GetDeletionQV(i));
+            EXPECT_EQ(lazySeq.GetSubstitutionQV(i), seq.GetSubstitutionQV(i));
+            EXPECT_EQ(lazySeq.GetMergeQV(i), seq.GetMergeQV(i));
+            EXPECT_EQ(lazySeq.GetDeletionTag(i), seq.GetDeletionTag(i));
+            EXPECT_EQ(lazySeq.GetSubstitutionTag(i), seq.GetSubstitutionTag(i));
+        }
+        EXPECT_EQ(lazySeq.DeferredQVs(), QualityValueTrack);
+        lazySeq.LoadQVs(QualityValueTrack);
+        EXPECT_EQ(lazySeq.qual.ToString(), seq.qual.ToString());
+        for (const std::string& qvName : qvNames) {
+            std::string qvs, lazyQVs;
+            EXPECT_EQ(lazySeq.GetQVs(qvName, lazyQVs), seq.GetQVs(qvName, qvs));
+            EXPECT_EQ(lazyQVs, qvs);
+        }
+
+        // Reverse complement and substring copies of lazy reads carry
+        // QVs of the right strand and offset.
+        SMRTSequence lazyForRC, rc, expectedRC;
+        lazyForRC.LazyCopy(lazySeq.bamRecord);
+        lazyForRC.MakeRC(rc);
+        seq.MakeRC(expectedRC);
+        for (const std::string& qvName : qvNames) {
+            std::string qvs, rcQVs;
+            EXPECT_EQ(rc.GetQVs(qvName, rcQVs), expectedRC.GetQVs(qvName, qvs));
+            EXPECT_EQ(rcQVs, qvs);
+        }
+
+        if (seq.length > 1) {
+            SMRTSequence lazyForCopy, suffix;
+            lazyForCopy.LazyCopy(lazySeq.bamRecord);
+            suffix.Copy(lazyForCopy, 1, seq.length - 1);
+            EXPECT_EQ(suffix.DeferredQVs(), 0);
+            for (const std::string& qvName : qvNames) {
+                std::string qvs, suffixQVs;
+                if (seq.GetQVs(qvName, qvs)) {
+                    EXPECT_TRUE(suffix.GetQVs(qvName, suffixQVs));
+                    EXPECT_EQ(suffixQVs, qvs.substr(1));
+                }
+            }
+        }
+    }
+    EXPECT_EQ(lazyReader.GetNext(lazySeq), 0);
+
+    lazyReader.Close();
+    reader->Close();
+}
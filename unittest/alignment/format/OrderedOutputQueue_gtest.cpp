@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/format/OrderedOutputQueue.hpp>
+
+// Producer t puts batches t, t + nThreads, ... with batch i holding i % 3
+// records, so that batches arrive out of order and some are empty.
+static void PutBatches(OrderedOutputQueue<std::string> &queue, const int nBatches,
+                       const int nThreads)
+{
+    std::vector<std::thread> producers;
+    for (int t = 0; t < nThreads; t++) {
+        producers.emplace_back([&queue, nBatches, nThreads, t] {
+            for (int i = t; i < nBatches; i += nThreads) {
+                std::vector<std::string> records;
+                for (int j = 0; j < i % 3; j++) {
+                    records.push_back(std::to_string(i) + "." + std::to_string(j));
+                }
+                queue.Put(i, records);
+                EXPECT_TRUE(records.empty());
+            }
+        });
+    }
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+}
+
+static std::vector<std::string> ExpectedRecords(const int nBatches)
+{
+    std::vector<std::string> expected;
+    for (int i = 0; i < nBatches; i++) {
+        for (int j = 0; j < i % 3; j++) {
+            expected.push_back(std::to_string(i) + "." + std::to_string(j));
+        }
+    }
+    return expected;
+}
+
+TEST(OrderedOutputQueueTest, Ordered)
+{
+    std::vector<std::string> written;
+    OrderedOutputQueue<std::string> queue(
+        [&written](std::string &record) { written.push_back(record); }, 4);
+    PutBatches(queue, 1000, 4);
+    queue.Close();
+
+    EXPECT_EQ(ExpectedRecords(1000), written);
+    const OrderedOutputStats stats = queue.Stats();
+    EXPECT_EQ(stats.batches, 1000u);
+    EXPECT_EQ(stats.records, written.size());
+    EXPECT_LE(stats.maxPending, 4u + 4u);
+}
+
+TEST(OrderedOutputQueueTest, Unordered)
+{
+    std::vector<std::string> written;
+    OrderedOutputQueue<std::string> queue(
+        [&written](std::string &record) { written.push_back(record); }, 2, false);
+    PutBatches(queue, 500, 3);
+    queue.Close();
+
+    std::vector<std::string> expected = ExpectedRecords(500);
+    std::sort(expected.begin(), expected.end());
+    std::sort(written.begin(), written.end());
+    EXPECT_EQ(expected, written);
+}
+
+TEST(OrderedOutputQueueTest, EmitterError)
+{
+    OrderedOutputQueue<std::string> queue(
+        [](std::string &) { throw std::runtime_error("disk full"); });
+    std::vector<std::string> records(1, "r");
+    queue.Put(0, records);
+    EXPECT_THROW(queue.Close(), std::runtime_error);
+}
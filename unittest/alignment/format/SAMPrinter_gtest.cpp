@@ -106,3 +106,28 @@ TEST(SAMPrinterTest, MergeAdjacentIndels)
     opChar = std::vector<char>({'I', '='});
     EXPECT_EQ(merge_indels(opSize, opChar), "1I10=");
 }
+
+TEST(SAMPrinterTest, AppendInteger)
+{
+    std::string out = "x";
+    for (const int64_t value : {0, 7, 10, 99, 100, 12345, -1, -100, 2147483647}) {
+        AppendInteger(out, value);
+        out.push_back(',');
+    }
+    AppendInteger(out, INT64_MIN);
+    EXPECT_EQ(out, "x0,7,10,99,100,12345,-1,-100,2147483647,-9223372036854775808");
+}
+
+TEST(SAMPrinterTest, CigarOpsToString)
+{
+    std::vector<int> opSize({5, 1, 120, 1000, 3});
+    std::vector<char> opChar({'S', 'I', 'M', 'D', 'H'});
+    std::string cigarString = "stale";
+    CigarOpsToString(opSize, opChar, cigarString);
+    EXPECT_EQ(cigarString, "5S1I120M1000D3H");
+
+    opSize.clear();
+    opChar.clear();
+    CigarOpsToString(opSize, opChar, cigarString);
+    EXPECT_EQ(cigarString, "");
+}
@@ -0,0 +1,62 @@
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <alignment/query/PbiFilterZmwGroupQuery.h>
+#include <alignment/query/PbiShardQuery.h>
+#include <alignment/query/PbiShardZmwGroupQuery.h>
+#include <pbdata/testdata.h>
+
+using namespace PacBio;
+using namespace PacBio::BAM;
+
+static const std::string testChunking = xmlFile1;
+static const std::string testNoFilter = xmlFile2;
+
+// Shards read back to back must return the same zmws as an unsharded query.
+static void TestShardsCoverAllZmws(const std::string& fn, const size_t numShards)
+{
+    EXPECT_NO_THROW({
+        const DataSet dataset(fn);
+        std::vector<std::string> expected;
+        PbiFilterZmwGroupQuery qQuery(dataset);
+        for (const std::vector<BamRecord>& records : qQuery) {
+            for (const BamRecord& record : records) {
+                expected.push_back(record.FullName());
+            }
+        }
+
+        std::vector<std::string> names;
+        std::vector<std::string> singleNames;
+        for (size_t shardIndex = 0; shardIndex < numShards; shardIndex++) {
+            PbiShardZmwGroupQuery shardQuery(dataset, shardIndex, numShards);
+            for (const std::vector<BamRecord>& records : shardQuery) {
+                EXPECT_GT(records.size(), 0u);
+                for (const BamRecord& record : records) {
+                    EXPECT_EQ(records[0].HoleNumber(), record.HoleNumber());
+                    names.push_back(record.FullName());
+                }
+            }
+            PbiShardQuery singleQuery(dataset, shardIndex, numShards);
+            for (const BamRecord& record : singleQuery) {
+                singleNames.push_back(record.FullName());
+            }
+        }
+        EXPECT_EQ(expected, names);
+        EXPECT_EQ(expected, singleNames);
+    });
+}
+
+TEST(PbiShardZmwGroupQueryTest, OneShard) { TestShardsCoverAllZmws(testChunking, 1); }
+
+TEST(PbiShardZmwGroupQueryTest, ShardsWithFilter)
+{
+    TestShardsCoverAllZmws(testChunking, 2);
+    TestShardsCoverAllZmws(testChunking, 7);
+}
+
+TEST(PbiShardZmwGroupQueryTest, ShardsNoFilter)
+{
+    TestShardsCoverAllZmws(testNoFilter, 3);
+    TestShardsCoverAllZmws(testNoFilter, 200);
+}
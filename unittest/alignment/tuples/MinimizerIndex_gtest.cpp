@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <pbdata/testsequences.h>
+#include <alignment/algorithms/anchoring/MapByMinimizers.hpp>
+#include <alignment/tuples/MinimizerIndex.hpp>
+#include <pbdata/DNASequence.hpp>
+#include <pbdata/FASTASequence.hpp>
+#include <pbdata/metagenome/SequenceIndexDatabase.hpp>
+
+TEST(MinimizerIndexTest, EveryWindowHasAMinimizer)
+{
+    const DNALength nPos = 2000;
+    std::string seq = RandomSequence(5000, 3);
+    seq[nPos] = 'N';
+    TupleMetrics tm;
+    tm.tupleSize = 15;
+    const DNALength tupleSize = tm.tupleSize;
+    const int w = 10;
+    std::vector<DNALength> positions;
+    ForEachMinimizer(Seq(seq), seq.size(), tm, w,
+                     [&](DNALength pos, TupleData) { positions.push_back(pos); });
+
+    ASSERT_FALSE(positions.empty());
+    for (size_t i = 1; i < positions.size(); i++) {
+        EXPECT_LT(positions[i - 1], positions[i]);
+        // Consecutive minimizers are at most w apart, apart from the N.
+        if (positions[i] < nPos - tupleSize or positions[i - 1] > nPos) {
+            EXPECT_LE(positions[i] - positions[i - 1], static_cast<DNALength>(w));
+        }
+        EXPECT_FALSE(positions[i] <= nPos and positions[i] + tupleSize > nPos);
+    }
+    // Roughly 2/(w+1) of the positions are sampled.
+    EXPECT_LT(positions.size(), seq.size() / 3);
+}
+
+TEST(MinimizerIndexTest, WriteAndRead)
+{
+    std::string seq = RandomSequence(20000, 7);
+    MinimizerIndex index;
+    index.Build(Seq(seq), seq.size(), 15, 10);
+    ASSERT_GT(index.size(), 0u);
+    index.Write("minimizers.idx");
+
+    MinimizerIndex mapped;
+    mapped.Read("minimizers.idx");
+    EXPECT_EQ(mapped.TupleSize(), 15);
+    EXPECT_EQ(mapped.WindowSize(), 10);
+    EXPECT_EQ(mapped.NumMinimizers(), index.NumMinimizers());
+    EXPECT_EQ(mapped.size(), index.size());
+
+    TupleMetrics tm;
+    tm.tupleSize = 15;
+    size_t nFound = 0;
+    ForEachMinimizer(Seq(seq), seq.size(), tm, 10, [&](DNALength pos, TupleData hash) {
+        const DNALength *begin, *end, *mappedBegin, *mappedEnd;
+        index.FindAll(hash, begin, end);
+        mapped.FindAll(hash, mappedBegin, mappedEnd);
+        ASSERT_EQ(std::vector<DNALength>(begin, end),
+                  std::vector<DNALength>(mappedBegin, mappedEnd));
+        EXPECT_NE(std::find(begin, end, pos), end);
+        nFound++;
+    });
+    EXPECT_EQ(nFound, index.size());
+    mapped.Free();
+    std::remove("minimizers.idx");
+}
+
+TEST(MinimizerIndexTest, ContigsOfSequenceIndexDatabase)
+{
+    // Two contigs separated by an N, as in a concatenated reference.
+    std::string first = RandomSequence(300, 11);
+    std::string second = RandomSequence(300, 13);
+    std::string reference = first + "N" + second + "N";
+    DNALength seqStartPos[] = {0, 301, 602};
+    SequenceIndexDatabase<FASTASequence> seqDB;
+    seqDB.nSeqPos = 3;
+    seqDB.seqStartPos = seqStartPos;
+
+    MinimizerIndex index;
+    index.Build(Seq(reference), reference.size(), seqDB, 12, 5);
+
+    // The second contig is indexed at its position in the reference.
+    TupleMetrics tm;
+    tm.tupleSize = 12;
+    ForEachMinimizer(Seq(second), second.size(), tm, 5, [&](DNALength pos, TupleData hash) {
+        const DNALength *begin, *end;
+        index.FindAll(hash, begin, end);
+        EXPECT_NE(std::find(begin, end, pos + 301), end);
+    });
+    seqDB.seqStartPos = NULL;
+}
+
+TEST(MinimizerIndexTest, MapReadToGenome)
+{
+    std::string genome = RandomSequence(50000, 17);
+    MinimizerIndex index;
+    index.Build(Seq(genome), genome.size(), 15, 10);
+    DNASequence reference;
+    ToDNASequence(genome, reference);
+
+    // A read from genome[10000, 12000) with a substitution at 1000.
+    std::string readStr = genome.substr(10000, 2000);
+    readStr[1000] = (readStr[1000] == 'A') ? 'C' : 'A';
+    TestRead read(readStr);
+
+    AnchorParameters params;
+    params.minMatchLength = 12;
+    params.maxAnchorsPerPosition = 10;
+    std::vector<ChainedMatchPos> matches;
+    MapReadToGenome(reference, index, read, matches, params);
+
+    ASSERT_FALSE(matches.empty());
+    DNALength nAnchored = 0;
+    for (size_t i = 0; i < matches.size(); i++) {
+        const ChainedMatchPos &m = matches[i];
+        ASSERT_LE(m.q + m.l, read.length);
+        // Every match is exact.
+        EXPECT_EQ(genome.substr(m.t, m.l), readStr.substr(m.q, m.l));
+        if (m.t == m.q + 10000) {
+            nAnchored += m.l;
+        }
+        if (i > 0) {
+            EXPECT_LE(matches[i - 1].q, m.q);
+        }
+    }
+    // Matches are extended up to the substitution, so nearly the whole
+    // read is covered by a few matches on the true diagonal.
+    EXPECT_GT(nAnchored, 1900u);
+    EXPECT_LT(matches.size(), 10u);
+    matches.clear();
+    params.maxAnchorsPerPosition = 0;
+    EXPECT_EQ(MapReadToGenome(reference, index, read, matches, params), 0);
+    reference.seq = NULL;
+    read.seq = NULL;
+}
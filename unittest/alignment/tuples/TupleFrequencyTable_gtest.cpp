@@ -0,0 +1,119 @@
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/algorithms/alignment/AlignmentUtils.hpp>
+#include <alignment/datastructures/alignment/Alignment.hpp>
+
+#include <pbdata/testsequences.h>
+#include <alignment/algorithms/anchoring/MapBySuffixArray.hpp>
+#include <alignment/suffixarray/SuffixArrayTypes.hpp>
+#include <alignment/tuples/TupleFrequencyTable.hpp>
+#include <alignment/tuples/TuplePositionIndex.hpp>
+#include <pbdata/DNASequence.hpp>
+
+TEST(TupleFrequencyTableTest, CountsSaturate)
+{
+    // 300 copies of a 10 base unit, so its tuples saturate, then unique
+    // sequence with an N.
+    std::string seq;
+    for (int i = 0; i < 300; i++) {
+        seq += "ACGTTGCAAC";
+    }
+    seq += RandomSequence(2000, 3);
+    seq[3500] = 'N';
+
+    TupleFrequencyTable table;
+    table.Build(Seq(seq), seq.size(), 8);
+    EXPECT_EQ(table.TupleSize(), 8);
+
+    TupleMetrics tm;
+    tm.tupleSize = 8;
+    std::map<TupleData, int> counts;
+    ForEachTupleRL(Seq(seq), seq.size(), tm, [&](DNALength, TupleData tuple) { counts[tuple]++; });
+    for (std::map<TupleData, int>::iterator it = counts.begin(); it != counts.end(); ++it) {
+        EXPECT_EQ(table.Count(it->first), std::min(it->second, 255));
+    }
+
+    std::vector<uint8_t> seqCounts;
+    table.CountTuples(Seq(seq), seq.size(), seqCounts);
+    ASSERT_EQ(seqCounts.size(), seq.size());
+    EXPECT_EQ(seqCounts[0], TupleFrequencyTable::MaxCount);
+    // No tuple spans the N or runs past the end.
+    EXPECT_EQ(seqCounts[3500 - 7], 0);
+    EXPECT_EQ(seqCounts[3500], 0);
+    EXPECT_GT(seqCounts[3501], 0);
+    EXPECT_EQ(seqCounts[seq.size() - 7], 0);
+}
+
+TEST(TupleFrequencyTableTest, WriteAndRead)
+{
+    std::string seq = RandomSequence(5000, 7);
+    TupleFrequencyTable table;
+    table.Build(Seq(seq), seq.size(), 6);
+    table.Write("tuplefrequencies.tfq");
+
+    TupleFrequencyTable mapped;
+    mapped.Read("tuplefrequencies.tfq");
+    EXPECT_EQ(mapped.TupleSize(), 6);
+    for (TupleData tuple = 0; tuple < (1 << 12); tuple++) {
+        ASSERT_EQ(mapped.Count(tuple), table.Count(tuple));
+    }
+    mapped.Free();
+    std::remove("tuplefrequencies.tfq");
+}
+
+TEST(TupleFrequencyTableTest, SkipsRepeatSeeds)
+{
+    // Unique sequence around 50 copies of a 200 base satellite.
+    std::string unit = RandomSequence(200, 11);
+    std::string genome = RandomSequence(5000, 13);
+    for (int i = 0; i < 50; i++) {
+        genome += unit;
+    }
+    genome += RandomSequence(5000, 17);
+    DNASequence reference;
+    ToDNASequence(genome, reference);
+    DNASuffixArray sa;
+    std::vector<int> alphabet;
+    sa.InitAsciiCharDNAAlphabet(alphabet);
+    sa.LarssonBuildSuffixArray(reference.seq, reference.length, alphabet);
+
+    // A read from the end of the unique sequence into the satellite.
+    std::string readStr = genome.substr(4000, 3000);
+    TestRead read(readStr);
+    TupleFrequencyTable table;
+    table.Build(reference.seq, reference.length, 12);
+
+    AnchorParameters params;
+    params.useLookupTable = false;
+    params.minMatchLength = 12;
+    std::vector<ChainedMatchPos> all, unique, sampled;
+    MapReadToGenome(reference, sa, read, 12, all, params);
+    params.tupleFrequencies = &table;
+    params.maxSeedFrequency = 10;
+    MapReadToGenome(reference, sa, read, 12, unique, params);
+    params.repeatSeedStride = 20;
+    MapReadToGenome(reference, sa, read, 12, sampled, params);
+
+    // The unique part of the read is anchored the same way with the
+    // table, and the satellite is not anchored, or only sparsely.
+    size_t nAllUnique = 0, nSampledRepeat = 0;
+    for (size_t i = 0; i < all.size(); i++) {
+        nAllUnique += (all[i].q < 1000);
+    }
+    for (size_t i = 0; i < unique.size(); i++) {
+        EXPECT_LT(unique[i].q, 1000u);
+    }
+    EXPECT_EQ(unique.size(), nAllUnique);
+    for (size_t i = 0; i < sampled.size(); i++) {
+        nSampledRepeat += (sampled[i].q >= 1000);
+    }
+    EXPECT_GT(nSampledRepeat, 0u);
+    EXPECT_LT(sampled.size(), all.size() / 10);
+    reference.seq = NULL;
+    read.seq = NULL;
+}
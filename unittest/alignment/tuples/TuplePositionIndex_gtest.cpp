@@ -0,0 +1,94 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <pbdata/testsequences.h>
+#include <alignment/algorithms/alignment/sdp/SDPFragment.hpp>
+#include <alignment/tuples/DNATuple.hpp>
+#include <alignment/tuples/TupleList.hpp>
+#include <alignment/tuples/TupleMatching.hpp>
+#include <alignment/tuples/TuplePositionIndex.hpp>
+#include <pbdata/DNASequence.hpp>
+
+namespace {
+// Matches of query tuples in target, in order of query then target position.
+template <typename T_TupleList>
+std::vector<Fragment> Matches(DNASequence &query, DNASequence &target, int tupleSize)
+{
+    TupleMetrics tm;
+    tm.Initialize(tupleSize);
+    T_TupleList targetTuples;
+    SequenceToTupleList(target, tm, targetTuples);
+    targetTuples.Sort();
+    std::vector<Fragment> matches;
+    StoreMatchingPositions(query, tm, targetTuples, matches);
+    return matches;
+}
+
+void ExpectSameMatches(const std::vector<Fragment> &expected, const std::vector<Fragment> &observed)
+{
+    ASSERT_EQ(expected.size(), observed.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].x, observed[i].x);
+        EXPECT_EQ(expected[i].y, observed[i].y);
+    }
+}
+}  // namespace
+
+TEST(TuplePositionIndexTest, FindAll)
+{
+    std::string str = "ACGTACGTNNACGTAC";
+    DNASequence seq;
+    ToDNASequence(str, seq);
+    TupleMetrics tm;
+    tm.Initialize(4);
+    TuplePositionIndex index;
+    index.Build(seq, tm);
+    // 5 tuples before the Ns and 3 after.
+    EXPECT_EQ(index.size(), 8);
+
+    PositionDNATuple tuple;
+    tuple.FromStringRL(seq.seq, tm);
+    const DNALength *begin, *end;
+    index.FindAll(tuple.tuple, begin, end);
+    EXPECT_EQ(std::vector<DNALength>(begin, end), std::vector<DNALength>({0, 4, 10}));
+
+    tuple.FromStringRL(&seq.seq[2], tm);  // GTAC
+    index.FindAll(tuple.tuple, begin, end);
+    EXPECT_EQ(std::vector<DNALength>(begin, end), std::vector<DNALength>({2, 12}));
+
+    std::string absent = "GGGG";
+    tuple.FromStringRL(reinterpret_cast<Nucleotide *>(&absent[0]), tm);
+    index.FindAll(tuple.tuple, begin, end);
+    EXPECT_EQ(begin, end);
+
+    index.clear();
+    EXPECT_EQ(index.size(), 0);
+    index.FindAll(tuple.tuple, begin, end);
+    EXPECT_EQ(begin, end);
+}
+
+TEST(TuplePositionIndexTest, SameMatchesAsTupleList)
+{
+    // Small tuples are directly addressed and large ones are hashed.
+    for (int tupleSize : {5, 11}) {
+        std::string target = RandomSequence(5000, 7);
+        std::string query = target.substr(1000, 2000);
+        // Repeats and Ns in both.
+        target.replace(100, 300, target.substr(2000, 300));
+        target[2500] = 'N';
+        query[10] = 'N';
+        DNASequence targetSeq, querySeq;
+        ToDNASequence(target, targetSeq);
+        ToDNASequence(query, querySeq);
+
+        std::vector<Fragment> expected =
+            Matches<TupleList<PositionDNATuple> >(querySeq, targetSeq, tupleSize);
+        std::vector<Fragment> observed =
+            Matches<TuplePositionIndex>(querySeq, targetSeq, tupleSize);
+        EXPECT_GT(expected.size(), query.size() / 2);
+        ExpectSameMatches(expected, observed);
+    }
+}
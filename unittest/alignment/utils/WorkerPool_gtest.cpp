@@ -0,0 +1,37 @@
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <alignment/utils/WorkerPool.hpp>
+
+TEST(WorkerPoolTest, RunsEveryIterationOnce)
+{
+    WorkerPool pool(4);
+    EXPECT_EQ(pool.NumThreads(), 4u);
+    // The pool is reused across loops, short and long.
+    for (unsigned int n : {0u, 1u, 3u, 1000u, 7u}) {
+        std::vector<std::atomic<int> > counts(n);
+        std::atomic<bool> validThread(true);
+        pool.ParallelFor(n, [&](unsigned int i, unsigned int threadIndex) {
+            counts[i]++;
+            if (threadIndex >= pool.NumThreads()) validThread = false;
+        });
+        for (unsigned int i = 0; i < n; i++) {
+            EXPECT_EQ(counts[i], 1);
+        }
+        EXPECT_TRUE(validThread);
+    }
+}
+
+TEST(WorkerPoolTest, OneThreadRunsOnTheCaller)
+{
+    WorkerPool pool(1);
+    EXPECT_EQ(pool.NumThreads(), 1u);
+    std::vector<unsigned int> order;
+    pool.ParallelFor(5, [&](unsigned int i, unsigned int threadIndex) {
+        EXPECT_EQ(threadIndex, 0u);
+        order.push_back(i);
+    });
+    EXPECT_EQ(order, std::vector<unsigned int>({0, 1, 2, 3, 4}));
+}
@@ -0,0 +1,50 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <hdf/DatasetCollection.hpp>
+
+class DatasetCollectionTest : public ::testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        collection.fieldNames = {"Basecall", "QualityValue", "DeletionQV", "WidthInFrames"};
+        collection.InitializeAllFields(true);
+    }
+
+    DatasetCollection collection;
+};
+
+TEST_F(DatasetCollectionTest, IncludeOnlyFields)
+{
+    std::vector<std::string> fields = {"QualityValue", "Basecall"};
+    ASSERT_EQ(collection.IncludeOnlyFields(fields), 1);
+    EXPECT_TRUE(collection.FieldIsIncluded("Basecall"));
+    EXPECT_TRUE(collection.FieldIsIncluded("QualityValue"));
+    EXPECT_FALSE(collection.FieldIsIncluded("DeletionQV"));
+    EXPECT_FALSE(collection.FieldIsIncluded("WidthInFrames"));
+    EXPECT_EQ(collection.GetIncludedFieldNames(),
+              std::vector<std::string>({"Basecall", "QualityValue"}));
+
+    // Unknown fields leave the projection unchanged.
+    std::vector<std::string> unknown = {"DeletionQV", "NoSuchField"};
+    EXPECT_EQ(collection.IncludeOnlyFields(unknown), 0);
+    EXPECT_FALSE(collection.FieldIsIncluded("DeletionQV"));
+    EXPECT_TRUE(collection.FieldIsIncluded("Basecall"));
+}
+
+TEST_F(DatasetCollectionTest, MemoryReport)
+{
+    EXPECT_EQ(collection.peakBufferBytes, 0);
+    collection.RecordBufferBytes(1000);
+    collection.RecordBufferBytes(10);
+    EXPECT_EQ(collection.peakBufferBytes, 1000);
+
+    std::stringstream report;
+    collection.PrintMemoryReport(report);
+    EXPECT_NE(report.str().find("Peak buffered bytes: 1000"), std::string::npos);
+    EXPECT_NE(report.str().find("Peak resident memory: "), std::string::npos);
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <hdf/BufferedHDFArray.hpp>
+#include <hdf/HDFArray.hpp>
+#include <hdf/HDFFile.hpp>
+
+TEST(HDFArrayTest, ReadAhead)
+{
+    std::vector<int> values(100);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<int>(i * 3);
+    }
+    HDFFile file;
+    file.Open("hdfarray_readahead.h5", H5F_ACC_TRUNC);
+    {
+        BufferedHDFArray<int> writer;
+        ASSERT_EQ(writer.Initialize(file.rootGroup, "Values"), 1);
+        writer.Write(&values[0], values.size());
+        writer.Flush();
+        writer.Close();
+    }
+
+    HDFArray<int> reader;
+    ASSERT_EQ(reader.Initialize(file.rootGroup, "Values"), 1);
+    reader.SetReadAheadSize(16);
+    std::vector<int> read(values.size());
+    for (size_t i = 0; i < values.size(); i += 7) {
+        size_t end = std::min(i + 7, values.size());
+        reader.Read(i, end, &read[i]);
+    }
+    EXPECT_EQ(read, values);
+
+    // Empty reads at and past the end of the dataset read nothing.
+    reader.Read(values.size(), values.size(), &read[0]);
+    reader.Read(values.size() + 10, values.size() + 10, &read[0]);
+    EXPECT_EQ(read, values);
+
+    reader.Close();
+    file.Close();
+}
@@ -56,3 +56,73 @@ TEST_F(HDFBasReaderTEST, GetChemistryTriple)
     EXPECT_EQ(sequencingKit, "100356200");
     EXPECT_EQ(version, "2.3");
 }
+
+TEST_F(HDFBasReaderTEST, ReadInBlocks)
+{
+    T_HDFBasReader<SMRTSequence> blockReader;
+    blockReader.InitializeDefaultIncludedFields();
+    ASSERT_EQ(blockReader.Initialize(fileName), 1);
+    blockReader.SetReadBlockSize(64);
+
+    SMRTSequence seq, blockSeq;
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(reader.GetNext(seq), blockReader.GetNext(blockSeq));
+        EXPECT_EQ(seq.GetTitle(), blockSeq.GetTitle());
+        ASSERT_EQ(seq.length, blockSeq.length);
+        EXPECT_EQ(seq.HoleNumber(), blockSeq.HoleNumber());
+        EXPECT_EQ(seq.readScore, blockSeq.readScore);
+        for (DNALength j = 0; j < seq.length; j++) {
+            EXPECT_EQ(seq.seq[j], blockSeq.seq[j]);
+            EXPECT_EQ(seq.qual[j], blockSeq.qual[j]);
+        }
+    }
+    blockReader.Close();
+}
+
+TEST_F(HDFBasReaderTEST, ReadShards)
+{
+    // Reads of all shards, in shard order, are the reads of the file.
+    std::vector<std::string> titles;
+    FASTASequence seq;
+    while (reader.GetNext(seq)) {
+        titles.push_back(seq.GetTitle());
+    }
+
+    const UInt numShards = 3;
+    std::vector<std::string> shardTitles;
+    for (UInt shardIndex = 0; shardIndex < numShards; shardIndex++) {
+        T_HDFBasReader<FASTASequence> shardReader;
+        shardReader.IncludeField("Basecall");
+        ASSERT_EQ(shardReader.Initialize(fileName), 1);
+        UInt beginRead, endRead;
+        shardReader.GetShardReadRange(shardIndex, numShards, beginRead, endRead);
+        EXPECT_LT(beginRead, endRead);
+        shardReader.SetReadRange(beginRead, endRead);
+        while (shardReader.GetNext(seq)) {
+            shardTitles.push_back(seq.GetTitle());
+        }
+        shardReader.Close();
+    }
+    EXPECT_EQ(titles, shardTitles);
+}
+
+TEST_F(HDFBasReaderTEST, LookupHoleNumber)
+{
+    std::vector<unsigned int> holeNumbers;
+    SMRTSequence seq;
+    while (reader.GetNext(seq)) {
+        holeNumbers.push_back(seq.HoleNumber());
+    }
+    ASSERT_FALSE(holeNumbers.empty());
+
+    // Look up holes in reverse so that reads are not in file order.
+    for (size_t i = holeNumbers.size(); i-- > 0;) {
+        UInt index;
+        ASSERT_TRUE(reader.LookupHoleNumber(holeNumbers[i], index));
+        EXPECT_EQ(index, i);
+        reader.GetReadAt(index, seq);
+        EXPECT_EQ(seq.HoleNumber(), holeNumbers[i]);
+    }
+    UInt index;
+    EXPECT_FALSE(reader.LookupHoleNumber(holeNumbers.back() + 1, index));
+}
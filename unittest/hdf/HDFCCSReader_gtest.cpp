@@ -64,3 +64,39 @@ TEST_F(HDFCCSReaderTEST, ReadCCSFromCCSH5)
 
     reader.Close();
 }
+
+TEST_F(HDFCCSReaderTEST, ReadCCSRangeFromCCSH5)
+{
+    std::string fileName = ccsFile1;
+    HDFCCSReader<CCSSequence> reader;
+    reader.SetReadBasesFromCCS();
+    reader.InitializeDefaultIncludedFields();
+    ASSERT_EQ(reader.Initialize(fileName), 1);
+
+    // Skip the first 100 zmws by reading through them, then by seeking.
+    CCSSequence seq;
+    for (int i = 0; i < 100; i++) {
+        reader.GetNext(seq);
+    }
+    std::vector<std::string> titles;
+    std::vector<DNALength> lengths;
+    for (int i = 0; i < 100; i++) {
+        reader.GetNext(seq);
+        titles.push_back(seq.GetTitle());
+        lengths.push_back(seq.length);
+    }
+    reader.Close();
+
+    HDFCCSReader<CCSSequence> rangeReader;
+    rangeReader.SetReadBasesFromCCS();
+    rangeReader.InitializeDefaultIncludedFields();
+    ASSERT_EQ(rangeReader.Initialize(fileName), 1);
+    rangeReader.SetReadRange(100, 200);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(rangeReader.GetNext(seq), 1);
+        EXPECT_EQ(titles[i], seq.GetTitle());
+        EXPECT_EQ(lengths[i], seq.length);
+    }
+    EXPECT_EQ(rangeReader.GetNext(seq), 0);
+    rangeReader.Close();
+}
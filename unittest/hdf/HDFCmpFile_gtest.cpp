@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <hdf/HDFCmpFile.hpp>
+
+class HDFCmpFileTest : public ::testing::Test
+{
+public:
+    // Write the files once; a file is not closed until all its objects are.
+    static void SetUpTestCase()
+    {
+        fileName = "cmpfile.cmp.h5";
+        bufferedFileName = "cmpfile_buffered.cmp.h5";
+        unclosedFileName = "cmpfile_unclosed.cmp.h5";
+        alnArrays.clear();
+        WriteCmpFile(fileName, 0);
+        WriteCmpFile(bufferedFileName, 1000);
+        WriteCmpFile(unclosedFileName, 1000, false);
+    }
+
+    static void WriteCmpFile(std::string cmpFileName, int bufferSize, bool close = true)
+    {
+        std::string movieName = "m1", refGroupName;
+        HDFCmpFile<AlignmentCandidate<> > cmpFile;
+        cmpFile.Create(cmpFileName);
+        // The buffer size of write options does not buffer alignments.
+        HDFWriteOptions options;
+        cmpFile.SetWriteOptions(options);
+        cmpFile.SetWriteBufferSize(bufferSize);
+        UInt refGroupId = cmpFile.AddReference("chr1", 100000, "md5", refGroupName);
+        UInt alnGroupId = cmpFile.alnGroupGroup.AddPath("/" + refGroupName + "/" + movieName);
+        UInt movieId = cmpFile.movieInfoGroup.AddMovie(movieName);
+
+        // Alignments sorted by tStart, of varying lengths.
+        bool storeArrays = alnArrays.empty();
+        for (UInt i = 0; i < 200; i++) {
+            std::vector<unsigned char> alnArray(10 + i % 7);
+            for (size_t j = 0; j < alnArray.size(); j++) {
+                alnArray[j] = static_cast<unsigned char>(i + j);
+            }
+            UInt offsetBegin, offsetEnd;
+            cmpFile.StoreAlnArray(alnArray, "chr1", movieName, offsetBegin, offsetEnd);
+            if (storeArrays) alnArrays.push_back(alnArray);
+
+            std::vector<UInt> alnIndex(HDFCmpData::NCols, 0);
+            alnIndex[0] = i + 1;          // AlnId
+            alnIndex[1] = alnGroupId;     // AlnGroupID
+            alnIndex[2] = movieId;        // MovieID
+            alnIndex[3] = refGroupId;     // RefGroupID
+            alnIndex[4] = 100 * i;        // tStart
+            alnIndex[5] = 100 * i + 250;  // tEnd
+            alnIndex[18] = offsetBegin;   // Offset_begin
+            alnIndex[19] = offsetEnd;     // Offset_end
+            cmpFile.alnInfoGroup.WriteAlnIndex(alnIndex);
+        }
+        // Otherwise the destructor writes buffered alignments.
+        if (close) cmpFile.Close();
+    }
+
+    static std::string fileName;
+    static std::string bufferedFileName;
+    static std::string unclosedFileName;
+    static std::vector<std::vector<unsigned char> > alnArrays;
+};
+
+std::string HDFCmpFileTest::fileName;
+std::string HDFCmpFileTest::bufferedFileName;
+std::string HDFCmpFileTest::unclosedFileName;
+std::vector<std::vector<unsigned char> > HDFCmpFileTest::alnArrays;
+
+TEST_F(HDFCmpFileTest, ReadWindow)
+{
+    HDFCmpFile<AlignmentCandidate<> > cmpReader;
+    ASSERT_EQ(cmpReader.Initialize(fileName), 1);
+    CmpFile cmpFile;
+    cmpReader.Read(cmpFile, false);
+    ASSERT_EQ(cmpFile.alnInfo.alignments.size(), alnArrays.size());
+
+    std::vector<UInt> alignmentIndices;
+    cmpReader.ReadWindow(cmpFile, 1, 1000, 1300, alignmentIndices);
+    EXPECT_EQ(alignmentIndices, std::vector<UInt>({8, 9, 10, 11, 12}));
+    for (UInt i = 0; i < alnArrays.size(); i++) {
+        bool inWindow = (i >= 8 and i <= 12);
+        EXPECT_EQ(cmpFile.alnInfo.alignments[i].alignmentArray.size(),
+                  inWindow ? alnArrays[i].size() : 0);
+        if (inWindow) {
+            EXPECT_EQ(cmpFile.alnInfo.alignments[i].alignmentArray, alnArrays[i]);
+        }
+    }
+
+    cmpReader.ReadWindow(cmpFile, 2, 0, 100000, alignmentIndices);
+    EXPECT_TRUE(alignmentIndices.empty());
+    cmpReader.Close();
+}
+
+TEST_F(HDFCmpFileTest, ReadAll)
+{
+    HDFCmpFile<AlignmentCandidate<> > cmpReader;
+    ASSERT_EQ(cmpReader.Initialize(fileName), 1);
+    CmpFile cmpFile;
+    cmpReader.Read(cmpFile);
+    ASSERT_EQ(cmpFile.alnInfo.alignments.size(), alnArrays.size());
+    for (UInt i = 0; i < alnArrays.size(); i++) {
+        EXPECT_EQ(cmpFile.alnInfo.alignments[i].alignmentArray, alnArrays[i]);
+    }
+    cmpReader.Close();
+}
+
+TEST_F(HDFCmpFileTest, BufferedWrite)
+{
+    for (std::string bufferedName : {bufferedFileName, unclosedFileName}) {
+        HDFCmpFile<AlignmentCandidate<> > cmpReader, bufferedReader;
+        ASSERT_EQ(cmpReader.Initialize(fileName), 1);
+        ASSERT_EQ(bufferedReader.Initialize(bufferedName), 1);
+        CmpFile cmpFile, bufferedCmpFile;
+        cmpReader.Read(cmpFile);
+        bufferedReader.Read(bufferedCmpFile);
+        ASSERT_EQ(bufferedCmpFile.alnInfo.alignments.size(), alnArrays.size());
+        for (UInt i = 0; i < alnArrays.size(); i++) {
+            CmpAlignment &alignment = bufferedCmpFile.alnInfo.alignments[i];
+            EXPECT_EQ(alignment.alignmentArray, alnArrays[i]);
+            EXPECT_EQ(alignment.GetOffsetBegin(), cmpFile.alnInfo.alignments[i].GetOffsetBegin());
+        }
+        bufferedReader.Close();
+        cmpReader.Close();
+    }
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <hdf/BufferedHDF2DArray.hpp>
+#include <hdf/BufferedHDFArray.hpp>
+#include <hdf/HDFAtom.hpp>
+#include <hdf/HDFFile.hpp>
+#include <hdf/HDFIOStats.hpp>
+
+class HDFIOStatsTest : public ::testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        HDFIOStats::Instance().Clear();
+        HDFIOStats::Instance().Enable("iostats.json");
+    }
+
+    virtual void TearDown()
+    {
+        HDFIOStats::Instance().Disable();
+        HDFIOStats::Instance().Clear();
+    }
+};
+
+TEST_F(HDFIOStatsTest, CountsByDataset)
+{
+    HDFIOStats &stats = HDFIOStats::Instance();
+    std::vector<unsigned char> bases(1000, 'A');
+    std::vector<uint16_t> xy(2 * 100, 7);
+    {
+        HDFFile outFile;
+        outFile.Open("iostats.h5", H5F_ACC_TRUNC);
+        BufferedHDFArray<unsigned char> basecallArray;
+        basecallArray.SetBufferSize(400);
+        ASSERT_EQ(basecallArray.Initialize(outFile.rootGroup, "Basecall"), 1);
+        basecallArray.Write(&bases[0], bases.size());
+        basecallArray.Flush();
+        BufferedHDF2DArray<uint16_t> xyArray;
+        ASSERT_EQ(xyArray.Initialize(outFile.rootGroup, "HoleXY", 2), 1);
+        xyArray.WriteRow(&xy[0], xy.size());
+        xyArray.Flush();
+        HDFAtom<int> atom;
+        atom.Create(outFile.rootGroup.group, "NumBases");
+        atom.Write(1000);
+        basecallArray.Close();
+        xyArray.Close();
+        outFile.Close();
+    }
+
+    EXPECT_EQ(stats.Get("/Basecall", HDFIOStats::Create).calls, 1);
+    // 400 + 400 + 200 bases.
+    EXPECT_EQ(stats.Get("/Basecall", HDFIOStats::Write).calls, 3);
+    EXPECT_EQ(stats.Get("/Basecall", HDFIOStats::Write).bytes, bases.size());
+    EXPECT_EQ(stats.Get("/Basecall", HDFIOStats::Extend).calls, 3);
+    EXPECT_EQ(stats.Get("/HoleXY", HDFIOStats::Write).bytes, xy.size() * sizeof(uint16_t));
+    EXPECT_EQ(stats.Get("/@NumBases", HDFIOStats::Write).calls, 1);
+
+    HDFFile inFile;
+    inFile.Open("iostats.h5", H5F_ACC_RDONLY);
+    BufferedHDFArray<unsigned char> basecallArray;
+    ASSERT_EQ(basecallArray.InitializeForReading(inFile.rootGroup, "Basecall"), 1);
+    std::vector<unsigned char> readBases(bases.size());
+    basecallArray.Read(0, 100, &readBases[0]);
+    basecallArray.Read(100, bases.size(), &readBases[100]);
+    basecallArray.Close();
+    inFile.Close();
+    EXPECT_EQ(stats.Get("/Basecall", HDFIOStats::Read).calls, 2);
+    EXPECT_EQ(stats.Get("/Basecall", HDFIOStats::Read).bytes, bases.size());
+
+    // The counters so far are written at Close().
+    std::ifstream in("iostats.json");
+    std::stringstream json;
+    json << in.rdbuf();
+    EXPECT_NE(json.str().find("\"/Basecall\": {\"read\": {\"calls\": 2, \"bytes\": 1000"),
+              std::string::npos);
+    EXPECT_NE(json.str().find("\"/HoleXY\""), std::string::npos);
+}
+
+TEST_F(HDFIOStatsTest, Disabled)
+{
+    HDFIOStats::Instance().Disable();
+    {
+        HDFFile outFile;
+        outFile.Open("iostats_disabled.h5", H5F_ACC_TRUNC);
+        BufferedHDFArray<int> array;
+        ASSERT_EQ(array.Initialize(outFile.rootGroup, "Values"), 1);
+        int value = 1;
+        array.Write(&value, 1);
+        array.Flush();
+        array.Close();
+        outFile.Close();
+    }
+    EXPECT_EQ(HDFIOStats::Instance().Get("/Values", HDFIOStats::Write).calls, 0);
+}
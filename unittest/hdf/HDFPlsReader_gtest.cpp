@@ -47,3 +47,59 @@ TEST_F(HDFPlsReaderTEST, ReadToPulseFile)
     ASSERT_EQ(pulseFile.platformId, 2);
     ASSERT_EQ(pulseFile.startFrame.size(), 197626964u);
 }
+
+TEST_F(HDFPlsReaderTEST, GetNextBlock)
+{
+    reader.IncludeField("StartFrame");
+    reader.IncludeField("WidthInFrames");
+
+    PulseBlock block;
+    ASSERT_EQ(reader.GetNextBlock(block, 10), 10);
+    ASSERT_EQ(reader.GetBlockAt(0, 10, block), 10);
+    EXPECT_EQ(block.firstRead, 0);
+
+    // Flattening all pulses of a read matches reading it alone.
+    for (DSLength i = 0; i < block.NumReads(); i++) {
+        DNALength length = block.NumPulses(i);
+        if (length == 0) continue;
+        std::vector<int> basToPlsIndex(length);
+        for (DNALength b = 0; b < length; b++) {
+            basToPlsIndex[b] = b;
+        }
+        SMRTSequence read;
+        read.Allocate(length);
+        int *index = &basToPlsIndex[0];
+        reader.GetReadAt(i, index, read);
+
+        std::vector<unsigned int> startFrame(length);
+        block.FlattenToBase(block.startFrame, i, &basToPlsIndex[0], length, &startFrame[0]);
+        std::vector<uint16_t> widthInFrames(length);
+        block.FlattenToBase(block.widthInFrames, i, &basToPlsIndex[0], length, &widthInFrames[0]);
+        for (DNALength b = 0; b < length; b++) {
+            EXPECT_EQ(startFrame[b], read.startFrame[b]);
+            EXPECT_EQ(widthInFrames[b], read.widthInFrames[b]);
+        }
+    }
+}
+
+TEST_F(HDFPlsReaderTEST, GetNextBlockBySize)
+{
+    std::vector<std::string> fields = {"StartFrame", "WidthInFrames"};
+    ASSERT_EQ(reader.IncludeOnlyFields(fields), 1);
+    EXPECT_EQ(reader.GetBytesPerPulse(), sizeof(unsigned int) + sizeof(uint16_t));
+
+    const DSLength maxBytes = 1 << 20;
+    PulseBlock block;
+    DSLength nReads = 0;
+    DSLength nBlockReads;
+    while ((nBlockReads = reader.GetNextBlockBySize(block, maxBytes)) > 0) {
+        EXPECT_EQ(block.firstRead, nReads);
+        // A block is only over budget if it holds a single long read.
+        if (nBlockReads > 1) {
+            EXPECT_LE(block.readOffsets.back() * reader.GetBytesPerPulse(), maxBytes);
+        }
+        nReads += nBlockReads;
+    }
+    EXPECT_EQ(nReads, reader.nReads);
+    EXPECT_GT(reader.peakBufferBytes, 0);
+}
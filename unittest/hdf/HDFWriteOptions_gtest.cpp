@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hdf/BufferedHDF2DArray.hpp>
+#include <hdf/BufferedHDFArray.hpp>
+#include <hdf/HDFFile.hpp>
+#include <hdf/HDFWriteOptions.hpp>
+
+TEST(HDFWriteOptions, ChunkLength)
+{
+    HDFWriteOptions options;
+    // The default keeps the historical chunk length.
+    EXPECT_EQ(options.ChunkLength(1), 16384);
+    EXPECT_EQ(options.ChunkLength(8), 16384);
+
+    options.chunkLength = 0;
+    EXPECT_EQ(options.ChunkLength(1), HDFWriteOptions::TargetChunkBytes);
+    EXPECT_EQ(options.ChunkLength(4), HDFWriteOptions::TargetChunkBytes / 4);
+    EXPECT_EQ(options.ChunkLength(2 * HDFWriteOptions::TargetChunkBytes), 1);
+
+    // Small datasets get a single chunk of their expected length.
+    options.expectedLength = 1000;
+    EXPECT_EQ(options.ChunkLength(2), 1000);
+}
+
+TEST(HDFWriteOptions, WriteCompressed)
+{
+    std::vector<unsigned char> bases(100000);
+    for (size_t i = 0; i < bases.size(); i++) {
+        bases[i] = "ACGT"[(i * 7 + i / 13) % 4];
+    }
+    std::vector<int16_t> xy(2 * 5000);
+    for (size_t i = 0; i < xy.size(); i++) {
+        xy[i] = static_cast<int16_t>(i % 97);
+    }
+
+    const HDFWriteOptions options = HDFWriteOptions::Compressed(4, bases.size());
+    {
+        HDFFile outFile;
+        outFile.Open("writeoptions.h5", H5F_ACC_TRUNC);
+
+        BufferedHDFArray<unsigned char> basecallArray;
+        basecallArray.SetWriteOptions(options);
+        ASSERT_EQ(basecallArray.Initialize(outFile.rootGroup, "Basecall"), 1);
+        for (size_t i = 0; i < bases.size(); i += 1000) {
+            basecallArray.Write(&bases[i], 1000);
+        }
+        basecallArray.Flush();
+
+        BufferedHDF2DArray<int16_t> xyArray;
+        xyArray.SetWriteOptions(options);
+        ASSERT_EQ(xyArray.Initialize(outFile.rootGroup, "HoleXY", 2), 1);
+        for (size_t i = 0; i < xy.size(); i += 2) {
+            xyArray.WriteRow(&xy[i], 2);
+        }
+        xyArray.Flush();
+
+        H5::DSetCreatPropList cparms = basecallArray.dataset.getCreatePlist();
+        hsize_t chunkDims[1];
+        EXPECT_EQ(cparms.getChunk(1, chunkDims), 1);
+        EXPECT_EQ(chunkDims[0], bases.size());
+        if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+            EXPECT_TRUE(cparms.allFiltersAvail());
+            EXPECT_GE(cparms.getNfilters(), 1);
+            EXPECT_LT(basecallArray.dataset.getStorageSize(), bases.size());
+        }
+        basecallArray.Close();
+        xyArray.Close();
+        outFile.Close();
+    }
+
+    HDFFile inFile;
+    inFile.Open("writeoptions.h5", H5F_ACC_RDONLY);
+    BufferedHDFArray<unsigned char> basecallArray;
+    ASSERT_EQ(basecallArray.InitializeForReading(inFile.rootGroup, "Basecall"), 1);
+    ASSERT_EQ(basecallArray.arrayLength, bases.size());
+    std::vector<unsigned char> readBases(bases.size());
+    basecallArray.Read(0, bases.size(), &readBases[0]);
+    EXPECT_EQ(readBases, bases);
+
+    BufferedHDF2DArray<int16_t> xyArray;
+    ASSERT_EQ(xyArray.InitializeForReading(inFile.rootGroup, "HoleXY"), 1);
+    ASSERT_EQ(xyArray.GetNRows(), xy.size() / 2);
+    std::vector<int16_t> readXY(xy.size());
+    xyArray.Read(0, xy.size() / 2, &readXY[0]);
+    EXPECT_EQ(readXY, xy);
+    basecallArray.Close();
+    xyArray.Close();
+    inFile.Close();
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <hdf/BufferedHDF2DArray.hpp>
+#include <hdf/BufferedHDFArray.hpp>
+#include <hdf/HDFFile.hpp>
+#include <hdf/HDFRegionsWriter.hpp>
+#include <hdf/HDFWriteOptions.hpp>
+#include <hdf/HDFWriteQueue.hpp>
+
+TEST(HDFWriteQueue, AsyncWrite)
+{
+    std::vector<unsigned char> bases(100000);
+    for (size_t i = 0; i < bases.size(); i++) {
+        bases[i] = "ACGT"[(i * 7 + i / 13) % 4];
+    }
+    std::vector<int16_t> xy(2 * 5000);
+    for (size_t i = 0; i < xy.size(); i++) {
+        xy[i] = static_cast<int16_t>(i % 97);
+    }
+
+    HDFWriteOptions options;
+    options.bufferSize = 1000;
+    options.writeQueue = std::make_shared<HDFWriteQueue>();
+    {
+        HDFFile outFile;
+        outFile.Open("writequeue.h5", H5F_ACC_TRUNC);
+
+        BufferedHDFArray<unsigned char> basecallArray;
+        basecallArray.SetWriteOptions(options);
+        ASSERT_EQ(basecallArray.Initialize(outFile.rootGroup, "Basecall"), 1);
+        BufferedHDF2DArray<int16_t> xyArray;
+        xyArray.SetWriteOptions(options);
+        ASSERT_EQ(xyArray.Initialize(outFile.rootGroup, "HoleXY", 2), 1);
+
+        // Interleave writes so that both arrays flush through the queue.
+        for (size_t i = 0; i < xy.size(); i += 2) {
+            basecallArray.Write(&bases[10 * i], 20);
+            xyArray.WriteRow(&xy[i], 2);
+        }
+        basecallArray.Flush();
+        xyArray.Flush();
+        EXPECT_TRUE(options.writeQueue->Wait());
+        EXPECT_EQ(basecallArray.size(), bases.size());
+
+        basecallArray.Close();
+        xyArray.Close();
+        outFile.Close();
+    }
+
+    HDFFile inFile;
+    inFile.Open("writequeue.h5", H5F_ACC_RDONLY);
+    BufferedHDFArray<unsigned char> basecallArray;
+    ASSERT_EQ(basecallArray.InitializeForReading(inFile.rootGroup, "Basecall"), 1);
+    ASSERT_EQ(basecallArray.arrayLength, bases.size());
+    std::vector<unsigned char> readBases(bases.size());
+    basecallArray.Read(0, bases.size(), &readBases[0]);
+    EXPECT_EQ(readBases, bases);
+
+    BufferedHDF2DArray<int16_t> xyArray;
+    ASSERT_EQ(xyArray.InitializeForReading(inFile.rootGroup, "HoleXY"), 1);
+    ASSERT_EQ(xyArray.GetNRows(), xy.size() / 2);
+    std::vector<int16_t> readXY(xy.size());
+    xyArray.Read(0, xy.size() / 2, &readXY[0]);
+    EXPECT_EQ(readXY, xy);
+    basecallArray.Close();
+    xyArray.Close();
+    inFile.Close();
+}
+
+TEST(HDFWriteQueue, AsyncRegions)
+{
+    HDFWriteOptions options;
+    options.bufferSize = 20;
+    options.writeQueue = std::make_shared<HDFWriteQueue>();
+    const int numHoles = 1000;
+    {
+        HDFFile outFile;
+        outFile.Open("writequeue_regions.h5", H5F_ACC_TRUNC);
+        HDFRegionsWriter writer("writequeue_regions.h5", outFile.rootGroup,
+                                PacBio::AttributeValues::Regions::regiontypes, options);
+        for (int hole = 0; hole < numHoles; hole++) {
+            // Rows must be copied before this vector goes out of scope.
+            std::vector<RegionAnnotation> regions = {
+                RegionAnnotation(hole, HQRegion, hole, hole + 10, 900),
+                RegionAnnotation(hole, Insert, hole + 1, hole + 9, -1)};
+            EXPECT_TRUE(writer.Write(regions));
+        }
+        writer.Close();
+        EXPECT_TRUE(options.writeQueue->Wait());
+        outFile.Close();
+    }
+
+    HDFFile inFile;
+    inFile.Open("writequeue_regions.h5", H5F_ACC_RDONLY);
+    BufferedHDF2DArray<int> regionsArray;
+    ASSERT_EQ(regionsArray.InitializeForReading(inFile.rootGroup, PacBio::GroupNames::regions), 1);
+    ASSERT_EQ(regionsArray.GetNRows(), 2u * numHoles);
+    std::vector<int> rows(2 * numHoles * RegionAnnotation::NCOLS);
+    regionsArray.Read(0, 2 * numHoles, &rows[0]);
+    for (int hole = 0; hole < numHoles; hole++) {
+        const int *hqRow = &rows[2 * hole * RegionAnnotation::NCOLS];
+        EXPECT_EQ(hqRow[RegionAnnotation::HOLENUMBERCOL], hole);
+        EXPECT_EQ(hqRow[RegionAnnotation::REGIONSTARTCOL], hole);
+        EXPECT_EQ(hqRow[RegionAnnotation::REGIONENDCOL], hole + 10);
+        const int *insertRow = hqRow + RegionAnnotation::NCOLS;
+        EXPECT_EQ(insertRow[RegionAnnotation::REGIONSTARTCOL], hole + 1);
+    }
+    regionsArray.Close();
+    inFile.Close();
+}
+
+TEST(HDFWriteQueue, Error)
+{
+    HDFWriteQueue queue;
+    int numRun = 0;
+    queue.Submit([&numRun]() { numRun++; });
+    const uint64_t failed = queue.Submit([]() { throw std::runtime_error("disk full"); });
+    queue.Submit([&numRun]() { numRun++; });
+    queue.WaitFor(failed);
+
+    EXPECT_FALSE(queue.Wait());
+    EXPECT_NE(queue.Error().find("disk full"), std::string::npos);
+    // Writes after the failed one are dropped.
+    EXPECT_EQ(numRun, 1);
+}
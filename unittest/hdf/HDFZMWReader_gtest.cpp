@@ -92,6 +92,49 @@ TEST_F(HDFZMWReaderTEST, ReadZMWFromBaseCalls)
     Close(pbihdfFile, baseCallsGroup);
 }
 
+TEST_F(HDFZMWReaderTEST, Load)
+{
+    std::string fileName = baxFile2;
+    std::string groupName = "/PulseData/BaseCalls";
+    H5File pbihdfFile;
+    HDFGroup baseCallsGroup;
+    Initialize(pbihdfFile, fileName, groupName, baseCallsGroup);
+
+    HDFZMWReader zmwReader, loadedReader;
+    ASSERT_NE(zmwReader.Initialize(&baseCallsGroup), 0);
+    ASSERT_NE(loadedReader.Initialize(&baseCallsGroup), 0);
+    ASSERT_NE(loadedReader.Load(), 0);
+    ASSERT_TRUE(loadedReader.IsLoaded());
+    ASSERT_EQ(loadedReader.eventOffsets.size(), loadedReader.nZMWEntries + 1);
+
+    // Entries served from memory are those read from the file.
+    ZMWGroupEntry entry, loadedEntry;
+    UInt index = 0;
+    while (zmwReader.GetNext(entry)) {
+        ASSERT_TRUE(loadedReader.GetNext(loadedEntry));
+        EXPECT_EQ(entry.holeNumber, loadedEntry.holeNumber);
+        EXPECT_EQ(entry.holeStatus, loadedEntry.holeStatus);
+        EXPECT_EQ(entry.x, loadedEntry.x);
+        EXPECT_EQ(entry.y, loadedEntry.y);
+        EXPECT_EQ(entry.numEvents, loadedEntry.numEvents);
+        EXPECT_EQ(loadedReader.eventOffsets[index + 1] - loadedReader.eventOffsets[index],
+                  entry.numEvents);
+
+        UInt holeIndex;
+        ASSERT_TRUE(loadedReader.LookupHoleNumber(entry.holeNumber, holeIndex));
+        EXPECT_EQ(holeIndex, index);
+        index++;
+    }
+    EXPECT_FALSE(loadedReader.GetNext(loadedEntry));
+    UInt holeIndex;
+    EXPECT_FALSE(loadedReader.LookupHoleNumber(loadedReader.holeNumbers.back() + 1, holeIndex));
+
+    zmwReader.Close();
+    loadedReader.Close();
+    EXPECT_FALSE(loadedReader.IsLoaded());
+    Close(pbihdfFile, baseCallsGroup);
+}
+
 TEST_F(HDFZMWReaderTEST, ReadZMWFromPulseCalls)
 {
     std::string fileName = plsFile1;
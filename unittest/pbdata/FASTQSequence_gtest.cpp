@@ -72,3 +72,66 @@ TEST_F(FASTQSequenceTest, ReverseComplementSelf)
     EXPECT_EQ(fastqOne.title, name);
     EXPECT_EQ(fastqOne.qual.ToString(), rq);
 }
+
+// A read that defers decoding its InsertionQV and DeletionQV, as
+// SMRTSequence::LazyCopy does, and counts the tracks it decodes.
+class DeferringFASTQSequence : public FASTQSequence
+{
+public:
+    DeferringFASTQSequence(const std::string& s, const std::string& iq, const std::string& dq)
+        : decoded(0), iq_(iq), dq_(dq)
+    {
+        static_cast<FASTASequence*>(this)->Copy(s);
+        deferredQVs_ = InsertionQV | DeletionQV;
+    }
+
+    int decoded;
+
+protected:
+    void DecodeDeferredQVs(int qvMask)
+    {
+        if (qvMask & InsertionQV) insertionQV.Copy(iq_);
+        if (qvMask & DeletionQV) deletionQV.Copy(dq_);
+        decoded |= qvMask;
+        deferredQVs_ &= ~qvMask;
+    }
+
+private:
+    std::string iq_, dq_;
+};
+
+TEST(FASTQSequenceLoadQVsTest, DecodesEachTrackOnItsFirstLoad)
+{
+    DeferringFASTQSequence read("ACGT", "0123", "4567");
+    const FASTQSequence& fastq = read;
+    EXPECT_TRUE(fastq.insertionQV.Empty());
+    EXPECT_EQ(fastq.DeferredQVs(), InsertionQV | DeletionQV);
+
+    // Accessors of the base class load the track they read, and only it.
+    EXPECT_EQ(fastq.GetInsertionQV(2), '2' - FASTQSequence::charToQuality);
+    EXPECT_EQ(read.decoded, InsertionQV);
+    EXPECT_EQ(fastq.DeferredQVs(), DeletionQV);
+    EXPECT_TRUE(fastq.deletionQV.Empty());
+
+    std::string qvs;
+    EXPECT_TRUE(fastq.GetQVs("DeletionQV", qvs));
+    EXPECT_EQ(qvs, "4567");
+    EXPECT_EQ(read.decoded, InsertionQV | DeletionQV);
+    EXPECT_EQ(fastq.DeferredQVs(), 0);
+}
+
+TEST(FASTQSequenceLoadQVsTest, CopiesLoadDeferredTracks)
+{
+    DeferringFASTQSequence read("ACGT", "0123", "4567");
+    FASTQSequence copy;
+    copy.Copy(read);
+    EXPECT_EQ(copy.insertionQV.ToString(), "0123");
+    EXPECT_EQ(copy.deletionQV.ToString(), "4567");
+    EXPECT_EQ(copy.DeferredQVs(), 0);
+
+    // Code that reads the fields directly loads them first.
+    DeferringFASTQSequence fieldRead("ACGT", "0123", "4567");
+    fieldRead.LoadQVs(DeletionQV);
+    EXPECT_EQ(fieldRead.deletionQV.ToString(), "4567");
+    EXPECT_EQ(fieldRead.decoded, DeletionQV);
+}
@@ -269,3 +269,32 @@ TEST_F(SMRTSequenceTest, MadeFromSubreadsAsPolymeraseNoInsertionNoDeletionNoSubs
         EXPECT_EQ(read3.seq[i], expected_seq3[i]);
     }
 }
+
+TEST_F(SMRTSequenceTest, Swap)
+{
+    SMRTSequence read = _make_a_smrt_read_("movie", 7, 10, 10 + seqst.size(), seqst, true, true,
+                                           true, 11, 12, 'G', 13, 'T');
+    read.ReadGroupId("rg");
+    read.HQRegionSnr('C', 4.5);
+    const Nucleotide* bases = read.seq;
+    const QualityValue* insertions = read.insertionQV.data;
+
+    SMRTSequence other;
+    other.Swap(read);
+
+    EXPECT_EQ(other.seq, bases);
+    EXPECT_EQ(other.insertionQV.data, insertions);
+    EXPECT_TRUE(other.deleteOnExit);
+    EXPECT_EQ(other.GetTitle(), "movie/7/10_29");
+    EXPECT_EQ(other.HoleNumber(), 7u);
+    EXPECT_EQ(other.SubreadStart(), 10u);
+    EXPECT_EQ(other.ReadGroupId(), "rg");
+    EXPECT_EQ(other.HQRegionSnr('C'), 4.5);
+    EXPECT_EQ(other.GetDeletionQV(0), 12);
+    EXPECT_EQ(other.GetSubstitutionTag(0), 'T');
+
+    EXPECT_EQ(read.seq, nullptr);
+    EXPECT_EQ(read.length, 0u);
+    EXPECT_TRUE(read.insertionQV.Empty());
+    EXPECT_EQ(read.title, nullptr);
+}
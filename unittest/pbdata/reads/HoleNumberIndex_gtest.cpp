@@ -0,0 +1,55 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <pbdata/reads/HoleNumberIndex.hpp>
+
+TEST(HoleNumberIndexTest, Dense)
+{
+    std::vector<UInt> holeNumbers = {7, 8, 10, 11, 8, 12};
+    HoleNumberIndex index;
+    index.Build(holeNumbers);
+    EXPECT_EQ(index.size(), holeNumbers.size());
+
+    size_t position = 100;
+    EXPECT_TRUE(index.Find(7, position));
+    EXPECT_EQ(position, 0);
+    EXPECT_TRUE(index.Find(10, position));
+    EXPECT_EQ(position, 2);
+    EXPECT_TRUE(index.Find(12, position));
+    EXPECT_EQ(position, 5);
+    // The first position of a repeated hole number is kept.
+    EXPECT_TRUE(index.Find(8, position));
+    EXPECT_EQ(position, 1);
+
+    EXPECT_FALSE(index.Find(9, position));
+    EXPECT_FALSE(index.Find(6, position));
+    EXPECT_FALSE(index.Find(13, position));
+    EXPECT_FALSE(index.Find(0, position));
+}
+
+TEST(HoleNumberIndexTest, Sparse)
+{
+    std::vector<UInt> holeNumbers = {5, 4000000, 123456789, 5};
+    HoleNumberIndex index;
+    index.Build(holeNumbers);
+
+    size_t position = 100;
+    EXPECT_TRUE(index.Find(5, position));
+    EXPECT_EQ(position, 0);
+    EXPECT_TRUE(index.Find(123456789, position));
+    EXPECT_EQ(position, 2);
+    EXPECT_FALSE(index.Find(6, position));
+
+    index.Clear();
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_FALSE(index.Find(5, position));
+}
+
+TEST(HoleNumberIndexTest, Empty)
+{
+    HoleNumberIndex index;
+    index.Build(std::vector<UInt>());
+    size_t position;
+    EXPECT_FALSE(index.Find(0, position));
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <vector>
+
+#include <pbdata/reads/PulseBlock.hpp>
+
+class PulseBlockTest : public ::testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        // Two reads with 3 and 4 pulses.
+        block.readOffsets = {0, 3, 7};
+        block.startFrame = {10, 11, 12, 20, 21, 22, 23};
+        block.maxSignalNDims = 2;
+        for (uint16_t pulse = 0; pulse < 7; pulse++) {
+            for (uint16_t channel = 0; channel < 4; channel++) {
+                block.maxSignal.push_back(pulse * 10 + channel);
+            }
+        }
+    }
+    PulseBlock block;
+};
+
+TEST_F(PulseBlockTest, ReadPulses)
+{
+    ASSERT_EQ(block.NumReads(), 2);
+    EXPECT_EQ(block.NumPulses(0), 3);
+    EXPECT_EQ(block.NumPulses(1), 4);
+    EXPECT_EQ(block.ReadPulses(block.startFrame, 1)[0], 20);
+    EXPECT_EQ(block.ReadPulses(block.maxSignal, 1, 4)[0], 30);
+}
+
+TEST_F(PulseBlockTest, FlattenToBase)
+{
+    // Pulse 1 of the second read is not called as a base.
+    const int basToPlsIndex[] = {0, 2, 3};
+    std::vector<unsigned int> startFrame(3);
+    block.FlattenToBase(block.startFrame, 1, basToPlsIndex, 3, &startFrame[0]);
+    EXPECT_EQ(startFrame, std::vector<unsigned int>({20, 22, 23}));
+
+    std::map<char, size_t> baseMap = {{'T', 0}, {'G', 1}, {'A', 2}, {'C', 3}};
+    block.SetBaseMap(baseMap);
+    const Nucleotide seq[] = {'A', 'C', 'T'};
+    std::vector<uint16_t> maxSignal(3);
+    block.FlattenSignalToBase(block.maxSignal, 2, 1, basToPlsIndex, seq, 3, &maxSignal[0]);
+    EXPECT_EQ(maxSignal, std::vector<uint16_t>({32, 53, 60}));
+
+    block.Clear();
+    EXPECT_EQ(block.NumReads(), 0);
+}
+
+TEST_F(PulseBlockTest, Free)
+{
+    EXPECT_GE(block.GetStorageSize(), 7 * (sizeof(unsigned int) + 4 * sizeof(uint16_t)));
+    block.Free();
+    EXPECT_EQ(block.NumReads(), 0);
+    EXPECT_EQ(block.startFrame.capacity(), 0);
+    EXPECT_EQ(block.maxSignal.capacity(), 0);
+    EXPECT_EQ(block.GetStorageSize(), block.readOffsets.capacity() * sizeof(DSLength));
+}
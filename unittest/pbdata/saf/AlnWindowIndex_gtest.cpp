@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <pbdata/saf/AlnWindowIndex.hpp>
+
+class AlnWindowIndexTest : public ::testing::Test
+{
+public:
+    virtual void SetUp()
+    {
+        columnNameToIndex = CmpAlignmentBase::columnNameToIndex;
+        std::vector<std::string> columnNames = {"RefGroupId", "tStart", "tEnd"};
+        CmpAlignment().InitializeColumnNameToIndex(columnNames);
+        // refGroupId, tStart, tEnd; not sorted by tStart.
+        AddAlignment(1, 100, 200);
+        AddAlignment(1, 0, 1000);
+        AddAlignment(2, 150, 160);
+        AddAlignment(1, 300, 400);
+        AddAlignment(1, 120, 130);
+        index.Build(alnInfo);
+    }
+
+    virtual void TearDown() { CmpAlignmentBase::columnNameToIndex = columnNameToIndex; }
+
+    void AddAlignment(UInt refGroupId, UInt tStart, UInt tEnd)
+    {
+        UInt row[] = {refGroupId, tStart, tEnd};
+        alnInfo.alignments.push_back(CmpAlignment());
+        alnInfo.alignments.back().StoreAlignmentIndex(row, 3);
+    }
+
+    std::vector<UInt> Find(UInt refGroupId, UInt tStart, UInt tEnd)
+    {
+        std::vector<UInt> alignmentIndices;
+        index.Find(refGroupId, tStart, tEnd, alignmentIndices);
+        return alignmentIndices;
+    }
+
+    std::map<std::string, int> columnNameToIndex;
+    AlnInfo alnInfo;
+    AlnWindowIndex index;
+};
+
+TEST_F(AlnWindowIndexTest, Find)
+{
+    ASSERT_TRUE(index.IsBuilt());
+    // Ordered by tStart.
+    EXPECT_EQ(Find(1, 0, 2000), std::vector<UInt>({1, 0, 4, 3}));
+    EXPECT_EQ(Find(1, 125, 126), std::vector<UInt>({1, 0, 4}));
+    // Ends are exclusive.
+    EXPECT_EQ(Find(1, 200, 300), std::vector<UInt>({1}));
+    EXPECT_EQ(Find(1, 1000, 2000), std::vector<UInt>());
+    EXPECT_EQ(Find(2, 0, 1000), std::vector<UInt>({2}));
+    EXPECT_EQ(Find(3, 0, 1000), std::vector<UInt>());
+}
+
+TEST_F(AlnWindowIndexTest, Clear)
+{
+    index.Clear();
+    EXPECT_FALSE(index.IsBuilt());
+    EXPECT_EQ(Find(1, 0, 2000), std::vector<UInt>());
+}
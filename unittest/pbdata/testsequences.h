@@ -0,0 +1,51 @@
+/* * ============================================================================
+ *
+ *       Filename:  testsequences.h
+ *
+ *    Description:  Make sequences used in unit tests.
+ *
+ * ============================================================================
+ */
+
+#ifndef _BLASR_UNITTEST_TEST_SEQUENCES_H_
+#define _BLASR_UNITTEST_TEST_SEQUENCES_H_
+
+#include <string>
+
+#include <pbdata/DNASequence.hpp>
+
+// A random sequence of ACGT, the same for the same seed on every platform.
+inline std::string RandomSequence(size_t length, unsigned int seed)
+{
+    const char bases[] = "ACGT";
+    std::string seq(length, 'A');
+    for (size_t i = 0; i < length; i++) {
+        seed = seed * 1103515245 + 12345;
+        seq[i] = bases[(seed >> 16) & 3];
+    }
+    return seq;
+}
+
+inline const Nucleotide *Seq(const std::string &str)
+{
+    return reinterpret_cast<const Nucleotide *>(str.c_str());
+}
+
+// Make seq refer to the bases of str without copying them.
+inline void ToDNASequence(std::string &str, DNASequence &seq)
+{
+    seq.seq = reinterpret_cast<Nucleotide *>(&str[0]);
+    seq.length = str.size();
+}
+
+// A read that is its own subread.
+class TestRead : public DNASequence
+{
+public:
+    TestRead(std::string &str) { ToDNASequence(str, *this); }
+    DNALength SubreadStart() const { return 0; }
+    DNALength SubreadEnd() const { return length; }
+    DNALength SubreadLength() const { return length; }
+};
+
+#endif